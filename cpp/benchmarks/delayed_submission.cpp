@@ -0,0 +1,139 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <unistd.h>  // for getopt, optarg
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <ucxx/delayed_submission.h>
+
+struct app_context_t {
+  size_t max_threads   = std::thread::hardware_concurrency();
+  size_t n_submissions = 1000000;
+  size_t capacity      = ucxx::DelayedSubmissionCollection::defaultCapacity;
+  size_t n_iter        = 3;
+};
+
+static void printUsage()
+{
+  std::cerr << " delayed submission contention benchmark" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Usage: ucxx_delayed_submission [options]" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Parameters are:" << std::endl;
+  std::cerr << "  -t <int>    maximum number of producer threads, doubled at each step from 1"
+            << std::endl;
+  std::cerr << "              (number of hardware threads)" << std::endl;
+  std::cerr << "  -s <int>    number of submissions per producer thread (1000000)" << std::endl;
+  std::cerr << "  -c <int>    capacity of the submission ring (1024)" << std::endl;
+  std::cerr << "  -n <int>    number of iterations to run for each thread count (3)" << std::endl;
+  std::cerr << "  -h          print this help" << std::endl;
+  std::cerr << std::endl;
+}
+
+bool parseCommand(app_context_t* app_context, int argc, char* const argv[])
+{
+  optind = 1;
+  int c;
+  while ((c = getopt(argc, argv, "t:s:c:n:h")) != -1) {
+    switch (c) {
+      case 't':
+        app_context->max_threads = atoi(optarg);
+        if (app_context->max_threads <= 0) {
+          std::cerr << "Wrong number of threads: " << app_context->max_threads << std::endl;
+          return false;
+        }
+        break;
+      case 's':
+        app_context->n_submissions = atoi(optarg);
+        if (app_context->n_submissions <= 0) {
+          std::cerr << "Wrong number of submissions: " << app_context->n_submissions << std::endl;
+          return false;
+        }
+        break;
+      case 'c':
+        app_context->capacity = atoi(optarg);
+        if (app_context->capacity <= 0) {
+          std::cerr << "Wrong capacity: " << app_context->capacity << std::endl;
+          return false;
+        }
+        break;
+      case 'n':
+        app_context->n_iter = atoi(optarg);
+        if (app_context->n_iter <= 0) {
+          std::cerr << "Wrong number of iterations: " << app_context->n_iter << std::endl;
+          return false;
+        }
+        break;
+      case 'h':
+      default: printUsage(); return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Run `numThreads` producers each registering `numSubmissions` callbacks, while the
+ * calling thread acts as the worker progress thread processing them. Returns the number
+ * of nanoseconds elapsed until all submissions were processed.
+ */
+size_t runContention(const app_context_t& app_context, size_t numThreads)
+{
+  ucxx::DelayedSubmissionCollection collection{app_context.capacity};
+
+  const size_t total = numThreads * app_context.n_submissions;
+  size_t processed   = 0;
+  std::atomic<bool> start{false};
+
+  std::vector<std::thread> producers;
+  for (size_t t = 0; t < numThreads; ++t) {
+    producers.emplace_back([&]() {
+      while (!start)
+        std::this_thread::yield();
+      // Capture a single pointer, similar to the requests capturing `this`
+      for (size_t i = 0; i < app_context.n_submissions; ++i)
+        collection.registerRequest([&processed]() { ++processed; });
+    });
+  }
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  start      = true;
+  while (processed < total)
+    collection.process();
+  auto end = std::chrono::high_resolution_clock::now();
+
+  for (auto& p : producers)
+    p.join();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+}
+
+int main(int argc, char** argv)
+{
+  app_context_t app_context;
+  if (!parseCommand(&app_context, argc, argv)) return -1;
+
+  std::cout << std::setw(10) << "threads" << std::setw(20) << "submissions/s" << std::endl;
+
+  for (size_t numThreads = 1; numThreads <= app_context.max_threads; numThreads *= 2) {
+    size_t best_duration_ns = std::numeric_limits<size_t>::max();
+    for (size_t n = 0; n < app_context.n_iter; ++n)
+      best_duration_ns = std::min(best_duration_ns, runContention(app_context, numThreads));
+
+    double rate = numThreads * app_context.n_submissions / (best_duration_ns / 1e9);
+    std::cout << std::setw(10) << numThreads << std::setw(20) << std::fixed << std::setprecision(0)
+              << rate << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,270 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <unistd.h>  // for getopt, optarg
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ucxx/api.h>
+
+struct app_context_t {
+  size_t max_workers                  = std::thread::hardware_concurrency() / 4;
+  size_t n_clients                    = 256;
+  size_t message_size                 = 8;
+  size_t n_messages                   = 1000;
+  size_t window_size                  = 16;
+  ucxx::WorkerPoolPlacement placement = ucxx::WorkerPoolPlacement::RoundRobin;
+  bool polling_mode                   = false;
+};
+
+struct server_context_t {
+  std::shared_ptr<ucxx::WorkerPool> worker_pool{nullptr};
+  std::mutex mutex{};
+  std::vector<std::shared_ptr<ucxx::Endpoint>> endpoints{};
+};
+
+static void printUsage()
+{
+  std::cerr << " listener connection fan-in benchmark" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Usage: ucxx_listener_fan_in [options]" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Parameters are:" << std::endl;
+  std::cerr << "  -w <int>    maximum number of server workers, doubled at each step from 1"
+            << std::endl;
+  std::cerr << "              (a quarter of the number of hardware threads)" << std::endl;
+  std::cerr << "  -c <int>    number of clients connecting to the listener (256)" << std::endl;
+  std::cerr << "  -s <bytes>  message size (8)" << std::endl;
+  std::cerr << "  -n <int>    number of messages per client (1000)" << std::endl;
+  std::cerr << "  -W <int>    number of messages in flight per client (16)" << std::endl;
+  std::cerr << "  -p <str>    placement of accepted connections: 'round-robin' or" << std::endl;
+  std::cerr << "              'least-inflight' (round-robin)" << std::endl;
+  std::cerr << "  -P          use polling progress mode (disabled)" << std::endl;
+  std::cerr << "  -h          print this help" << std::endl;
+  std::cerr << std::endl;
+}
+
+bool parseCommand(app_context_t* app_context, int argc, char* const argv[])
+{
+  optind = 1;
+  int c;
+  while ((c = getopt(argc, argv, "w:c:s:n:W:p:Ph")) != -1) {
+    switch (c) {
+      case 'w':
+        app_context->max_workers = atoi(optarg);
+        if (app_context->max_workers <= 0) {
+          std::cerr << "Wrong number of workers: " << app_context->max_workers << std::endl;
+          return false;
+        }
+        break;
+      case 'c':
+        app_context->n_clients = atoi(optarg);
+        if (app_context->n_clients <= 0) {
+          std::cerr << "Wrong number of clients: " << app_context->n_clients << std::endl;
+          return false;
+        }
+        break;
+      case 's':
+        app_context->message_size = atoi(optarg);
+        if (app_context->message_size <= 0) {
+          std::cerr << "Wrong message size: " << app_context->message_size << std::endl;
+          return false;
+        }
+        break;
+      case 'n':
+        app_context->n_messages = atoi(optarg);
+        if (app_context->n_messages <= 0) {
+          std::cerr << "Wrong number of messages: " << app_context->n_messages << std::endl;
+          return false;
+        }
+        break;
+      case 'W':
+        app_context->window_size = atoi(optarg);
+        if (app_context->window_size <= 0) {
+          std::cerr << "Wrong window size: " << app_context->window_size << std::endl;
+          return false;
+        }
+        break;
+      case 'p':
+        if (strcmp(optarg, "round-robin") == 0) {
+          app_context->placement = ucxx::WorkerPoolPlacement::RoundRobin;
+        } else if (strcmp(optarg, "least-inflight") == 0) {
+          app_context->placement = ucxx::WorkerPoolPlacement::LeastInflight;
+        } else {
+          std::cerr << "Wrong placement: " << optarg << std::endl;
+          return false;
+        }
+        break;
+      case 'P': app_context->polling_mode = true; break;
+      case 'h':
+      default: printUsage(); return false;
+    }
+  }
+
+  if (app_context->max_workers == 0) app_context->max_workers = 1;
+
+  return true;
+}
+
+static void listenerCallback(ucp_conn_request_h conn_request, void* arg)
+{
+  auto server_context = reinterpret_cast<server_context_t*>(arg);
+  auto endpoint       = server_context->worker_pool->createEndpointFromConnRequest(conn_request);
+
+  std::lock_guard<std::mutex> lock(server_context->mutex);
+  server_context->endpoints.push_back(endpoint);
+}
+
+static void waitRequests(std::vector<std::shared_ptr<ucxx::Request>>& requests)
+{
+  for (auto& r : requests) {
+    while (!r->isCompleted())
+      std::this_thread::yield();
+    r->checkError();
+  }
+  requests.clear();
+}
+
+/**
+ * Transfer `n_messages` messages on each endpoint, keeping up to `window_size` requests
+ * in flight per endpoint, relying on the workers' progress threads for completion.
+ */
+void transferLoop(const app_context_t& app_context,
+                  const std::vector<std::shared_ptr<ucxx::Endpoint>>& endpoints,
+                  const bool send)
+{
+  const size_t window = app_context.window_size;
+  std::vector<char> buffer(app_context.message_size * window * endpoints.size(), 0xaa);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.reserve(window * endpoints.size());
+
+  for (size_t done = 0; done < app_context.n_messages; done += window) {
+    size_t count = std::min(window, app_context.n_messages - done);
+    for (size_t e = 0; e < endpoints.size(); ++e) {
+      for (size_t i = 0; i < count; ++i) {
+        auto data = buffer.data() + (e * window + i) * app_context.message_size;
+        requests.push_back(send ? endpoints[e]->tagSend(data, app_context.message_size, 0)
+                                : endpoints[e]->tagRecv(data, app_context.message_size, 0));
+      }
+    }
+    waitRequests(requests);
+  }
+}
+
+/**
+ * Connect `n_clients` clients to a single listener whose connections are accepted on a
+ * pool of `numWorkers` workers, then have all clients send to the server concurrently.
+ * Returns the nanoseconds elapsed until all connections were accepted and until all
+ * messages were received.
+ */
+std::pair<size_t, size_t> runFanIn(const app_context_t& app_context,
+                                   std::shared_ptr<ucxx::Context> context,
+                                   std::shared_ptr<ucxx::WorkerPool> clientPool,
+                                   size_t numWorkers)
+{
+  server_context_t server_context;
+  server_context.worker_pool =
+    context->createWorkerPool(numWorkers, false, app_context.placement);
+  server_context.worker_pool->startProgressThreads(app_context.polling_mode);
+  auto listener =
+    server_context.worker_pool->createListener(0, listenerCallback, &server_context);
+
+  auto connect_begin = std::chrono::high_resolution_clock::now();
+  std::vector<std::shared_ptr<ucxx::Endpoint>> clients;
+  for (size_t i = 0; i < app_context.n_clients; ++i)
+    clients.push_back(clientPool->createEndpointFromHostname("127.0.0.1", listener->getPort()));
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(server_context.mutex);
+      if (server_context.endpoints.size() == app_context.n_clients) break;
+    }
+    std::this_thread::yield();
+  }
+  auto connect_end = std::chrono::high_resolution_clock::now();
+
+  // Server endpoints grouped by worker, and client endpoints grouped by client worker
+  auto groupByWorker = [](const std::vector<std::shared_ptr<ucxx::Endpoint>>& endpoints,
+                          std::shared_ptr<ucxx::WorkerPool> workerPool) {
+    std::vector<std::vector<std::shared_ptr<ucxx::Endpoint>>> grouped(workerPool->size());
+    for (auto& endpoint : endpoints)
+      for (size_t w = 0; w < workerPool->size(); ++w)
+        if (endpoint->getParent() == workerPool->getWorker(w)) grouped[w].push_back(endpoint);
+    return grouped;
+  };
+  auto server_endpoints = groupByWorker(server_context.endpoints, server_context.worker_pool);
+  auto client_endpoints = groupByWorker(clients, clientPool);
+
+  std::atomic<bool> start{false};
+  std::vector<std::thread> threads;
+  for (auto& endpoints : server_endpoints)
+    threads.emplace_back([&app_context, &start, &endpoints]() {
+      while (!start)
+        std::this_thread::yield();
+      transferLoop(app_context, endpoints, false);
+    });
+  for (auto& endpoints : client_endpoints)
+    threads.emplace_back([&app_context, &start, &endpoints]() {
+      while (!start)
+        std::this_thread::yield();
+      transferLoop(app_context, endpoints, true);
+    });
+
+  auto transfer_begin = std::chrono::high_resolution_clock::now();
+  start               = true;
+  for (auto& t : threads)
+    t.join();
+  auto transfer_end = std::chrono::high_resolution_clock::now();
+
+  clients.clear();
+  server_endpoints.clear();
+  server_context.endpoints.clear();
+  listener = nullptr;
+  server_context.worker_pool->shutdown();
+
+  return {
+    std::chrono::duration_cast<std::chrono::nanoseconds>(connect_end - connect_begin).count(),
+    std::chrono::duration_cast<std::chrono::nanoseconds>(transfer_end - transfer_begin).count()};
+}
+
+int main(int argc, char** argv)
+{
+  app_context_t app_context;
+  if (!parseCommand(&app_context, argc, argv)) return -1;
+
+  auto context = ucxx::createContext({}, ucxx::Context::defaultFeatureFlags);
+
+  // Clients are spread over as many workers as the largest server, so that they are not
+  // the bottleneck.
+  auto clientPool = context->createWorkerPool(app_context.max_workers);
+  clientPool->startProgressThreads(app_context.polling_mode);
+
+  std::cout << std::setw(10) << "workers" << std::setw(20) << "connections/s" << std::setw(20)
+            << "messages/s" << std::endl;
+
+  for (size_t numWorkers = 1; numWorkers <= app_context.max_workers; numWorkers *= 2) {
+    auto durations = runFanIn(app_context, context, clientPool, numWorkers);
+
+    double connection_rate = app_context.n_clients / (durations.first / 1e9);
+    double message_rate =
+      app_context.n_clients * app_context.n_messages / (durations.second / 1e9);
+    std::cout << std::setw(10) << numWorkers << std::setw(20) << std::fixed
+              << std::setprecision(0) << connection_rate << std::setw(20) << message_rate
+              << std::endl;
+  }
+
+  clientPool->shutdown();
+
+  return 0;
+}
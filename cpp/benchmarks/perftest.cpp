@@ -4,9 +4,11 @@
  */
 #include <unistd.h>  // for getopt, optarg
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <numeric>
@@ -25,6 +27,7 @@ enum class ProgressMode {
   Wait,
   ThreadPolling,
   ThreadBlocking,
+  ThreadAdaptive,
 };
 
 enum transfer_type_t { SEND, RECV };
@@ -42,10 +45,36 @@ struct app_context_t {
   size_t message_size        = 8;
   size_t n_iter              = 100;
   size_t warmup_iter         = 3;
+  size_t batch_size          = 1;
+  bool batch_api             = false;
+  bool delayed_submission    = false;
   bool reuse_alloc           = false;
   bool verify_results        = false;
+  bool active_message        = false;
 };
 
+// Active Messages received by the handler, copied to the receive buffer in arrival order
+struct AmContext {
+  std::atomic<size_t> received{0};  // Total number of messages received
+  size_t expected{0};               // Total number of messages expected by the application
+  std::vector<char> recvBuffer{};   // Buffer holding the data of the last batch received
+  size_t messageSize{0};            // Size of each message
+  size_t batchSize{0};              // Number of messages per batch
+};
+
+typedef std::shared_ptr<AmContext> AmContextPtr;
+
+static void amHandler(const ucxx::AmMessage& message, void* arg)
+{
+  // Handlers are called by the thread progressing the worker, one at a time
+  auto amContext = reinterpret_cast<AmContext*>(arg);
+  auto slot      = amContext->received % amContext->batchSize;
+  std::memcpy(amContext->recvBuffer.data() + slot * amContext->messageSize,
+              message.data,
+              std::min(message.length, amContext->messageSize));
+  ++amContext->received;
+}
+
 class ListenerContext {
  private:
   std::shared_ptr<ucxx::Worker> _worker{nullptr};
@@ -117,12 +146,19 @@ static void printUsage()
   std::cerr << "Parameters are:" << std::endl;
   std::cerr << "  -m          progress mode to use, valid values are: 'polling', 'blocking',"
             << std::endl;
-  std::cerr << "              'thread-polling' and 'thread-blocking' (default: 'blocking')"
+  std::cerr << "              'thread-polling', 'thread-blocking' and 'thread-adaptive'"
             << std::endl;
+  std::cerr << "              (default: 'blocking')" << std::endl;
   std::cerr << "  -t          use thread progress mode (disabled)" << std::endl;
   std::cerr << "  -p <port>   port number to listen at (12345)" << std::endl;
   std::cerr << "  -s <bytes>  message size (8)" << std::endl;
   std::cerr << "  -n <int>    number of iterations to run (100)" << std::endl;
+  std::cerr << "  -b <int>    number of messages per direction in each iteration (1)" << std::endl;
+  std::cerr << "  -B          submit messages of each iteration with the batch API (disabled)"
+            << std::endl;
+  std::cerr << "  -A          transfer with Active Messages instead of tag messages (disabled)"
+            << std::endl;
+  std::cerr << "  -d          enable delayed submission (disabled)" << std::endl;
   std::cerr << "  -r          reuse memory allocation (disabled)" << std::endl;
   std::cerr << "  -v          verify results (disabled)" << std::endl;
   std::cerr << "  -w <int>    number of warmup iterations to run (3)" << std::endl;
@@ -134,7 +170,7 @@ ucs_status_t parseCommand(app_context_t* app_context, int argc, char* const argv
 {
   optind = 1;
   int c;
-  while ((c = getopt(argc, argv, "m:p:s:w:n:rvh")) != -1) {
+  while ((c = getopt(argc, argv, "m:p:s:w:n:b:BdrvhA")) != -1) {
     switch (c) {
       case 'm':
         if (strcmp(optarg, "blocking") == 0) {
@@ -149,6 +185,9 @@ ucs_status_t parseCommand(app_context_t* app_context, int argc, char* const argv
         } else if (strcmp(optarg, "thread-polling") == 0) {
           app_context->progress_mode = ProgressMode::ThreadPolling;
           break;
+        } else if (strcmp(optarg, "thread-adaptive") == 0) {
+          app_context->progress_mode = ProgressMode::ThreadAdaptive;
+          break;
         } else if (strcmp(optarg, "wait") == 0) {
           app_context->progress_mode = ProgressMode::Wait;
           break;
@@ -185,6 +224,16 @@ ucs_status_t parseCommand(app_context_t* app_context, int argc, char* const argv
           return UCS_ERR_INVALID_PARAM;
         }
         break;
+      case 'b':
+        app_context->batch_size = atoi(optarg);
+        if (app_context->batch_size <= 0) {
+          std::cerr << "Wrong batch size: " << app_context->batch_size << std::endl;
+          return UCS_ERR_INVALID_PARAM;
+        }
+        break;
+      case 'B': app_context->batch_api = true; break;
+      case 'A': app_context->active_message = true; break;
+      case 'd': app_context->delayed_submission = true; break;
       case 'r': app_context->reuse_alloc = true; break;
       case 'v': app_context->verify_results = true; break;
       case 'h':
@@ -248,34 +297,80 @@ std::string parseBandwidth(size_t totalBytes, size_t countNs)
     return std::to_string(bw / (1024 * 1024 * 1024)) + std::string("GB/s");
 }
 
-BufferMapPtr allocateTransferBuffers(size_t message_size)
+std::string parseMessageRate(size_t totalMessages, size_t countNs)
 {
-  return std::make_shared<BufferMap>(BufferMap{{SEND, std::vector<char>(message_size, 0xaa)},
-                                               {RECV, std::vector<char>(message_size)}});
+  double rate = totalMessages / (countNs / 1e9);
+
+  if (rate < 1e3)
+    return std::to_string(rate) + std::string("msg/s");
+  else if (rate < 1e6)
+    return std::to_string(rate / 1e3) + std::string("Kmsg/s");
+  else
+    return std::to_string(rate / 1e6) + std::string("Mmsg/s");
+}
+
+BufferMapPtr allocateTransferBuffers(size_t message_size, size_t batch_size)
+{
+  return std::make_shared<BufferMap>(
+    BufferMap{{SEND, std::vector<char>(message_size * batch_size, 0xaa)},
+              {RECV, std::vector<char>(message_size * batch_size)}});
 }
 
 auto doTransfer(const app_context_t& app_context,
                 std::shared_ptr<ucxx::Worker> worker,
                 std::shared_ptr<ucxx::Endpoint> endpoint,
                 TagMapPtr tagMap,
-                BufferMapPtr bufferMapReuse)
+                BufferMapPtr bufferMapReuse,
+                AmContextPtr amContext)
 {
   BufferMapPtr localBufferMap;
-  if (!app_context.reuse_alloc) localBufferMap = allocateTransferBuffers(app_context.message_size);
+  if (!app_context.reuse_alloc)
+    localBufferMap = allocateTransferBuffers(app_context.message_size, app_context.batch_size);
   BufferMapPtr bufferMap = app_context.reuse_alloc ? bufferMapReuse : localBufferMap;
 
-  auto start                                           = std::chrono::high_resolution_clock::now();
-  std::vector<std::shared_ptr<ucxx::Request>> requests = {
-    endpoint->tagSend((*bufferMap)[SEND].data(), app_context.message_size, (*tagMap)[SEND]),
-    endpoint->tagRecv((*bufferMap)[RECV].data(), app_context.message_size, (*tagMap)[RECV])};
+  // Messages of the same direction share the same tag and are thus matched in order
+  std::vector<void*> sendBuffers(app_context.batch_size), recvBuffers(app_context.batch_size);
+  std::vector<size_t> lengths(app_context.batch_size, app_context.message_size);
+  std::vector<ucp_tag_t> sendTags(app_context.batch_size, (*tagMap)[SEND]);
+  std::vector<ucp_tag_t> recvTags(app_context.batch_size, (*tagMap)[RECV]);
+  for (size_t i = 0; i < app_context.batch_size; ++i) {
+    sendBuffers[i] = (*bufferMap)[SEND].data() + i * app_context.message_size;
+    recvBuffers[i] = (*bufferMap)[RECV].data() + i * app_context.message_size;
+  }
+
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.reserve(app_context.batch_size * 2);
+
+  auto start = std::chrono::high_resolution_clock::now();
+  if (app_context.active_message) {
+    // Receives are implicit, each message is handled as it arrives
+    for (size_t i = 0; i < app_context.batch_size; ++i)
+      requests.push_back(endpoint->amSend(0, std::string(), sendBuffers[i], lengths[i]));
+    amContext->expected += app_context.batch_size;
+  } else if (app_context.batch_api) {
+    requests = endpoint->tagSendBatch(sendBuffers, lengths, sendTags);
+    auto recvRequests = endpoint->tagRecvBatch(recvBuffers, lengths, recvTags);
+    requests.insert(requests.end(), recvRequests.begin(), recvRequests.end());
+  } else {
+    for (size_t i = 0; i < app_context.batch_size; ++i)
+      requests.push_back(endpoint->tagSend(sendBuffers[i], lengths[i], sendTags[i]));
+    for (size_t i = 0; i < app_context.batch_size; ++i)
+      requests.push_back(endpoint->tagRecv(recvBuffers[i], lengths[i], recvTags[i]));
+  }
 
   // Wait for requests and clear requests
   waitRequests(app_context.progress_mode, worker, requests);
+  if (app_context.active_message) {
+    auto progress = getProgressFunction(worker, app_context.progress_mode);
+    while (amContext->received < amContext->expected)
+      progress();
+  }
   auto stop = std::chrono::high_resolution_clock::now();
 
   if (app_context.verify_results) {
+    auto& recvBuffer = app_context.active_message ? amContext->recvBuffer : (*bufferMap)[RECV];
     for (size_t j = 0; j < (*bufferMap)[SEND].size(); ++j)
-      assert((*bufferMap)[RECV][j] == (*bufferMap)[RECV][j]);
+      assert(recvBuffer[j] == (*bufferMap)[SEND][j]);
   }
 
   return std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
@@ -288,7 +383,7 @@ int main(int argc, char** argv)
 
   // Setup: create UCP context, worker, listener and client endpoint.
   auto context = ucxx::createContext({}, ucxx::Context::defaultFeatureFlags);
-  auto worker  = context->createWorker();
+  auto worker  = context->createWorker(app_context.delayed_submission);
 
   bool is_server = app_context.server_addr == NULL;
   auto tagMap    = std::make_shared<TagMap>(TagMap{
@@ -312,6 +407,8 @@ int main(int argc, char** argv)
     worker->startProgressThread(false);
   else if (app_context.progress_mode == ProgressMode::ThreadPolling)
     worker->startProgressThread(true);
+  else if (app_context.progress_mode == ProgressMode::ThreadAdaptive)
+    worker->startAdaptiveProgressThread();
 
   auto progress = getProgressFunction(worker, app_context.progress_mode);
 
@@ -325,6 +422,15 @@ int main(int argc, char** argv)
     endpoint =
       worker->createEndpointFromHostname(app_context.server_addr, app_context.listener_port, true);
 
+  // Register the handler before wireup, so that it is in place once the peer starts sending
+  auto amContext = std::make_shared<AmContext>();
+  if (app_context.active_message) {
+    amContext->recvBuffer.resize(app_context.message_size * app_context.batch_size);
+    amContext->messageSize = app_context.message_size;
+    amContext->batchSize   = app_context.batch_size;
+    worker->registerAmHandler(0, amHandler, amContext.get());
+  }
+
   std::vector<std::shared_ptr<ucxx::Request>> requests;
 
   // Allocate wireup buffers
@@ -348,36 +454,46 @@ int main(int argc, char** argv)
     assert((*wireupBufferMap)[RECV][i] == (*wireupBufferMap)[SEND][i]);
 
   BufferMapPtr bufferMapReuse;
-  if (app_context.reuse_alloc) bufferMapReuse = allocateTransferBuffers(app_context.message_size);
+  if (app_context.reuse_alloc)
+    bufferMapReuse = allocateTransferBuffers(app_context.message_size, app_context.batch_size);
 
   // Warmup
   for (size_t n = 0; n < app_context.warmup_iter; ++n)
-    doTransfer(app_context, worker, endpoint, tagMap, bufferMapReuse);
+    doTransfer(app_context, worker, endpoint, tagMap, bufferMapReuse, amContext);
 
   // Schedule send and recv messages on different tags and different ordering
+  const size_t messages    = app_context.batch_size * 2;
   size_t total_duration_ns = 0;
   for (size_t n = 0; n < app_context.n_iter; ++n) {
-    auto duration_ns = doTransfer(app_context, worker, endpoint, tagMap, bufferMapReuse);
+    auto duration_ns =
+      doTransfer(app_context, worker, endpoint, tagMap, bufferMapReuse, amContext);
     total_duration_ns += duration_ns;
-    auto elapsed   = parseTime(duration_ns);
-    auto bandwidth = parseBandwidth(app_context.message_size * 2, duration_ns);
+    auto elapsed      = parseTime(duration_ns);
+    auto bandwidth    = parseBandwidth(app_context.message_size * messages, duration_ns);
+    auto message_rate = parseMessageRate(messages, duration_ns);
 
     if (!is_server)
-      std::cout << "Elapsed, bandwidth: " << elapsed << ", " << bandwidth << std::endl;
+      std::cout << "Elapsed, bandwidth, message rate: " << elapsed << ", " << bandwidth << ", "
+                << message_rate << std::endl;
   }
 
   auto total_elapsed = parseTime(total_duration_ns);
   auto total_bandwidth =
-    parseBandwidth(app_context.n_iter * app_context.message_size * 2, total_duration_ns);
+    parseBandwidth(app_context.n_iter * app_context.message_size * messages, total_duration_ns);
+  auto total_message_rate = parseMessageRate(app_context.n_iter * messages, total_duration_ns);
 
   if (!is_server)
-    std::cout << "Total elapsed, bandwidth: " << total_elapsed << ", " << total_bandwidth
-              << std::endl;
+    std::cout << "Total elapsed, bandwidth, message rate: " << total_elapsed << ", "
+              << total_bandwidth << ", " << total_message_rate << std::endl;
 
   // Stop progress thread
   if (app_context.progress_mode == ProgressMode::ThreadBlocking ||
-      app_context.progress_mode == ProgressMode::ThreadPolling)
+      app_context.progress_mode == ProgressMode::ThreadPolling ||
+      app_context.progress_mode == ProgressMode::ThreadAdaptive)
     worker->stopProgressThread();
 
+  // The handler must not be called once its argument is destroyed
+  if (app_context.active_message) worker->registerAmHandler(0, nullptr);
+
   return 0;
 }
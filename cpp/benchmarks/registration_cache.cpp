@@ -0,0 +1,118 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <unistd.h>  // for getopt, optarg
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <ucxx/api.h>
+
+struct app_context_t {
+  size_t size      = 1 << 20;
+  size_t n_buffers = 16;
+  size_t n_iter    = 1000;
+};
+
+static void printUsage()
+{
+  std::cerr << " memory registration cache benchmark" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Usage: ucxx_registration_cache [options]" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Parameters are:" << std::endl;
+  std::cerr << "  -s <int>    size of each buffer in bytes (1048576)" << std::endl;
+  std::cerr << "  -b <int>    number of buffers looked up in turn (16)" << std::endl;
+  std::cerr << "  -n <int>    number of lookups of each buffer (1000)" << std::endl;
+  std::cerr << "  -h          print this help" << std::endl;
+  std::cerr << std::endl;
+}
+
+bool parseCommand(app_context_t* app_context, int argc, char* const argv[])
+{
+  optind = 1;
+  int c;
+  while ((c = getopt(argc, argv, "s:b:n:h")) != -1) {
+    switch (c) {
+      case 's':
+        app_context->size = atoi(optarg);
+        if (app_context->size <= 0) {
+          std::cerr << "Wrong buffer size: " << app_context->size << std::endl;
+          return false;
+        }
+        break;
+      case 'b':
+        app_context->n_buffers = atoi(optarg);
+        if (app_context->n_buffers <= 0) {
+          std::cerr << "Wrong number of buffers: " << app_context->n_buffers << std::endl;
+          return false;
+        }
+        break;
+      case 'n':
+        app_context->n_iter = atoi(optarg);
+        if (app_context->n_iter <= 0) {
+          std::cerr << "Wrong number of iterations: " << app_context->n_iter << std::endl;
+          return false;
+        }
+        break;
+      case 'h':
+      default: printUsage(); return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Run `n_iter` rounds over all buffers, calling `op` with each buffer. Returns the average
+ * number of nanoseconds per call.
+ */
+template <typename Op>
+double timePerOp(const app_context_t& app_context, std::vector<std::vector<char>>& buffers, Op op)
+{
+  auto begin = std::chrono::high_resolution_clock::now();
+  for (size_t n = 0; n < app_context.n_iter; ++n)
+    for (auto& buffer : buffers)
+      op(buffer);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+  return static_cast<double>(elapsed) / (app_context.n_iter * buffers.size());
+}
+
+int main(int argc, char** argv)
+{
+  app_context_t app_context;
+  if (!parseCommand(&app_context, argc, argv)) return -1;
+
+  auto context = ucxx::createContext({}, ucxx::Context::defaultFeatureFlags);
+  std::vector<std::vector<char>> buffers(app_context.n_buffers,
+                                         std::vector<char>(app_context.size));
+
+  // Register and unregister every buffer each time it is used
+  double registerNs = timePerOp(app_context, buffers, [&](std::vector<char>& buffer) {
+    context->createMemoryHandle(buffer.size(), buffer.data());
+  });
+
+  // Look every buffer up in a cache large enough to hold all registrations
+  auto cache = context->createRegistrationCache(2 * app_context.n_buffers * app_context.size);
+  double lookupNs = timePerOp(app_context, buffers, [&](std::vector<char>& buffer) {
+    cache->get(buffer.data(), buffer.size());
+  });
+
+  std::cout << std::setw(20) << "operation" << std::setw(20) << "ns/op" << std::endl;
+  std::cout << std::setw(20) << "register" << std::setw(20) << std::fixed << std::setprecision(1)
+            << registerNs << std::endl;
+  std::cout << std::setw(20) << "cache lookup" << std::setw(20) << std::fixed
+            << std::setprecision(1) << lookupNs << std::endl;
+  std::cout << std::endl;
+  std::cout << "hits: " << cache->getHits() << ", misses: " << cache->getMisses()
+            << ", evictions: " << cache->getEvictions() << std::endl;
+
+  return 0;
+}
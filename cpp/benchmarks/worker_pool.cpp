@@ -0,0 +1,180 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <unistd.h>  // for getopt, optarg
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <ucxx/api.h>
+
+struct app_context_t {
+  size_t max_workers  = std::thread::hardware_concurrency() / 2;
+  size_t message_size = 8;
+  size_t n_messages   = 100000;
+  size_t window_size  = 64;
+  bool polling_mode   = false;
+};
+
+static void printUsage()
+{
+  std::cerr << " worker pool scaling benchmark" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Usage: ucxx_worker_pool [options]" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Parameters are:" << std::endl;
+  std::cerr << "  -w <int>    maximum number of workers, doubled at each step from 1" << std::endl;
+  std::cerr << "              (half the number of hardware threads)" << std::endl;
+  std::cerr << "  -s <bytes>  message size (8)" << std::endl;
+  std::cerr << "  -n <int>    number of messages per worker (100000)" << std::endl;
+  std::cerr << "  -W <int>    number of messages in flight per worker (64)" << std::endl;
+  std::cerr << "  -P          use polling progress mode (disabled)" << std::endl;
+  std::cerr << "  -h          print this help" << std::endl;
+  std::cerr << std::endl;
+}
+
+bool parseCommand(app_context_t* app_context, int argc, char* const argv[])
+{
+  optind = 1;
+  int c;
+  while ((c = getopt(argc, argv, "w:s:n:W:Ph")) != -1) {
+    switch (c) {
+      case 'w':
+        app_context->max_workers = atoi(optarg);
+        if (app_context->max_workers <= 0) {
+          std::cerr << "Wrong number of workers: " << app_context->max_workers << std::endl;
+          return false;
+        }
+        break;
+      case 's':
+        app_context->message_size = atoi(optarg);
+        if (app_context->message_size <= 0) {
+          std::cerr << "Wrong message size: " << app_context->message_size << std::endl;
+          return false;
+        }
+        break;
+      case 'n':
+        app_context->n_messages = atoi(optarg);
+        if (app_context->n_messages <= 0) {
+          std::cerr << "Wrong number of messages: " << app_context->n_messages << std::endl;
+          return false;
+        }
+        break;
+      case 'W':
+        app_context->window_size = atoi(optarg);
+        if (app_context->window_size <= 0) {
+          std::cerr << "Wrong window size: " << app_context->window_size << std::endl;
+          return false;
+        }
+        break;
+      case 'P': app_context->polling_mode = true; break;
+      case 'h':
+      default: printUsage(); return false;
+    }
+  }
+
+  if (app_context->max_workers == 0) app_context->max_workers = 1;
+
+  return true;
+}
+
+/**
+ * Transfer `n_messages` messages over a loopback endpoint, keeping up to `window_size`
+ * send/receive pairs in flight, relying on the worker's progress thread for completion.
+ */
+void transferLoop(const app_context_t& app_context, std::shared_ptr<ucxx::Endpoint> endpoint)
+{
+  std::vector<char> send(app_context.message_size * app_context.window_size, 0xaa);
+  std::vector<char> recv(app_context.message_size * app_context.window_size);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.reserve(app_context.window_size * 2);
+
+  for (size_t sent = 0; sent < app_context.n_messages; sent += app_context.window_size) {
+    size_t count = std::min(app_context.window_size, app_context.n_messages - sent);
+    for (size_t i = 0; i < count; ++i) {
+      auto offset = i * app_context.message_size;
+      requests.push_back(endpoint->tagRecv(recv.data() + offset, app_context.message_size, i));
+      requests.push_back(endpoint->tagSend(send.data() + offset, app_context.message_size, i));
+    }
+    for (auto& r : requests) {
+      while (!r->isCompleted())
+        std::this_thread::yield();
+      r->checkError();
+    }
+    requests.clear();
+  }
+}
+
+/**
+ * Run one application thread per worker in the pool, each transferring over a loopback
+ * endpoint created on its worker. Returns the number of nanoseconds elapsed until all
+ * threads completed.
+ */
+size_t runWorkerPool(const app_context_t& app_context,
+                     std::shared_ptr<ucxx::Context> context,
+                     size_t numWorkers)
+{
+  auto workerPool = context->createWorkerPool(numWorkers);
+  workerPool->startProgressThreads(app_context.polling_mode);
+
+  std::vector<std::shared_ptr<ucxx::Endpoint>> endpoints;
+  for (auto& worker : workerPool->getWorkers())
+    endpoints.push_back(worker->createEndpointFromWorkerAddress(worker->getAddress()));
+
+  // Wireup
+  for (auto& endpoint : endpoints) {
+    app_context_t wireup_context = app_context;
+    wireup_context.n_messages    = 1;
+    transferLoop(wireup_context, endpoint);
+  }
+
+  std::atomic<bool> start{false};
+  std::vector<std::thread> threads;
+  for (auto& endpoint : endpoints) {
+    threads.emplace_back([&app_context, &start, endpoint]() {
+      while (!start)
+        std::this_thread::yield();
+      transferLoop(app_context, endpoint);
+    });
+  }
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  start      = true;
+  for (auto& t : threads)
+    t.join();
+  auto end = std::chrono::high_resolution_clock::now();
+
+  endpoints.clear();
+  workerPool->shutdown();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+}
+
+int main(int argc, char** argv)
+{
+  app_context_t app_context;
+  if (!parseCommand(&app_context, argc, argv)) return -1;
+
+  auto context = ucxx::createContext({}, ucxx::Context::defaultFeatureFlags);
+
+  std::cout << std::setw(10) << "workers" << std::setw(20) << "messages/s" << std::endl;
+
+  for (size_t numWorkers = 1; numWorkers <= app_context.max_workers; numWorkers *= 2) {
+    auto duration_ns = runWorkerPool(app_context, context, numWorkers);
+
+    // Each message is counted once, regardless of being sent and received by the same worker
+    double rate = numWorkers * app_context.n_messages / (duration_ns / 1e9);
+    std::cout << std::setw(10) << numWorkers << std::setw(20) << std::fixed
+              << std::setprecision(0) << rate << std::endl;
+  }
+
+  return 0;
+}
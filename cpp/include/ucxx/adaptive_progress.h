@@ -0,0 +1,124 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+namespace ucxx {
+
+/**
+ * @brief Configuration of the adaptive spin-then-block progress mode.
+ *
+ * Controls how long the progress thread spins calling the polling progress function
+ * before arming the worker and blocking, see `ucxx::AdaptiveProgress` for details.
+ */
+struct AdaptiveProgressConfig {
+  std::chrono::nanoseconds minSpinDuration{
+    std::chrono::microseconds(1)};  ///< Lower bound of the spin budget
+  std::chrono::nanoseconds maxSpinDuration{
+    std::chrono::microseconds(100)};  ///< Upper bound of the spin budget
+  size_t maxSpinIterations{0};  ///< Maximum spin iterations before blocking, `0` for unlimited
+  size_t maxBackoffPauses{64};  ///< Maximum number of CPU pauses between spin iterations
+  double interArrivalMultiplier{
+    2.0};  ///< Spin budget as a multiple of the average completion inter-arrival time
+  double smoothingFactor{
+    0.125};  ///< Weight of the latest sample in the average completion inter-arrival time
+};
+
+/**
+ * @brief Adaptive spin-then-block progress.
+ *
+ * Progresses a worker by spinning on a polling progress function for a time budget,
+ * backing off exponentially with CPU pause instructions between consecutive unproductive
+ * iterations, and once the budget is exhausted calls a blocking progress function that
+ * is expected to arm the worker and block until a new event arrives.
+ *
+ * The spin budget adapts to the observed inter-arrival time of worker activity: when
+ * activity arrives frequently enough to be caught within `maxSpinDuration`, the budget is
+ * set to `interArrivalMultiplier` times the average inter-arrival time, otherwise spinning
+ * is unlikely to pay off and the budget drops to `minSpinDuration`. This provides
+ * latencies close to those of polling mode under load, without keeping a CPU core busy
+ * while idle.
+ */
+class AdaptiveProgress {
+ private:
+  typedef std::chrono::steady_clock Clock;
+
+  AdaptiveProgressConfig _config{};  ///< The adaptive progress configuration
+  std::function<bool(void)> _progressFunction{nullptr};  ///< The polling progress function
+  std::function<bool(void)> _blockingProgressFunction{
+    nullptr};  ///< The blocking progress function
+  std::chrono::nanoseconds _spinBudget{0};  ///< The current spin budget
+  double _interArrivalNs{0.0};        ///< The moving average of activity inter-arrival time
+  Clock::time_point _lastActivity{};  ///< Time of the last activity
+  Clock::time_point _spinStart{};     ///< Time the current spin window started
+  bool _spinning{false};              ///< Whether a spin window is in progress
+  size_t _spinIterations{0};          ///< Number of iterations of the current spin window
+  size_t _backoffPauses{1};           ///< Number of CPU pauses for the next backoff
+
+  /**
+   * @brief Record activity and update the spin budget.
+   *
+   * Update the moving average of the activity inter-arrival time and recompute the spin
+   * budget accordingly.
+   *
+   * @param[in] now the time at which activity was observed.
+   */
+  void recordActivity(Clock::time_point now);
+
+ public:
+  AdaptiveProgress() = delete;
+
+  /**
+   * @brief Constructor of `ucxx::AdaptiveProgress`.
+   *
+   * Construct an adaptive progress object, the spin budget starts at `maxSpinDuration`
+   * and adapts as activity is observed.
+   *
+   * @param[in] config                    the adaptive progress configuration.
+   * @param[in] progressFunction          the polling progress function, returning `true`
+   *                                      if any activity was progressed.
+   * @param[in] blockingProgressFunction  the blocking progress function, called when the
+   *                                      spin budget is exhausted.
+   */
+  AdaptiveProgress(const AdaptiveProgressConfig& config,
+                   std::function<bool(void)> progressFunction,
+                   std::function<bool(void)> blockingProgressFunction);
+
+  AdaptiveProgress(const AdaptiveProgress&) = delete;
+  AdaptiveProgress& operator=(AdaptiveProgress const&) = delete;
+  AdaptiveProgress(AdaptiveProgress&& o)               = delete;
+  AdaptiveProgress& operator=(AdaptiveProgress&& o) = delete;
+
+  /**
+   * @brief Run one iteration of adaptive progress.
+   *
+   * Call the polling progress function once, if no activity was progressed back off
+   * spinning, or call the blocking progress function if the spin budget is exhausted.
+   * Returns after each iteration so the caller may process other work, such as delayed
+   * submissions, between iterations.
+   *
+   * @returns `true` if any activity was progressed, `false` otherwise.
+   */
+  bool progress();
+
+  /**
+   * @brief Get the current spin budget.
+   *
+   * @returns The time the progress function will spin before blocking.
+   */
+  std::chrono::nanoseconds getSpinBudget() const;
+
+  /**
+   * @brief Get the average activity inter-arrival time.
+   *
+   * @returns The moving average of the time between consecutive activity, `0` if not
+   *          enough activity has been observed yet.
+   */
+  std::chrono::nanoseconds getInterArrivalTime() const;
+};
+
+}  // namespace ucxx
@@ -10,13 +10,30 @@
 
 #include <ucxx/address.h>
 #include <ucxx/buffer.h>
+#include <ucxx/completion_queue.h>
 #include <ucxx/constructors.h>
 #include <ucxx/context.h>
+#include <ucxx/coroutine.h>
 #include <ucxx/endpoint.h>
+#include <ucxx/endpoint_pool.h>
 #include <ucxx/header.h>
+#include <ucxx/hostname_resolver.h>
 #include <ucxx/inflight_requests.h>
 #include <ucxx/listener.h>
+#include <ucxx/memory_handle.h>
+#include <ucxx/native_future.h>
+#include <ucxx/registration_cache.h>
+#include <ucxx/remote_key.h>
 #include <ucxx/request.h>
+#include <ucxx/request_am.h>
+#include <ucxx/request_atomic.h>
+#include <ucxx/request_endpoint_close.h>
+#include <ucxx/request_endpoint_create.h>
+#include <ucxx/request_flush.h>
+#include <ucxx/request_mem.h>
+#include <ucxx/request_tag.h>
+#include <ucxx/request_tag_any_size.h>
 #include <ucxx/request_tag_multi.h>
 #include <ucxx/typedefs.h>
 #include <ucxx/worker.h>
+#include <ucxx/worker_pool.h>
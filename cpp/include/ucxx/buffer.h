@@ -99,14 +99,23 @@ class HostBuffer : public Buffer {
    * Constructor to materialize a buffer holding host memory. The internal buffer
    * is allocated using `malloc`, and thus should be freed with `free`.
    *
-   * @param[in] size the size of the host buffer to allocate.
+   * If a NUMA node is specified, whole pages within the buffer are bound to that node
+   * before they are first touched, this is a best-effort operation and the buffer is
+   * still valid if binding fails.
+   *
+   * @param[in] size      the size of the host buffer to allocate.
+   * @param[in] numaNode  the NUMA node to place the buffer on, or `-1` for the default
+   *                      placement policy.
    *
    * @code{.cpp}
    * // Allocate host buffer of 1KiB
    * auto buffer = HostBuffer(1024);
+   *
+   * // Allocate host buffer of 1MiB on NUMA node 0
+   * auto numaBuffer = HostBuffer(1048576, 0);
    * @endcode
    */
-  explicit HostBuffer(const size_t size);
+  explicit HostBuffer(const size_t size, const int numaNode = -1);
 
   /**
    * @brief Destructor of concrete type `HostBuffer`.
@@ -245,6 +254,22 @@ class RMMBuffer : public Buffer {
 };
 #endif
 
-Buffer* allocateBuffer(BufferType bufferType, const size_t size);
+/**
+ * @brief Allocate a buffer of the specified type.
+ *
+ * Allocate a buffer of the specified type and size. The NUMA node is only used for host
+ * buffers, see `HostBuffer` for details.
+ *
+ * @param[in] bufferType  the type of buffer to allocate.
+ * @param[in] size        the size of the buffer to allocate.
+ * @param[in] numaNode    the NUMA node to place host buffers on, or `-1` for the default
+ *                        placement policy.
+ *
+ * @throws std::runtime_error if `bufferType` is `BufferType::RMM` and RMM support is not
+ *                            enabled.
+ *
+ * @returns a pointer to the allocated buffer, owned by the caller.
+ */
+Buffer* allocateBuffer(BufferType bufferType, const size_t size, const int numaNode = -1);
 
 }  // namespace ucxx
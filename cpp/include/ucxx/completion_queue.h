@@ -0,0 +1,101 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/mpsc_ring.h>
+
+namespace ucxx {
+
+/**
+ * @brief A record of a completed request.
+ *
+ * A compact record pushed to the completion queue of a worker when a request completes.
+ */
+struct Completion {
+  std::shared_ptr<void> context{nullptr};  ///< User context, the request's `callbackData`
+  ucs_status_t status{UCS_INPROGRESS};  ///< Completion status of the request
+  size_t length{0};                     ///< Length in bytes transferred, `0` upon failure
+};
+
+class CompletionQueue {
+ private:
+  MpscRing<Completion> _ring;  ///< The ring storing the completions
+
+ public:
+  static constexpr size_t defaultCapacity = 4096;  ///< Default number of slots in the ring
+
+  /**
+   * @brief Constructor of a completion queue.
+   *
+   * Construct an empty completion queue. The queue is a bounded lock-free
+   * multi-producer/single-consumer ring, thus pushing a completion from the thread
+   * progressing the worker does not require a lock nor heap allocations. If the ring is
+   * full, completions are pushed to an unbounded overflow collection that is protected by
+   * a mutex, ensuring completions are never lost.
+   *
+   * @param[in] capacity  number of slots in the ring, rounded up to the next power of 2.
+   */
+  explicit CompletionQueue(const size_t capacity = defaultCapacity);
+
+  CompletionQueue(const CompletionQueue&) = delete;
+  CompletionQueue& operator=(CompletionQueue const&) = delete;
+  CompletionQueue(CompletionQueue&& o)               = delete;
+  CompletionQueue& operator=(CompletionQueue&& o) = delete;
+
+  /**
+   * @brief Push a completion.
+   *
+   * Push the completion of a request to the queue. This method is safe to be called
+   * concurrently from multiple threads.
+   *
+   * @param[in] completion  the completion to push.
+   */
+  void push(const Completion& completion);
+
+  /**
+   * @brief Poll completions.
+   *
+   * Pop up to `maxCompletions` completions from the queue, in the order they were pushed
+   * by each producer thread, copying them to `completions`. Completions in the overflow
+   * collection are only popped once the ring has been fully drained.
+   *
+   * Only one thread may call this method at any time.
+   *
+   * @param[out] completions     array where popped completions are stored, must hold at
+   *                             least `maxCompletions` elements.
+   * @param[in]  maxCompletions  the maximum number of completions to pop.
+   *
+   * @returns The number of completions popped.
+   */
+  size_t poll(Completion* completions, const size_t maxCompletions);
+
+  /**
+   * @brief Get the capacity of the ring.
+   *
+   * Get the number of slots in the ring, beyond which completions are pushed to the
+   * overflow collection.
+   *
+   * @returns the number of slots in the ring.
+   */
+  size_t getCapacity() const;
+
+  /**
+   * @brief Check whether there are pending completions.
+   *
+   * Check whether all pushed completions have been polled. A completion claimed by a
+   * producer that has not been published yet is considered pending. Must only be called
+   * from the thread calling `poll()`.
+   *
+   * @returns `true` if there are no pending completions, `false` otherwise.
+   */
+  bool isEmpty() const;
+};
+
+}  // namespace ucxx
@@ -4,6 +4,9 @@
  */
 #pragma once
 
+#include <sys/socket.h>
+
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -15,14 +18,26 @@ namespace ucxx {
 class Address;
 class Context;
 class Endpoint;
+class EndpointPool;
 class Future;
 class Listener;
+class MemoryHandle;
 class Notifier;
+class RegistrationCache;
+class RemoteKey;
 class Request;
+class RequestAm;
+class RequestAtomic;
+class RequestEndpointClose;
+class RequestEndpointCreate;
+class RequestFlush;
+class RequestMem;
 class RequestStream;
 class RequestTag;
+class RequestTagAnySize;
 class RequestTagMulti;
 class Worker;
+class WorkerPool;
 
 // Components
 std::shared_ptr<Address> createAddressFromWorker(std::shared_ptr<ucxx::Worker> worker);
@@ -36,23 +51,131 @@ std::shared_ptr<Endpoint> createEndpointFromHostname(std::shared_ptr<Worker> wor
                                                      uint16_t port,
                                                      bool endpointErrorHandling);
 
+std::shared_ptr<Endpoint> createEndpointFromSocketAddress(std::shared_ptr<Worker> worker,
+                                                          const sockaddr_storage& address,
+                                                          socklen_t length,
+                                                          uint16_t port,
+                                                          bool endpointErrorHandling);
+
 std::shared_ptr<Endpoint> createEndpointFromConnRequest(std::shared_ptr<Listener> listener,
                                                         ucp_conn_request_h connRequest,
                                                         bool endpointErrorHandling);
 
+std::shared_ptr<Endpoint> createEndpointFromConnRequest(std::shared_ptr<Worker> worker,
+                                                        ucp_conn_request_h connRequest,
+                                                        bool endpointErrorHandling);
+
 std::shared_ptr<Endpoint> createEndpointFromWorkerAddress(std::shared_ptr<Worker> worker,
                                                           std::shared_ptr<Address> address,
                                                           bool endpointErrorHandling);
 
+std::shared_ptr<EndpointPool> createEndpointPool(std::shared_ptr<Worker> worker,
+                                                 const size_t maxSize,
+                                                 const std::chrono::milliseconds idleTimeout);
+
 std::shared_ptr<Listener> createListener(std::shared_ptr<Worker> worker,
                                          uint16_t port,
                                          ucp_listener_conn_callback_t callback,
                                          void* callback_args);
 
+std::shared_ptr<MemoryHandle> createMemoryHandle(std::shared_ptr<Context> context,
+                                                const size_t size,
+                                                void* buffer,
+                                                const ucs_memory_type_t memoryType);
+
+std::shared_ptr<RegistrationCache> createRegistrationCache(std::shared_ptr<Context> context,
+                                                          const size_t maxBytes);
+
+std::shared_ptr<RemoteKey> createRemoteKeyFromMemoryHandle(
+  std::shared_ptr<MemoryHandle> memoryHandle);
+
+std::shared_ptr<RemoteKey> createRemoteKeyFromSerialized(std::shared_ptr<Endpoint> endpoint,
+                                                         const std::string& serializedRemoteKey);
+
 std::shared_ptr<Worker> createWorker(std::shared_ptr<Context> context,
-                                     const bool enableDelayedSubmission);
+                                     const bool enableDelayedSubmission,
+                                     const bool enableFuture = false);
+
+std::shared_ptr<WorkerPool> createWorkerPool(std::shared_ptr<Context> context,
+                                             const size_t numWorkers,
+                                             const bool enableDelayedSubmission,
+                                             const WorkerPoolPlacement placement);
+
+// Futures
+std::shared_ptr<Future> createNativeFuture(std::shared_ptr<Notifier> notifier);
+
+std::shared_ptr<Notifier> createNativeNotifier();
 
 // Transfers
+std::shared_ptr<RequestAm> createRequestAmSend(
+  std::shared_ptr<Endpoint> endpoint,
+  const unsigned id,
+  const std::string& header,
+  void* buffer,
+  size_t length,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData);
+
+std::shared_ptr<RequestAm> createRequestAmRecvData(std::shared_ptr<Worker> worker,
+                                                   const unsigned id,
+                                                   std::string header,
+                                                   void* dataDescriptor,
+                                                   std::shared_ptr<Buffer> buffer,
+                                                   AmHandlerType handler,
+                                                   void* handlerArg);
+
+std::shared_ptr<RequestAtomic> createRequestAtomic(
+  std::shared_ptr<Endpoint> endpoint,
+  const ucp_atomic_op_t opcode,
+  const bool fetch,
+  const uint64_t value,
+  const uint64_t compare,
+  uint64_t* result,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData);
+
+std::shared_ptr<RequestEndpointClose> createRequestEndpointClose(
+  std::shared_ptr<Endpoint> endpoint,
+  const EndpointCloseMode mode,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData);
+
+std::shared_ptr<RequestEndpointCreate> createRequestEndpointCreate(
+  std::shared_ptr<Worker> worker,
+  std::string ipAddress,
+  uint16_t port,
+  bool endpointErrorHandling,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData);
+
+std::vector<std::shared_ptr<Request>> createRequestEndpointCloseBatch(
+  const std::vector<std::shared_ptr<Endpoint>>& endpoints,
+  const EndpointCloseMode mode,
+  const bool enablePythonFuture);
+
+std::shared_ptr<RequestFlush> createRequestFlush(
+  std::shared_ptr<Endpoint> endpoint,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData);
+
+std::shared_ptr<RequestMem> createRequestMem(
+  std::shared_ptr<Endpoint> endpoint,
+  const bool put,
+  void* buffer,
+  size_t length,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData);
+
 std::shared_ptr<RequestStream> createRequestStream(std::shared_ptr<Endpoint> endpoint,
                                                    bool send,
                                                    void* buffer,
@@ -65,9 +188,27 @@ std::shared_ptr<RequestTag> createRequestTag(
   void* buffer,
   size_t length,
   ucp_tag_t tag,
+  const TagMask tagMask,
   const bool enablePythonFuture,
   std::function<void(std::shared_ptr<void>)> callbackFunction,
-  std::shared_ptr<void> callbackData);
+  std::shared_ptr<void> callbackData,
+  const bool allowShorterMessage);
+
+std::shared_ptr<RequestTagAnySize> createRequestTagAnySize(
+  std::shared_ptr<Component> endpointOrWorker,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData,
+  BufferAllocatorType allocator);
+
+std::vector<std::shared_ptr<Request>> createRequestTagBatch(
+  std::shared_ptr<Component> endpointOrWorker,
+  bool send,
+  const std::vector<void*>& buffers,
+  const std::vector<size_t>& lengths,
+  const std::vector<ucp_tag_t>& tags,
+  const bool enablePythonFuture);
 
 std::shared_ptr<RequestTagMulti> createRequestTagMultiSend(std::shared_ptr<Endpoint> endpoint,
                                                            const std::vector<void*>& buffer,
@@ -76,8 +217,11 @@ std::shared_ptr<RequestTagMulti> createRequestTagMultiSend(std::shared_ptr<Endpo
                                                            const ucp_tag_t tag,
                                                            const bool enablePythonFuture);
 
-std::shared_ptr<RequestTagMulti> createRequestTagMultiRecv(std::shared_ptr<Endpoint> endpoint,
-                                                           const ucp_tag_t tag,
-                                                           const bool enablePythonFuture);
+std::shared_ptr<RequestTagMulti> createRequestTagMultiRecv(
+  std::shared_ptr<Endpoint> endpoint,
+  const ucp_tag_t tag,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+  std::shared_ptr<void> callbackData                          = nullptr);
 
 }  // namespace ucxx
@@ -18,6 +18,7 @@
 namespace ucxx {
 
 class Worker;
+class WorkerPool;
 
 class Context : public Component {
  private:
@@ -25,6 +26,7 @@ class Context : public Component {
   Config _config{{}};              ///< UCP context configuration variables
   uint64_t _featureFlags{0};       ///< Feature flags used to construct UCP context
   bool _cudaSupport{false};        ///< Whether CUDA support is enabled
+  size_t _requestSize{0};          ///< Size of a UCP request, as reported by UCX
 
   /**
    * @brief Private constructor of `shared_ptr<ucxx::Context>`.
@@ -135,6 +137,21 @@ class Context : public Component {
    */
   uint64_t getFeatureFlags() const;
 
+  /**
+   * @brief Get the size of a UCP request.
+   *
+   * Get the size in bytes of the space UCX requires preceding a request handle allocated
+   * by the user, as reported by `ucp_context_query()`.
+   *
+   * @code{.cpp}
+   *   // context is `std::shared_ptr<ucxx::Context>`
+   *   size_t requestSize = context->getRequestSize();
+   * @endcode
+   *
+   * @return Size in bytes of a UCP request.
+   */
+  size_t getRequestSize() const;
+
   /**
    * @brief Create a new `ucxx::Worker`.
    *
@@ -149,9 +166,98 @@ class Context : public Component {
    *
    * @param[in] enableDelayedSubmission whether the worker should delay
    *                                    transfer requests to the worker thread.
+   * @param[in] enableFuture            whether the worker should notify a
+   *                                    `ucxx::NativeFuture` for each request.
    * @return Shared pointer to the `ucxx::Worker` object.
    */
-  std::shared_ptr<Worker> createWorker(const bool enableDelayedSubmission = false);
+  std::shared_ptr<Worker> createWorker(const bool enableDelayedSubmission = false,
+                                       const bool enableFuture            = false);
+
+  /**
+   * @brief Create a new `ucxx::MemoryHandle`.
+   *
+   * Create a new `ucxx::MemoryHandle` as a child of the current `ucxx::Context`, mapping
+   * memory so that it may be accessed by remote endpoints with one-sided operations. The
+   * `ucxx::Context` will not be destroyed until all `ucxx::MemoryHandle` objects are
+   * destroyed first.
+   *
+   * @code{.cpp}
+   *   // context is `std::shared_ptr<ucxx::Context>`
+   *   auto memoryHandle = context->createMemoryHandle(1048576, nullptr);
+   * @endcode
+   *
+   * @throws ucxx::Error if the memory could not be mapped.
+   *
+   * @param[in] size        the size in bytes of the memory to map.
+   * @param[in] buffer      a raw pointer to the memory to map, or `nullptr` to let UCX
+   *                        allocate memory of `size` bytes.
+   * @param[in] memoryType  the type of the memory, only used to allocate memory if
+   *                        `buffer` is `nullptr`.
+   * @return Shared pointer to the `ucxx::MemoryHandle` object.
+   */
+  std::shared_ptr<MemoryHandle> createMemoryHandle(
+    const size_t size,
+    void* buffer                       = nullptr,
+    const ucs_memory_type_t memoryType = UCS_MEMORY_TYPE_HOST);
+
+  /**
+   * @brief Create a new `ucxx::RegistrationCache`.
+   *
+   * Create a new `ucxx::RegistrationCache` as a child of the current `ucxx::Context`,
+   * caching memory registrations so that buffers used repeatedly are only registered
+   * once. The `ucxx::Context` will not be destroyed until all `ucxx::RegistrationCache`
+   * objects are destroyed first.
+   *
+   * @code{.cpp}
+   *   // context is `std::shared_ptr<ucxx::Context>`
+   *   auto registrationCache = context->createRegistrationCache(1ull << 32);
+   * @endcode
+   *
+   * @param[in] maxBytes  maximum number of bytes kept registered, the least recently used
+   *                      registrations are evicted beyond that.
+   * @return Shared pointer to the `ucxx::RegistrationCache` object.
+   */
+  std::shared_ptr<RegistrationCache> createRegistrationCache(const size_t maxBytes);
+
+  /**
+   * @brief Create a new `ucxx::RegistrationCache` of default capacity.
+   *
+   * Create a new `ucxx::RegistrationCache` keeping up to
+   * `ucxx::RegistrationCache::defaultMaxBytes` registered, see
+   * `createRegistrationCache(const size_t)`.
+   *
+   * @code{.cpp}
+   *   // context is `std::shared_ptr<ucxx::Context>`
+   *   auto registrationCache = context->createRegistrationCache();
+   * @endcode
+   *
+   * @return Shared pointer to the `ucxx::RegistrationCache` object.
+   */
+  std::shared_ptr<RegistrationCache> createRegistrationCache();
+
+  /**
+   * @brief Create a new `ucxx::WorkerPool`.
+   *
+   * Create a new `ucxx::WorkerPool` owning `numWorkers` workers, each a child of the
+   * current `ucxx::Context`, allowing endpoints to be sharded across multiple workers
+   * and their progress threads.
+   *
+   * @code{.cpp}
+   *   // context is `std::shared_ptr<ucxx::Context>`
+   *   auto workerPool = context->createWorkerPool(4);
+   * @endcode
+   *
+   * @param[in] numWorkers              the number of workers in the pool.
+   * @param[in] enableDelayedSubmission whether the workers should delay
+   *                                    transfer requests to the worker thread.
+   * @param[in] placement               the strategy to select a worker for new
+   *                                    endpoints.
+   * @return Shared pointer to the `ucxx::WorkerPool` object.
+   */
+  std::shared_ptr<WorkerPool> createWorkerPool(
+    const size_t numWorkers,
+    const bool enableDelayedSubmission  = false,
+    const WorkerPoolPlacement placement = WorkerPoolPlacement::RoundRobin);
 };
 
 }  // namespace ucxx
@@ -0,0 +1,545 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+/**
+ * Coroutine support requires C++20, while UCXX itself is built with C++17. All definitions
+ * are thus header-only and only available when the including translation unit is compiled
+ * with coroutine support.
+ */
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/endpoint.h>
+#include <ucxx/request.h>
+#include <ucxx/request_tag_multi.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+namespace coroutine {
+
+class Scheduler;
+
+/**
+ * @brief A coroutine executed by a `ucxx::coroutine::Scheduler`.
+ *
+ * The return type of coroutines that await UCXX operations. A task does not start
+ * executing when it is created, it must either be spawned with
+ * `ucxx::coroutine::Scheduler::spawn()` or awaited by another task, in which case it runs
+ * on the scheduler of the awaiting task, which resumes once the awaited task completes
+ * and receives any exception it raised.
+ *
+ * @code{.cpp}
+ * ucxx::coroutine::Task echo(std::shared_ptr<ucxx::Endpoint> ep, ucp_tag_t tag)
+ * {
+ *   int value;
+ *   co_await ucxx::coroutine::tagRecv(ep, &value, sizeof(value), tag);
+ *   co_await ucxx::coroutine::tagSend(ep, &value, sizeof(value), tag);
+ * }
+ * @endcode
+ */
+class Task {
+ public:
+  struct FinalAwaiter;
+
+  struct promise_type {
+    Scheduler* _scheduler{nullptr};  ///< The scheduler resuming the task
+    std::coroutine_handle<> _continuation{
+      nullptr};  ///< The task awaiting this task, `nullptr` if spawned
+    std::exception_ptr _exception{nullptr};  ///< Exception raised by the task, if any
+
+    Task get_return_object()
+    {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept;
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { _exception = std::current_exception(); }
+  };
+
+  /**
+   * @brief Awaiter executed when the task completes.
+   *
+   * Resume the awaiting task, or release the resources of a spawned task informing its
+   * scheduler of the completion.
+   */
+  struct FinalAwaiter {
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept;
+    void await_resume() const noexcept {}
+  };
+
+  /**
+   * @brief Awaiter starting a task from another task.
+   *
+   * Start the awaited task on the scheduler of the awaiting task, which is resumed once
+   * the awaited task completes.
+   */
+  struct Awaiter {
+    std::coroutine_handle<promise_type> _handle{nullptr};  ///< The awaited task
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> awaiting) noexcept
+    {
+      _handle.promise()._scheduler    = awaiting.promise()._scheduler;
+      _handle.promise()._continuation = awaiting;
+      return _handle;
+    }
+    void await_resume()
+    {
+      if (_handle.promise()._exception) std::rethrow_exception(_handle.promise()._exception);
+    }
+  };
+
+ private:
+  std::coroutine_handle<promise_type> _handle{nullptr};  ///< The coroutine owned by the task
+
+  explicit Task(std::coroutine_handle<promise_type> handle) : _handle(handle) {}
+
+  friend class Scheduler;
+
+ public:
+  Task()                  = delete;
+  Task(const Task&)       = delete;
+  Task& operator=(Task const&) = delete;
+  Task(Task&& o) noexcept : _handle(std::exchange(o._handle, nullptr)) {}
+  Task& operator=(Task&& o) noexcept
+  {
+    if (this != &o) {
+      if (_handle) _handle.destroy();
+      _handle = std::exchange(o._handle, nullptr);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Destructor.
+   *
+   * Destroy the coroutine if it is still owned by the task, that is if it has not been
+   * spawned.
+   */
+  ~Task()
+  {
+    if (_handle) _handle.destroy();
+  }
+
+  /**
+   * @brief Await the task from another task.
+   *
+   * Start the task and suspend the awaiting task until it completes, rethrowing any
+   * exception it raised. A task may only be awaited once.
+   *
+   * @code{.cpp}
+   * co_await echo(ep, tag);
+   * @endcode
+   */
+  Awaiter operator co_await() && noexcept { return Awaiter{_handle}; }
+};
+
+/**
+ * @brief A single-threaded scheduler for tasks awaiting UCXX operations.
+ *
+ * Resume tasks whose awaited operations have completed, progressing the worker when no
+ * task is ready to run. This allows keeping a large number of concurrent tasks on a single
+ * thread, without polling `ucxx::Request::isCompleted()` or writing callback chains.
+ *
+ * The worker must be progressed exclusively by the scheduler, thus it must not have a
+ * progress thread running nor delayed submission enabled, and all tasks must be spawned
+ * and run from the same thread. If the worker has blocking progress mode initialized the
+ * scheduler blocks waiting for worker events with `ucxx::Worker::progressWorkerEvent()`
+ * when no task is ready to run, otherwise it keeps calling `ucxx::Worker::progress()`.
+ *
+ * @code{.cpp}
+ * // worker is `std::shared_ptr<ucxx::Worker>` and ep is `std::shared_ptr<ucxx::Endpoint>`
+ * ucxx::coroutine::Scheduler scheduler(worker);
+ * for (ucp_tag_t tag = 0; tag < 1000; ++tag)
+ *   scheduler.spawn(echo(ep, tag));
+ *
+ * // Block until all tasks complete.
+ * scheduler.run();
+ * @endcode
+ */
+class Scheduler {
+ private:
+  std::shared_ptr<Worker> _worker{nullptr};  ///< The worker progressed by the scheduler
+  std::deque<std::coroutine_handle<>> _ready{};  ///< Coroutines ready to be resumed
+  std::unordered_set<void*> _tasks{};  ///< Addresses of spawned tasks not completed yet
+  std::exception_ptr _exception{nullptr};  ///< First exception raised by a spawned task
+
+  /**
+   * @brief Release a completed spawned task.
+   *
+   * Called once a spawned task completes, storing the exception it raised, if any, to be
+   * rethrown by `run()`.
+   *
+   * @param[in] handle     the completed task.
+   * @param[in] exception  the exception raised by the task, if any.
+   */
+  void taskCompleted(std::coroutine_handle<> handle, std::exception_ptr exception)
+  {
+    _tasks.erase(handle.address());
+    if (exception && !_exception) _exception = exception;
+  }
+
+  friend struct Task::FinalAwaiter;
+
+ public:
+  Scheduler()                 = delete;
+  Scheduler(const Scheduler&) = delete;
+  Scheduler& operator=(Scheduler const&) = delete;
+  Scheduler(Scheduler&& o)               = delete;
+  Scheduler& operator=(Scheduler&& o) = delete;
+
+  /**
+   * @brief Constructor.
+   *
+   * Construct a scheduler progressing the worker when no task is ready to run.
+   *
+   * @param[in] worker  the worker whose requests are awaited by the tasks.
+   *
+   * @throws std::runtime_error if the worker has a progress thread running or delayed
+   *                            submission enabled.
+   */
+  explicit Scheduler(std::shared_ptr<Worker> worker) : _worker(worker)
+  {
+    if (_worker->isProgressThreadRunning())
+      throw std::runtime_error("Scheduler cannot be used while the progress thread is running");
+    if (_worker->isDelayedSubmissionEnabled())
+      throw std::runtime_error("Scheduler cannot be used with delayed submission enabled");
+  }
+
+  /**
+   * @brief Destructor.
+   *
+   * Destroy all spawned tasks that have not completed. Operations they are awaiting are
+   * not canceled, but will not resume them once they complete.
+   */
+  ~Scheduler()
+  {
+    for (auto& address : _tasks)
+      std::coroutine_handle<>::from_address(address).destroy();
+  }
+
+  /**
+   * @brief Spawn a task.
+   *
+   * Transfer ownership of the task to the scheduler, which starts it the next time it runs.
+   *
+   * @param[in] task  the task to spawn.
+   */
+  void spawn(Task task)
+  {
+    auto handle = std::exchange(task._handle, nullptr);
+    if (!handle) throw std::runtime_error("Cannot spawn an empty task");
+
+    handle.promise()._scheduler = this;
+    _tasks.insert(handle.address());
+    _ready.push_back(handle);
+  }
+
+  /**
+   * @brief Schedule a suspended coroutine to be resumed.
+   *
+   * Schedule a suspended coroutine to be resumed the next time the scheduler runs. This is
+   * called from completion callbacks of awaited operations and is not usually called
+   * directly.
+   *
+   * @param[in] handle  the coroutine to resume.
+   */
+  void schedule(std::coroutine_handle<> handle) { _ready.push_back(handle); }
+
+  /**
+   * @brief Resume all coroutines ready to run.
+   *
+   * Resume all coroutines that are ready to run without progressing the worker.
+   * Coroutines scheduled while doing so are only resumed by the next call.
+   *
+   * @returns `true` if any coroutine was resumed, `false` otherwise.
+   */
+  bool runOnce()
+  {
+    if (_ready.empty()) return false;
+
+    std::deque<std::coroutine_handle<>> ready;
+    std::swap(ready, _ready);
+    for (auto& handle : ready)
+      handle.resume();
+    return true;
+  }
+
+  /**
+   * @brief Run until all spawned tasks complete.
+   *
+   * Resume tasks as they become ready and progress the worker while no task is ready, until
+   * all spawned tasks have completed or one of them raises an exception.
+   *
+   * @throws std::exception the first exception raised by a spawned task, remaining tasks
+   *                        are resumed by subsequent calls.
+   */
+  void run()
+  {
+    while (!_tasks.empty()) {
+      if (!runOnce()) {
+        if (_worker->getEpollFileDescriptor() >= 0)
+          _worker->progressWorkerEvent();
+        else
+          _worker->progress();
+      }
+
+      if (_exception) std::rethrow_exception(std::exchange(_exception, nullptr));
+    }
+  }
+
+  /**
+   * @brief Get the number of spawned tasks that have not completed.
+   *
+   * @returns The number of spawned tasks that have not completed.
+   */
+  size_t getTaskCount() const { return _tasks.size(); }
+};
+
+inline Task::FinalAwaiter Task::promise_type::final_suspend() noexcept { return {}; }
+
+inline std::coroutine_handle<> Task::FinalAwaiter::await_suspend(
+  std::coroutine_handle<promise_type> handle) noexcept
+{
+  auto& promise = handle.promise();
+
+  // An awaited task is destroyed by the `Task` owned by the awaiting task once it resumes.
+  if (promise._continuation) return promise._continuation;
+
+  auto scheduler = promise._scheduler;
+  auto exception = promise._exception;
+  scheduler->taskCompleted(handle, exception);
+  handle.destroy();
+  return std::noop_coroutine();
+}
+
+namespace detail {
+
+/**
+ * @brief State shared between an awaiter and the completion callback of its request.
+ *
+ * The request holds a reference as its callback data, thus the state outlives the awaiter
+ * if the awaiting task is destroyed before the request completes.
+ */
+struct AwaiterState {
+  bool _completed{false};                   ///< Whether the request has completed
+  Scheduler* _scheduler{nullptr};           ///< The scheduler of the awaiting task
+  std::coroutine_handle<> _handle{nullptr};  ///< The suspended awaiting task
+};
+
+/**
+ * @brief Completion callback of awaited requests.
+ *
+ * Mark the request as completed and schedule the awaiting task to be resumed, if it has
+ * already suspended. The task is not resumed directly from the callback since the request
+ * status may not have been set yet.
+ *
+ * @param[in] data  the `ucxx::coroutine::detail::AwaiterState` of the awaiter.
+ */
+inline void resumeAwaiter(std::shared_ptr<void> data)
+{
+  auto state        = std::static_pointer_cast<AwaiterState>(data);
+  state->_completed = true;
+  if (state->_handle && state->_scheduler) state->_scheduler->schedule(state->_handle);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Awaiter of a UCXX request.
+ *
+ * Submit a request when awaited, suspending the awaiting task until the request
+ * completion callback is called, then returning the request after checking it for errors.
+ * If the request completes immediately the awaiting task is not suspended.
+ */
+template <typename RequestType>
+class RequestAwaiter {
+ public:
+  typedef std::function<std::shared_ptr<RequestType>(std::function<void(std::shared_ptr<void>)>,
+                                                     std::shared_ptr<void>)>
+    SubmitFunctionType;
+
+ private:
+  SubmitFunctionType _submit{nullptr};  ///< Function submitting the request with a callback
+  std::shared_ptr<detail::AwaiterState> _state{
+    std::make_shared<detail::AwaiterState>()};  ///< State shared with the completion callback
+  std::shared_ptr<RequestType> _request{nullptr};  ///< The submitted request
+
+ public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] submit  function submitting the request, registering the callback function
+   *                    and data it receives as the completion callback.
+   */
+  explicit RequestAwaiter(SubmitFunctionType submit) : _submit(std::move(submit)) {}
+
+  RequestAwaiter(const RequestAwaiter&) = delete;
+  RequestAwaiter& operator=(RequestAwaiter const&) = delete;
+  RequestAwaiter(RequestAwaiter&& o)               = default;
+  RequestAwaiter& operator=(RequestAwaiter&& o) = default;
+
+  /**
+   * @brief Destructor.
+   *
+   * Prevent the completion callback from resuming a task that has been destroyed.
+   */
+  ~RequestAwaiter()
+  {
+    if (_state) _state->_handle = nullptr;
+  }
+
+  bool await_ready() const noexcept { return false; }
+
+  bool await_suspend(std::coroutine_handle<Task::promise_type> handle)
+  {
+    _state->_scheduler = handle.promise()._scheduler;
+    _request           = _submit(detail::resumeAwaiter, _state);
+
+    if (_state->_completed) return false;
+    _state->_handle = handle;
+    return true;
+  }
+
+  std::shared_ptr<RequestType> await_resume()
+  {
+    _request->checkError();
+    return std::move(_request);
+  }
+};
+
+/**
+ * @brief Await a tag send operation.
+ *
+ * Enqueue a tag send operation and suspend the awaiting task until it completes.
+ *
+ * @code{.cpp}
+ * auto request = co_await ucxx::coroutine::tagSend(ep, buffer, length, tag);
+ * @endcode
+ *
+ * @param[in] endpoint  the endpoint to send the message to.
+ * @param[in] buffer    a raw pointer to the data to be sent.
+ * @param[in] length    the size in bytes of the tag message to be sent.
+ * @param[in] tag       the tag to match.
+ *
+ * @throws ucxx::Error  if the request completes with an error.
+ *
+ * @returns Awaiter returning the completed request.
+ */
+inline RequestAwaiter<Request> tagSend(std::shared_ptr<Endpoint> endpoint,
+                                       void* buffer,
+                                       size_t length,
+                                       ucp_tag_t tag)
+{
+  return RequestAwaiter<Request>(
+    [endpoint, buffer, length, tag](std::function<void(std::shared_ptr<void>)> callbackFunction,
+                                    std::shared_ptr<void> callbackData) {
+      return endpoint->tagSend(buffer, length, tag, false, callbackFunction, callbackData);
+    });
+}
+
+/**
+ * @brief Await a tag receive operation from an endpoint.
+ *
+ * Enqueue a tag receive operation and suspend the awaiting task until it completes.
+ *
+ * @param[in] endpoint  the endpoint to receive the message from.
+ * @param[in] buffer    a raw pointer to pre-allocated memory where resulting data will be
+ *                      stored.
+ * @param[in] length    the size in bytes of the tag message to be received.
+ * @param[in] tag       the tag to match.
+ *
+ * @throws ucxx::Error  if the request completes with an error.
+ *
+ * @returns Awaiter returning the completed request.
+ */
+inline RequestAwaiter<Request> tagRecv(std::shared_ptr<Endpoint> endpoint,
+                                       void* buffer,
+                                       size_t length,
+                                       ucp_tag_t tag)
+{
+  return RequestAwaiter<Request>(
+    [endpoint, buffer, length, tag](std::function<void(std::shared_ptr<void>)> callbackFunction,
+                                    std::shared_ptr<void> callbackData) {
+      return endpoint->tagRecv(buffer, length, tag, false, callbackFunction, callbackData);
+    });
+}
+
+/**
+ * @brief Await a tag receive operation from any endpoint of a worker.
+ *
+ * Enqueue a tag receive operation and suspend the awaiting task until it completes.
+ *
+ * @param[in] worker  the worker to receive the message on.
+ * @param[in] buffer  a raw pointer to pre-allocated memory where resulting data will be
+ *                    stored.
+ * @param[in] length  the size in bytes of the tag message to be received.
+ * @param[in] tag     the tag to match.
+ *
+ * @throws ucxx::Error  if the request completes with an error.
+ *
+ * @returns Awaiter returning the completed request.
+ */
+inline RequestAwaiter<Request> tagRecv(std::shared_ptr<Worker> worker,
+                                       void* buffer,
+                                       size_t length,
+                                       ucp_tag_t tag)
+{
+  return RequestAwaiter<Request>(
+    [worker, buffer, length, tag](std::function<void(std::shared_ptr<void>)> callbackFunction,
+                                  std::shared_ptr<void> callbackData) {
+      return worker->tagRecv(buffer, length, tag, false, callbackFunction, callbackData);
+    });
+}
+
+/**
+ * @brief Await a multi-buffer tag receive operation.
+ *
+ * Enqueue a multi-buffer tag receive operation and suspend the awaiting task until all
+ * frames have been received.
+ *
+ * @code{.cpp}
+ * auto request = co_await ucxx::coroutine::tagMultiRecv(ep, tag);
+ * for (const auto& br : request->_bufferRequests)
+ *   if (br->buffer) consume(br->buffer->data(), br->buffer->getSize());
+ * @endcode
+ *
+ * @param[in] endpoint  the endpoint to receive the message from.
+ * @param[in] tag       the tag to match.
+ *
+ * @throws ucxx::Error  if the request completes with an error.
+ *
+ * @returns Awaiter returning the completed request.
+ */
+inline RequestAwaiter<RequestTagMulti> tagMultiRecv(std::shared_ptr<Endpoint> endpoint,
+                                                    ucp_tag_t tag)
+{
+  return RequestAwaiter<RequestTagMulti>(
+    [endpoint, tag](std::function<void(std::shared_ptr<void>)> callbackFunction,
+                    std::shared_ptr<void> callbackData) {
+      return endpoint->tagMultiRecv(tag, false, callbackFunction, callbackData);
+    });
+}
+
+}  // namespace coroutine
+
+}  // namespace ucxx
+
+#endif
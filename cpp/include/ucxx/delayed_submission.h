@@ -6,12 +6,12 @@
 
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <vector>
 
 #include <ucp/api/ucp.h>
 
 #include <ucxx/log.h>
+#include <ucxx/mpsc_ring.h>
 
 namespace ucxx {
 
@@ -52,19 +52,44 @@ class DelayedSubmission {
 
 class DelayedSubmissionCollection {
  private:
-  std::vector<DelayedSubmissionCallbackPtrType>
-    _collection{};      ///< The collection of all known delayed submission operations.
-  std::mutex _mutex{};  ///< Mutex to provide access to the collection.
+  MpscRing<DelayedSubmissionCallbackType> _ring;  ///< The ring storing the delayed submissions
+  std::vector<DelayedSubmissionCallbackType>
+    _batch{};  ///< Reusable batch of callbacks being processed, owned by the consumer only
+
+  /**
+   * @brief Drain ready callbacks from the ring into the batch.
+   *
+   * Move callbacks that are ready from the ring into `_batch`, up to but excluding
+   * position `end`, releasing the slots to producers immediately. Must only be called
+   * from the consumer thread.
+   *
+   * @param[in] end the enqueue position past the last callback to drain.
+   *
+   * @returns `true` if all callbacks up to `end` were drained, `false` if the batch is
+   *          full or a producer has claimed a slot that has not been published yet.
+   */
+  bool drainRing(const size_t end);
 
  public:
+  static constexpr size_t defaultCapacity = 1024;  ///< Default number of slots in the ring
+
   /**
    * @brief Default delayed submission collection constructor.
    *
    * Construct an empty collection of delayed submissions. Despite its name, a delayed
    * submission registration may be processed right after registration, thus effectively
    * making it an immediate submission.
+   *
+   * The collection is a bounded lock-free multi-producer/single-consumer ring, where
+   * callbacks are stored inline, thus registering a request does not require a lock nor
+   * heap allocations as long as the callback fits in the small-object storage of
+   * `std::function`. If the ring is full, requests are pushed to an unbounded overflow
+   * collection that is protected by a mutex, ensuring registration never fails.
+   *
+   * @param[in] capacity  number of slots in the ring, rounded up to the next power of 2.
    */
-  DelayedSubmissionCollection()                                   = default;
+  explicit DelayedSubmissionCollection(const size_t capacity = defaultCapacity);
+
   DelayedSubmissionCollection(const DelayedSubmissionCollection&) = delete;
   DelayedSubmissionCollection& operator=(DelayedSubmissionCollection const&) = delete;
   DelayedSubmissionCollection(DelayedSubmissionCollection&& o)               = delete;
@@ -78,6 +103,15 @@ class DelayedSubmissionCollection {
    * submitted. The completion of each operation is handled externally by the
    * implementation of the object being processed, for example by checking the result
    * of `ucxx::Request::isCompleted()`.
+   *
+   * Pending submissions are drained from the ring in batches, followed by the overflow
+   * collection. The overflow collection is only processed once the ring has been fully
+   * drained, preserving the submission order of each producer thread. Only submissions
+   * registered in the ring before the call are processed, those registered while
+   * callbacks execute are left for the next call, thus producers submitting continuously
+   * can't keep the caller from returning to progress the worker.
+   *
+   * Only one thread may call this method at any time.
    */
   void process();
 
@@ -85,12 +119,45 @@ class DelayedSubmissionCollection {
    * @brief Register a request for delayed submission.
    *
    * Register a request for delayed submission with a callback that will be executed when
-   * the request is in fact submitted when `process()` is called.
+   * the request is in fact submitted when `process()` is called. This method is safe to
+   * be called concurrently from multiple threads.
    *
    * @param[in] callback  the callback that will be executed by `process()` when the
    *                      operation is submitted.
    */
   void registerRequest(DelayedSubmissionCallbackType callback);
+
+  /**
+   * @brief Get the capacity of the ring.
+   *
+   * Get the number of slots in the ring, beyond which delayed submissions are pushed to
+   * the overflow collection.
+   *
+   * @returns the number of slots in the ring.
+   */
+  size_t getCapacity() const;
+
+  /**
+   * @brief Check whether there are pending delayed submissions.
+   *
+   * Check whether all registered delayed submissions have been processed. A submission
+   * claimed by a producer that has not been published yet is considered pending. Must only
+   * be called from the thread calling `process()`.
+   *
+   * @returns `true` if there are no pending delayed submissions, `false` otherwise.
+   */
+  bool isEmpty() const;
+
+  /**
+   * @brief Bind the ring to a NUMA node.
+   *
+   * Bind the memory of the ring to the NUMA node of the thread processing the delayed
+   * submissions, migrating pages that have already been allocated. This is a best-effort
+   * operation, failures are ignored.
+   *
+   * @param[in] numaNode the NUMA node to bind the ring to, no-op if negative.
+   */
+  void bindToNumaNode(const int numaNode);
 };
 
 }  // namespace ucxx
@@ -6,6 +6,7 @@
 
 #include <netdb.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -38,7 +39,7 @@ struct ErrorCallbackData {
 
 class Endpoint : public Component {
  private:
-  ucp_ep_h _handle{nullptr};          ///< Handle to the UCP endpoint
+  std::atomic<ucp_ep_h> _handle{nullptr};  ///< Handle to the UCP endpoint, `nullptr` once closed
   ucp_ep_h _originalHandle{nullptr};  ///< Handle to the UCP endpoint, after it was previously
                                       ///< closed, used for logging purposes only
   bool _endpointErrorHandling{true};  ///< Whether the endpoint enables error handling
@@ -57,6 +58,7 @@ class Endpoint : public Component {
    * Instead the user should use one of the following:
    *
    * - `ucxx::Listener::createEndpointFromConnRequest`
+   * - `ucxx::Worker::createEndpointFromConnRequest()`
    * - `ucxx::Worker::createEndpointFromHostname()`
    * - `ucxx::Worker::createEndpointFromWorkerAddress()`
    * - `ucxx::createEndpointFromConnRequest()`
@@ -86,6 +88,17 @@ class Endpoint : public Component {
    */
   std::shared_ptr<Request> registerInflightRequest(std::shared_ptr<Request> request);
 
+  /**
+   * @brief Register a batch of inflight requests.
+   *
+   * Register a batch of requests that have not been submitted yet, acquiring the inflight
+   * requests lock only once. Also schedule requests to be canceled immediately after
+   * registration if the endpoint error handler has been called with an error.
+   *
+   * @param[in] requests the requests to register.
+   */
+  void registerInflightRequests(const std::vector<std::shared_ptr<Request>>& requests);
+
  public:
   Endpoint()                = delete;
   Endpoint(const Endpoint&) = delete;
@@ -93,6 +106,12 @@ class Endpoint : public Component {
   Endpoint(Endpoint&& o)               = delete;
   Endpoint& operator=(Endpoint&& o) = delete;
 
+  /**
+   * @brief Destructor of `ucxx::Endpoint`.
+   *
+   * Force closes the endpoint if it was not closed yet, the destructor must not block
+   * waiting on an unresponsive remote endpoint to flush outstanding operations.
+   */
   ~Endpoint();
 
   /**
@@ -122,6 +141,37 @@ class Endpoint : public Component {
                                                               uint16_t port,
                                                               bool endpointErrorHandling);
 
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::Endpoint>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::Endpoint>` object, connecting to a listener
+   * bound to an already resolved IPv4 or IPv6 address and the given port.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`, with a presumed listener on port 12345
+   * sockaddr_storage address;
+   * socklen_t length;
+   * worker->getHostnameResolver()->resolveBlocking("localhost", address, length);
+   * auto endpoint = ucxx::createEndpointFromSocketAddress(worker, address, length, 12345, true);
+   * @endcode
+   *
+   * @throws ucxx::Error if the address family is not supported.
+   *
+   * @param[in] worker                parent worker from which to create the endpoint.
+   * @param[in] address               resolved address the listener is bound to, its port
+   *                                  is ignored.
+   * @param[in] length                length of the resolved address.
+   * @param[in] port                  port the listener is bound to.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object
+   */
+  friend std::shared_ptr<Endpoint> createEndpointFromSocketAddress(std::shared_ptr<Worker> worker,
+                                                                   const sockaddr_storage& address,
+                                                                   socklen_t length,
+                                                                   uint16_t port,
+                                                                   bool endpointErrorHandling);
+
   /**
    * @brief Constructor for `shared_ptr<ucxx::Endpoint>`.
    *
@@ -148,6 +198,35 @@ class Endpoint : public Component {
                                                                  ucp_conn_request_h connRequest,
                                                                  bool endpointErrorHandling);
 
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::Endpoint>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::Endpoint>` object from a `ucp_conn_request_h`
+   * delivered by a `ucxx::Listener` connection callback, accepting the connection on
+   * `worker` instead of the worker the listener was created from. This allows spreading
+   * connections accepted by a single listener across multiple workers and their progress
+   * threads.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`, with a `ucp_conn_request_h` delivered by
+   * // a `ucxx::Listener` connection callback.
+   * auto endpoint = worker->createEndpointFromConnRequest(connRequest, true);
+   *
+   * // Equivalent to line above
+   * // auto endpoint = ucxx::createEndpointFromConnRequest(worker, connRequest, true);
+   * @endcode
+   *
+   * @param[in] worker                parent worker on which to accept the connection.
+   * @param[in] connRequest           handle to connection request delivered by a
+   *                                  listener callback.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object
+   */
+  friend std::shared_ptr<Endpoint> createEndpointFromConnRequest(std::shared_ptr<Worker> worker,
+                                                                 ucp_conn_request_h connRequest,
+                                                                 bool endpointErrorHandling);
+
   /**
    * @brief Constructor for `shared_ptr<ucxx::Endpoint>`.
    *
@@ -217,9 +296,8 @@ class Endpoint : public Component {
    * Remove the reference to a specific request from the internal container. This should
    * be called when a request has completed and the `ucxx::Endpoint` does not need to keep
    * track of it anymore. The raw pointer to a `ucxx::Request` is passed here as opposed
-   * to the usual `std::shared_ptr<ucxx::Request>` used elsewhere, this is because the
-   * raw pointer address is used as key to the requests reference, and this is called
-   * from the object's destructor.
+   * to the usual `std::shared_ptr<ucxx::Request>` used elsewhere, this is because this is
+   * called when the request is completing and no other reference may be available.
    *
    * @param[in] request raw pointer to the request
    */
@@ -236,6 +314,15 @@ class Endpoint : public Component {
    */
   size_t cancelInflightRequests();
 
+  /**
+   * @brief Get the number of inflight requests.
+   *
+   * Get the number of requests submitted on the endpoint that have not completed yet.
+   *
+   * @returns Number of inflight requests.
+   */
+  size_t getInflightRequestCount();
+
   /**
    * @brief Register a user-defined callback to call when endpoint closes.
    *
@@ -253,6 +340,311 @@ class Endpoint : public Component {
    */
   void setCloseCallback(std::function<void(void*)> closeCallback, void* closeCallbackArg);
 
+  /**
+   * @brief Enqueue a non-blocking endpoint close operation.
+   *
+   * Enqueue closing the endpoint, returning a `std::shared<ucxx::Request>` that completes
+   * once UCX has released the endpoint's resources. Unlike `close()`, the caller is not
+   * blocked progressing the worker, the close is submitted and completed by whatever
+   * progresses the worker, such as its progress thread. Once the request is submitted the
+   * endpoint is considered closed, the close callback is called and no more operations
+   * may be issued on it.
+   *
+   * With `ucxx::EndpointCloseMode::Flush` outstanding operations are completed before
+   * disconnecting, with `ucxx::EndpointCloseMode::Force` they are canceled and the remote
+   * endpoint is not notified. An endpoint that has errored is always force closed.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto request = endpoint->closeAsync(ucxx::EndpointCloseMode::Force);
+   * while (!request->isCompleted()) worker->progress();
+   * @endcode
+   *
+   * @param[in] mode                whether to flush outstanding operations or force close.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> closeAsync(
+    const EndpointCloseMode mode                                = EndpointCloseMode::Flush,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Mark the endpoint as closed.
+   *
+   * Atomically release the UCP endpoint handle and call the user-defined close callback,
+   * if any. Must be called right before the UCP endpoint close is submitted with the
+   * returned handle, which only one caller ever receives, thus concurrent closes never
+   * close the same UCP endpoint twice. After this, `getHandle()` returns `nullptr`.
+   *
+   * WARNING: This is not intended to be called by the user, it is called by `close()` and
+   * by `ucxx::RequestEndpointClose` when submitting the close.
+   *
+   * @returns The UCP endpoint handle to close, or `nullptr` if already closed.
+   */
+  ucp_ep_h setClosed();
+
+  /**
+   * @brief Enqueue an Active Message send operation.
+   *
+   * Enqueue an Active Message send operation, returning a `std::shared<ucxx::Request>`
+   * that can be later awaited and checked for errors. This is a non-blocking operation, and
+   * the status of the transfer must be verified from the resulting request object before
+   * the data can be released. The message is passed to the handler registered for `id` on
+   * the remote worker, see `ucxx::Worker::registerAmHandler()`, which does not need to
+   * know its size in advance. The header is copied and may be released immediately.
+   *
+   * Using a Python future may be requested by specifying `enablePythonFuture`. If a
+   * Python future is requested, the Python application must then await on this future to
+   * ensure the transfer has completed. Requires UCXX Python support.
+   *
+   * @param[in] id                  the identifier of the handler on the remote worker.
+   * @param[in] header              a user-defined header to send with the message.
+   * @param[in] buffer              a raw pointer to the data to be sent.
+   * @param[in] length              the size in bytes of the data to be sent.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> amSend(
+    unsigned id,
+    const std::string& header,
+    void* buffer,
+    size_t length,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a one-sided put operation.
+   *
+   * Enqueue a put operation writing local data to remote memory, returning a
+   * `std::shared<ucxx::Request>` that can be later awaited and checked for errors. This is
+   * a non-blocking operation, and the status of the transfer must be verified from the
+   * resulting request object before the data can be released. The remote process is not
+   * involved in the transfer, and a completed put is only guaranteed to be visible to it
+   * after a subsequent `flush()` completes.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * // serializedRemoteKey is `std::string` received from the remote process
+   * auto remoteKey = ucxx::createRemoteKeyFromSerialized(endpoint, serializedRemoteKey);
+   * auto request = endpoint->put(buffer, length, remoteKey->getBaseAddress(), remoteKey);
+   * @endcode
+   *
+   * @throws std::out_of_range if the remote range is not within the remote memory.
+   *
+   * @param[in] buffer              a raw pointer to the data to be written.
+   * @param[in] length              the size in bytes of the data to be written.
+   * @param[in] remoteAddress       the address of the remote memory to write to.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> put(
+    void* buffer,
+    size_t length,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a one-sided get operation.
+   *
+   * Enqueue a get operation reading remote memory into local memory, returning a
+   * `std::shared<ucxx::Request>` that can be later awaited and checked for errors. This is
+   * a non-blocking operation, and the status of the transfer must be verified from the
+   * resulting request object before the data can be consumed. The remote process is not
+   * involved in the transfer.
+   *
+   * @throws std::out_of_range if the remote range is not within the remote memory.
+   *
+   * @param[in] buffer              a raw pointer to pre-allocated memory where the remote
+   *                                data will be stored.
+   * @param[in] length              the size in bytes of the data to be read.
+   * @param[in] remoteAddress       the address of the remote memory to read from.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> get(
+    void* buffer,
+    size_t length,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a remote atomic add operation.
+   *
+   * Enqueue an atomic add of `value` to a remote 64-bit value, returning a
+   * `std::shared<ucxx::Request>` that can be later awaited and checked for errors. The
+   * remote process is not involved in the operation, which may be performed by the network
+   * hardware when supported by the transport. The previous remote value is not fetched,
+   * use `fetchAdd()` if it is required.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * // serializedRemoteKey is `std::string` received from the remote process
+   * auto remoteKey = ucxx::createRemoteKeyFromSerialized(endpoint, serializedRemoteKey);
+   * auto request = endpoint->atomicAdd(1, remoteKey->getBaseAddress(), remoteKey);
+   * @endcode
+   *
+   * @throws std::out_of_range if the remote value is not within the remote memory.
+   *
+   * @param[in] value               the value to add to the remote value.
+   * @param[in] remoteAddress       the address of the remote 64-bit value.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> atomicAdd(
+    const uint64_t value,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a remote atomic fetch-and-add operation.
+   *
+   * Enqueue an atomic add of `value` to a remote 64-bit value, returning a
+   * `std::shared<ucxx::Request>` that can be later awaited and checked for errors. Upon
+   * completion `result` holds the remote value prior to the addition, it must remain
+   * valid until then.
+   *
+   * @throws std::out_of_range if the remote value is not within the remote memory.
+   * @throws std::invalid_argument if `result` is `nullptr`.
+   *
+   * @param[in] value               the value to add to the remote value.
+   * @param[out] result             where the remote value prior to the operation is stored.
+   * @param[in] remoteAddress       the address of the remote 64-bit value.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> fetchAdd(
+    const uint64_t value,
+    uint64_t* result,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a remote atomic compare-and-swap operation.
+   *
+   * Enqueue an atomic replacement of a remote 64-bit value with `value` if it equals
+   * `compare`, returning a `std::shared<ucxx::Request>` that can be later awaited and
+   * checked for errors. Upon completion `result` holds the remote value prior to the
+   * operation, which equals `compare` if the swap occurred, it must remain valid until
+   * then.
+   *
+   * @throws std::out_of_range if the remote value is not within the remote memory.
+   * @throws std::invalid_argument if `result` is `nullptr`.
+   *
+   * @param[in] compare             the value the remote value is compared with.
+   * @param[in] value               the value to store if the comparison succeeds.
+   * @param[out] result             where the remote value prior to the operation is stored.
+   * @param[in] remoteAddress       the address of the remote 64-bit value.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> compareSwap(
+    const uint64_t compare,
+    const uint64_t value,
+    uint64_t* result,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a remote atomic swap operation.
+   *
+   * Enqueue an atomic replacement of a remote 64-bit value with `value`, returning a
+   * `std::shared<ucxx::Request>` that can be later awaited and checked for errors. Upon
+   * completion `result` holds the remote value prior to the operation, it must remain
+   * valid until then.
+   *
+   * @throws std::out_of_range if the remote value is not within the remote memory.
+   * @throws std::invalid_argument if `result` is `nullptr`.
+   *
+   * @param[in] value               the value to store.
+   * @param[out] result             where the remote value prior to the operation is stored.
+   * @param[in] remoteAddress       the address of the remote 64-bit value.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> swap(
+    const uint64_t value,
+    uint64_t* result,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a flush operation.
+   *
+   * Enqueue a flush operation, returning a `std::shared<ucxx::Request>` that completes
+   * once all one-sided operations previously issued on the endpoint have completed
+   * remotely.
+   *
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> flush(
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
   /**
    * @brief Enqueue a stream send operation.
    *
@@ -358,6 +750,192 @@ class Endpoint : public Component {
     std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
     std::shared_ptr<void> callbackData                          = nullptr);
 
+  /**
+   * @brief Enqueue a masked tag receive operation.
+   *
+   * Enqueue a tag receive operation matching any message whose tag equals `tag` in all
+   * bits set in `tagMask`, returning a `std::shared<ucxx::RequestTag>` that can be later
+   * awaited and checked for errors. Once completed, the tag of the message received is
+   * available from `ucxx::RequestTag::getSenderTag()`.
+   *
+   * Note that tag matching is performed by the worker, thus the message may have been sent
+   * by any endpoint connected to the worker, see `ucxx::Worker::tagRecv()`.
+   *
+   * Using a Python future may be requested by specifying `enablePythonFuture`. If a
+   * Python future is requested, the Python application must then await on this future to
+   * ensure the transfer has completed. Requires UCXX Python support.
+   *
+   * @param[in] buffer              a raw pointer to pre-allocated memory where resulting
+   *                                data will be stored.
+   * @param[in] length              the size in bytes of the tag message to be received.
+   * @param[in] tag                 the tag to match.
+   * @param[in] tagMask             the mask applied to tags of incoming messages before
+   *                                matching them against `tag`.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion, its state and the
+   *          tag of the message received.
+   */
+  std::shared_ptr<RequestTag> tagRecv(
+    void* buffer,
+    size_t length,
+    ucp_tag_t tag,
+    const TagMask tagMask,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a tag receive operation for a message of up to a maximum length.
+   *
+   * Enqueue a tag receive operation into a buffer that may be larger than the message,
+   * returning a `std::shared<ucxx::RequestTag>` that can be later awaited and checked for
+   * errors. Once completed, the actual length of the message received is available from
+   * `ucxx::RequestTag::getReceivedLength()`. If the message is larger than `maxLength`
+   * the request completes with `UCS_ERR_MESSAGE_TRUNCATED`.
+   *
+   * Using a Python future may be requested by specifying `enablePythonFuture`. If a
+   * Python future is requested, the Python application must then await on this future to
+   * ensure the transfer has completed. Requires UCXX Python support.
+   *
+   * @code{.cpp}
+   * // `ep` is `std::shared_ptr<ucxx::Endpoint>`
+   * std::vector<char> buffer(1024);
+   * auto request = ep->tagRecvUpTo(buffer.data(), buffer.size(), 0);
+   * while (!request->isCompleted())
+   *   worker->progress();
+   * buffer.resize(request->getReceivedLength());
+   * @endcode
+   *
+   * @param[in] buffer              a raw pointer to pre-allocated memory where resulting
+   *                                data will be stored.
+   * @param[in] maxLength           the size in bytes of `buffer`, the maximum length of
+   *                                the tag message to be received.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion, its state and the
+   *          length of the message received.
+   */
+  std::shared_ptr<RequestTag> tagRecvUpTo(
+    void* buffer,
+    size_t maxLength,
+    ucp_tag_t tag,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a tag receive operation for a message of unknown size.
+   *
+   * Enqueue a tag receive operation for a message whose size is not known in advance,
+   * returning a `std::shared<ucxx::RequestTagAnySize>` that can be later awaited and
+   * checked for errors. Once the message arrives it is probed, a buffer of exactly its
+   * size is allocated with `allocator` and the message received into it, avoiding an
+   * additional round-trip to communicate the size. The received buffer is then available
+   * from `ucxx::RequestTagAnySize::getRecvBuffer()`.
+   *
+   * Note that the tag is matched by any endpoint connected to the worker, as tag probing
+   * is not specific to an endpoint.
+   *
+   * @code{.cpp}
+   * // `ep` is `std::shared_ptr<ucxx::Endpoint>`
+   * auto request = ep->tagRecvAnySize(0);
+   * while (!request->isCompleted())
+   *   worker->progress();
+   * request->checkError();
+   * auto buffer = request->getRecvBuffer();
+   * @endcode
+   *
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] allocator           allocator of the receive buffer given the message
+   *                                length, a host buffer is allocated if `nullptr`.
+   *
+   * @returns Request to be subsequently checked for the completion, its state and the
+   *          buffer received.
+   */
+  std::shared_ptr<RequestTagAnySize> tagRecvAnySize(
+    ucp_tag_t tag,
+    const bool enablePythonFuture                               = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr,
+    BufferAllocatorType allocator                               = nullptr);
+
+  /**
+   * @brief Enqueue a batch of tag send operations.
+   *
+   * Enqueue one tag send operation for each (buffer, length, tag) entry, returning the
+   * group of `std::shared<ucxx::Request>` in the same order, each of which must be
+   * verified for completion before its data can be released. The entire batch pays for a
+   * single inflight requests registration, a single delayed submission registration and,
+   * if delayed submission is enabled, a single worker wakeup, thus achieving higher
+   * message rates than an equivalent sequence of `tagSend()` calls.
+   *
+   * Using a Python future may be requested by specifying `enablePythonFuture`, in which
+   * case a future is created for each request. Requires UCXX Python support.
+   *
+   * @code{.cpp}
+   * // `ep` is `std::shared_ptr<ucxx::Endpoint>`, `buffers` is `std::vector<void*>`
+   * auto requests = ep->tagSendBatch(buffers, lengths, tags);
+   *
+   * for (auto& request : requests)
+   *   while (!request->isCompleted())
+   *     worker->progress();
+   * @endcode
+   *
+   * @throws  std::runtime_error  if sizes of `buffers`, `lengths` and `tags` do not match.
+   *
+   * @param[in] buffers             a vector of raw pointers to the data to be sent.
+   * @param[in] lengths             a vector of size in bytes of each message to be sent.
+   * @param[in] tags                a vector of the tag to match for each message.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified for each request.
+   *
+   * @returns Requests to be subsequently checked for the completion and their state.
+   */
+  std::vector<std::shared_ptr<Request>> tagSendBatch(const std::vector<void*>& buffers,
+                                                     const std::vector<size_t>& lengths,
+                                                     const std::vector<ucp_tag_t>& tags,
+                                                     const bool enablePythonFuture = false);
+
+  /**
+   * @brief Enqueue a batch of tag receive operations.
+   *
+   * Enqueue one tag receive operation for each (buffer, length, tag) entry, returning the
+   * group of `std::shared<ucxx::Request>` in the same order, each of which must be
+   * verified for completion before its data can be consumed. The entire batch pays for a
+   * single inflight requests registration, a single delayed submission registration and,
+   * if delayed submission is enabled, a single worker wakeup.
+   *
+   * Using a Python future may be requested by specifying `enablePythonFuture`, in which
+   * case a future is created for each request. Requires UCXX Python support.
+   *
+   * @throws  std::runtime_error  if sizes of `buffers`, `lengths` and `tags` do not match.
+   *
+   * @param[in] buffers             a vector of raw pointers to pre-allocated memory where
+   *                                resulting data will be stored.
+   * @param[in] lengths             a vector of size in bytes of each message to be received.
+   * @param[in] tags                a vector of the tag to match for each message.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified for each request.
+   *
+   * @returns Requests to be subsequently checked for the completion and their state.
+   */
+  std::vector<std::shared_ptr<Request>> tagRecvBatch(const std::vector<void*>& buffers,
+                                                     const std::vector<size_t>& lengths,
+                                                     const std::vector<ucp_tag_t>& tags,
+                                                     const bool enablePythonFuture = false);
+
   /**
    * @brief Enqueue a multi-buffer tag send operation.
    *
@@ -414,13 +992,22 @@ class Endpoint : public Component {
    * Python future is requested, the Python application must then await on this future to
    * ensure the transfer has completed. Requires UCXX Python support.
    *
+   * The `callbackFunction` is called once the status of the request has been set, after all
+   * frames have been received or receiving a header failed.
+   *
    * @param[in] tag                 the tag to match.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
    *
    * @returns Request to be subsequently checked for the completion and its state.
    */
-  std::shared_ptr<RequestTagMulti> tagMultiRecv(const ucp_tag_t tag, const bool enablePythonFuture);
+  std::shared_ptr<RequestTagMulti> tagMultiRecv(
+    const ucp_tag_t tag,
+    const bool enablePythonFuture,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
 
   /**
    * @brief Get `ucxx::Worker` component form a worker or listener object.
@@ -456,11 +1043,20 @@ class Endpoint : public Component {
    * Close the endpoint without requiring to destroy the object. This may be useful when
    * `std::shared_ptr<ucxx::Request>` objects are still alive.
    *
+   * With `ucxx::EndpointCloseMode::Flush` outstanding operations are flushed before
+   * disconnecting unless the endpoint has errored, in which case it is force closed. This
+   * blocks until the close completes, progressing the worker unless its progress thread is
+   * running and the caller is another thread, in which case the progress thread completes
+   * the close. Flushing blocks until the remote endpoint responds or an error is detected,
+   * use `ucxx::EndpointCloseMode::Force` or `closeAsync()` to avoid that.
+   *
    * If the endpoint was created with error handling support, the error callback will be
    * executed, implying the user-defined callback will also be executed if one was
    * registered with `setCloseCallback()`.
+   *
+   * @param[in] mode  whether to flush outstanding operations or force close.
    */
-  void close();
+  void close(const EndpointCloseMode mode = EndpointCloseMode::Flush);
 };
 
 }  // namespace ucxx
@@ -0,0 +1,285 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/address.h>
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+class EndpointPool : public Component {
+ private:
+  /**
+   * @brief An idle endpoint kept for reuse.
+   */
+  struct IdleEntry {
+    std::shared_ptr<Endpoint> endpoint{nullptr};          ///< The idle endpoint
+    std::chrono::steady_clock::time_point releasedAt{};  ///< When the endpoint was released
+    std::shared_ptr<void> userData{nullptr};             ///< Data released with the endpoint
+  };
+
+  /**
+   * @brief The peer an endpoint handed out by the pool is connected to.
+   */
+  struct Owner {
+    std::weak_ptr<Endpoint> endpoint{};  ///< The endpoint handed out
+    std::string key{};                   ///< Key identifying the peer
+  };
+
+  size_t _maxSize{0};                            ///< Maximum number of idle endpoints kept
+  std::chrono::milliseconds _idleTimeout{0};     ///< Time after which idle endpoints are evicted
+  mutable std::mutex _mutex{};                   ///< Mutex to access the endpoints
+  std::unordered_map<std::string, std::vector<IdleEntry>>
+    _idle{};                                     ///< Idle endpoints by peer, oldest first
+  std::unordered_map<const Endpoint*, Owner>
+    _owners{};                                   ///< Peers of endpoints handed out by the pool
+  size_t _size{0};                               ///< Number of idle endpoints
+  std::chrono::steady_clock::time_point _lastSweep{};  ///< When idle endpoints were last evicted
+  std::atomic<uint64_t> _hits{0};       ///< Number of requests served by an idle endpoint
+  std::atomic<uint64_t> _misses{0};     ///< Number of requests that created an endpoint
+  std::atomic<uint64_t> _evictions{0};  ///< Number of idle endpoints evicted
+
+  /**
+   * @brief Private constructor of `ucxx::EndpointPool`.
+   *
+   * This is the internal implementation of `ucxx::EndpointPool` constructor, made private
+   * not to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Worker::createEndpointPool()`
+   * - `ucxx::createEndpointPool()`
+   *
+   * @param[in] worker       the `std::shared_ptr<Worker>` parent component.
+   * @param[in] maxSize      maximum number of idle endpoints kept.
+   * @param[in] idleTimeout  time after which idle endpoints are evicted.
+   */
+  EndpointPool(std::shared_ptr<Worker> worker,
+               const size_t maxSize,
+               const std::chrono::milliseconds idleTimeout);
+
+  /**
+   * @brief Get an idle endpoint to a peer or create a new one.
+   *
+   * Get the most recently released healthy idle endpoint to the peer identified by `key`,
+   * otherwise create a new endpoint with `create`.
+   *
+   * @param[in]  key       key identifying the peer.
+   * @param[in]  create    function creating a new endpoint to the peer.
+   * @param[out] reused    whether an idle endpoint was reused, ignored if `nullptr`.
+   * @param[out] userData  the data the reused endpoint was released with, or `nullptr` if
+   *                       a new endpoint was created, ignored if `nullptr`.
+   *
+   * @returns The endpoint to the peer.
+   */
+  std::shared_ptr<Endpoint> get(const std::string& key,
+                                const std::function<std::shared_ptr<Endpoint>()>& create,
+                                bool* reused,
+                                std::shared_ptr<void>* userData);
+
+  /**
+   * @brief Remove idle endpoints that timed out, must be called with `_mutex` held.
+   *
+   * @param[in]  now      the current time.
+   * @param[out] evicted  the endpoints removed, to be closed after releasing `_mutex`.
+   */
+  void removeIdle(const std::chrono::steady_clock::time_point now,
+                  std::vector<std::shared_ptr<Endpoint>>& evicted);
+
+  /**
+   * @brief Close endpoints evicted from the pool.
+   *
+   * Cancel inflight requests of the endpoints and close them without blocking, must be
+   * called without holding `_mutex`.
+   *
+   * @param[in] evicted the endpoints to close.
+   */
+  void closeEvicted(const std::vector<std::shared_ptr<Endpoint>>& evicted);
+
+ public:
+  static constexpr size_t defaultMaxSize = 1024;  ///< Default maximum idle endpoints kept
+  static constexpr std::chrono::milliseconds defaultIdleTimeout{
+    60000};  ///< Default time after which idle endpoints are evicted
+
+  EndpointPool()                    = delete;
+  EndpointPool(const EndpointPool&) = delete;
+  EndpointPool& operator=(EndpointPool const&) = delete;
+  EndpointPool(EndpointPool&& o)               = delete;
+  EndpointPool& operator=(EndpointPool&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::EndpointPool>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::EndpointPool>` object, keeping endpoints of a
+   * worker for reuse so that repeated connections to the same peer don't pay for endpoint
+   * creation and wireup every time. Endpoints are keyed by the hostname and port or the
+   * worker address of the peer, and by whether endpoint error handling is enabled. Up to
+   * `maxSize` idle endpoints are kept, beyond that the least recently released are
+   * evicted, as are endpoints idle for longer than `idleTimeout`. Evicted endpoints are
+   * closed without blocking.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * auto endpointPool = worker->createEndpointPool();
+   * auto ep = endpointPool->getFromHostname("10.10.10.10", 12345);
+   * // ... use the endpoint ...
+   * endpointPool->release(ep);
+   * @endcode
+   *
+   * @param[in] worker       the `std::shared_ptr<Worker>` parent component.
+   * @param[in] maxSize      maximum number of idle endpoints kept.
+   * @param[in] idleTimeout  time after which idle endpoints are evicted.
+   *
+   * @returns The `shared_ptr<ucxx::EndpointPool>` object
+   */
+  friend std::shared_ptr<EndpointPool> createEndpointPool(
+    std::shared_ptr<Worker> worker,
+    const size_t maxSize,
+    const std::chrono::milliseconds idleTimeout);
+
+  /**
+   * @brief Get an endpoint to a listener on a specific hostname and port.
+   *
+   * Get a healthy idle endpoint to the listener on `ipAddress:port` if one was released
+   * to the pool, otherwise create a new one as `ucxx::Worker::createEndpointFromHostname()`.
+   * Idle endpoints that errored are discarded.
+   *
+   * @throws ucxx::Error if a new endpoint was required but could not be created.
+   *
+   * @param[in]  ipAddress              hostname or IP address the listener is bound to.
+   * @param[in]  port                   port the listener is bound to.
+   * @param[in]  endpointErrorHandling  whether to enable endpoint error handling.
+   * @param[out] reused                 whether an idle endpoint was reused, ignored if
+   *                                    `nullptr`.
+   * @param[out] userData               the data the reused endpoint was released with, or
+   *                                    `nullptr` if a new endpoint was created, ignored if
+   *                                    `nullptr`.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object
+   */
+  std::shared_ptr<Endpoint> getFromHostname(std::string ipAddress,
+                                            uint16_t port,
+                                            bool endpointErrorHandling      = true,
+                                            bool* reused                    = nullptr,
+                                            std::shared_ptr<void>* userData = nullptr);
+
+  /**
+   * @brief Get an endpoint to a worker located at UCX address.
+   *
+   * Get a healthy idle endpoint to the worker located at `address` if one was released to
+   * the pool, otherwise create a new one as
+   * `ucxx::Worker::createEndpointFromWorkerAddress()`. Idle endpoints that errored are
+   * discarded.
+   *
+   * @throws ucxx::Error if a new endpoint was required but could not be created.
+   *
+   * @param[in]  address                address of the remote UCX worker.
+   * @param[in]  endpointErrorHandling  whether to enable endpoint error handling.
+   * @param[out] reused                 whether an idle endpoint was reused, ignored if
+   *                                    `nullptr`.
+   * @param[out] userData               the data the reused endpoint was released with, or
+   *                                    `nullptr` if a new endpoint was created, ignored if
+   *                                    `nullptr`.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object
+   */
+  std::shared_ptr<Endpoint> getFromWorkerAddress(std::shared_ptr<Address> address,
+                                                 bool endpointErrorHandling      = true,
+                                                 bool* reused                    = nullptr,
+                                                 std::shared_ptr<void>* userData = nullptr);
+
+  /**
+   * @brief Return an endpoint to the pool.
+   *
+   * Return an endpoint obtained from the pool for later reuse, the caller must not use it
+   * afterwards. Endpoints that errored, were closed or still have inflight requests are
+   * discarded, the latter are closed canceling their requests, thus a reused endpoint
+   * never completes requests posted by a previous user. If the pool is full the least
+   * recently released idle endpoint is evicted.
+   *
+   * Application state tied to the connection, such as tags exchanged with the peer, may be
+   * released along with the endpoint as `userData`, which is handed back to whoever reuses
+   * the endpoint and is destroyed when the endpoint leaves the pool otherwise.
+   *
+   * @throws std::invalid_argument if the endpoint was not obtained from the pool.
+   *
+   * @param[in] endpoint  the endpoint to return.
+   * @param[in] userData  data kept with the idle endpoint.
+   */
+  void release(std::shared_ptr<Endpoint> endpoint, std::shared_ptr<void> userData = nullptr);
+
+  /**
+   * @brief Evict endpoints idle for longer than the idle timeout.
+   *
+   * Evict idle endpoints that timed out. Eviction also happens as the pool is used, this
+   * method may be called periodically to evict endpoints of a pool that is not in use.
+   *
+   * @returns The number of endpoints evicted.
+   */
+  size_t evictIdle();
+
+  /**
+   * @brief Evict all idle endpoints.
+   *
+   * Evict all idle endpoints, endpoints currently in use may still be released to the
+   * pool later.
+   */
+  void clear();
+
+  /**
+   * @brief Get the number of requests served by an idle endpoint.
+   *
+   * @returns The number of hits.
+   */
+  uint64_t getHits() const;
+
+  /**
+   * @brief Get the number of requests that created a new endpoint.
+   *
+   * @returns The number of misses.
+   */
+  uint64_t getMisses() const;
+
+  /**
+   * @brief Get the number of idle endpoints evicted.
+   *
+   * Get the number of idle endpoints evicted because the pool was full or they timed out,
+   * excluding endpoints discarded because they errored.
+   *
+   * @returns The number of evictions.
+   */
+  uint64_t getEvictions() const;
+
+  /**
+   * @brief Get the number of idle endpoints.
+   *
+   * @returns The number of idle endpoints.
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief Get the maximum number of idle endpoints kept.
+   *
+   * @returns The capacity of the pool.
+   */
+  size_t getMaxSize() const;
+};
+
+}  // namespace ucxx
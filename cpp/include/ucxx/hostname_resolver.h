@@ -0,0 +1,210 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <sys/socket.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+namespace ucxx {
+
+class HostnameResolver {
+ public:
+  /**
+   * @brief Callback called once a hostname is resolved.
+   *
+   * Called with `UCS_OK` and the resolved address, whose port is left unset, with
+   * `UCS_ERR_INVALID_ADDR` if the hostname could not be resolved, or with
+   * `UCS_ERR_CANCELED` if the resolver was destroyed before resolving it. The address must
+   * not be used unless the status is `UCS_OK`.
+   */
+  typedef std::function<void(
+    ucs_status_t status, const sockaddr_storage& address, socklen_t length)>
+    CallbackType;
+
+  static constexpr size_t defaultNumThreads = 4;  ///< Default number of resolver threads
+  static constexpr std::chrono::milliseconds defaultTimeToLive{
+    60000};  ///< Default time a resolved address is cached for
+
+ private:
+  /**
+   * @brief A cached resolved address.
+   */
+  struct Entry {
+    sockaddr_storage address{};                        ///< The resolved address
+    socklen_t length{0};                               ///< Length of the resolved address
+    std::chrono::steady_clock::time_point expiration;  ///< When the entry expires
+  };
+
+  /**
+   * @brief State shared between the resolver and its threads.
+   *
+   * Resolver threads hold their own reference to the state, thus the resolver may be
+   * destroyed from a callback running on one of its threads.
+   */
+  struct State {
+    std::mutex mutex{};                               ///< Mutex to access the state
+    std::condition_variable cv{};                     ///< Wakes threads when work is queued
+    std::queue<std::string> queue{};                  ///< Hostnames waiting to be resolved
+    std::unordered_map<std::string, Entry> cache{};   ///< Resolved addresses by hostname
+    std::unordered_map<std::string, std::vector<CallbackType>>
+      pending{};                                      ///< Callbacks waiting on each hostname
+    std::chrono::milliseconds timeToLive{defaultTimeToLive};  ///< Time entries are cached for
+    bool stop{false};                                 ///< Whether threads should exit
+    std::atomic<uint64_t> hits{0};                    ///< Lookups served by the cache
+    std::atomic<uint64_t> misses{0};                  ///< Lookups that required resolution
+  };
+
+  std::shared_ptr<State> _state{std::make_shared<State>()};  ///< The shared state
+  std::vector<std::thread> _threads{};                       ///< The resolver threads
+
+  /**
+   * @brief Resolve a hostname with `getaddrinfo`.
+   *
+   * Resolve a hostname, preferring the first IPv4 address returned by `getaddrinfo` and
+   * falling back to the first IPv6 address if there is none, which is always the case for
+   * literal IPv6 addresses. This call blocks until resolution completes.
+   *
+   * @param[in]  hostname  the hostname or IP address to resolve.
+   * @param[out] entry     the entry where the resolved address is stored.
+   *
+   * @returns `UCS_OK` if resolved successfully, `UCS_ERR_INVALID_ADDR` otherwise.
+   */
+  static ucs_status_t getAddressInfo(const std::string& hostname, Entry& entry);
+
+  /**
+   * @brief Find an unexpired cached entry.
+   *
+   * Find an unexpired cached entry for `hostname`, must be called with the state's mutex
+   * held. Expired entries are removed.
+   *
+   * @param[in] state     the resolver state.
+   * @param[in] hostname  the hostname to look up.
+   *
+   * @returns The cached entry, or `nullptr` if none is valid.
+   */
+  static const Entry* findCached(State& state, const std::string& hostname);
+
+  /**
+   * @brief The resolver thread loop.
+   *
+   * Resolve queued hostnames until the resolver is destroyed, caching resolved addresses
+   * and calling all callbacks waiting on each hostname.
+   *
+   * @param[in] state the resolver state.
+   */
+  static void run(std::shared_ptr<State> state);
+
+ public:
+  /**
+   * @brief Constructor of a hostname resolver.
+   *
+   * Construct a hostname resolver running `numThreads` threads to resolve hostnames with
+   * `getaddrinfo`, supporting both IPv4 and IPv6. Resolved addresses are cached for
+   * `timeToLive` and concurrent lookups of the same hostname are resolved only once, thus
+   * storms of connections to the same few hosts do not serialize behind DNS.
+   *
+   * @code{.cpp}
+   * auto resolver = std::make_shared<ucxx::HostnameResolver>(8, std::chrono::seconds(30));
+   * worker->setHostnameResolver(resolver);
+   * @endcode
+   *
+   * @param[in] numThreads  the number of resolver threads.
+   * @param[in] timeToLive  the time a resolved address is cached for.
+   */
+  explicit HostnameResolver(const size_t numThreads                   = defaultNumThreads,
+                            const std::chrono::milliseconds timeToLive = defaultTimeToLive);
+
+  HostnameResolver(const HostnameResolver&) = delete;
+  HostnameResolver& operator=(HostnameResolver const&) = delete;
+  HostnameResolver(HostnameResolver&& o)               = delete;
+  HostnameResolver& operator=(HostnameResolver&& o) = delete;
+
+  /**
+   * @brief Destructor of a hostname resolver.
+   *
+   * Stop the resolver threads, waiting for lookups in progress to complete. Callbacks of
+   * hostnames whose resolution did not start yet are called with `UCS_ERR_CANCELED` before
+   * the destructor returns.
+   */
+  ~HostnameResolver();
+
+  /**
+   * @brief Get the process-wide default resolver.
+   *
+   * Get the resolver used by workers that were not assigned one with
+   * `ucxx::Worker::setHostnameResolver()`, created with default settings on first use.
+   *
+   * @returns The default resolver.
+   */
+  static std::shared_ptr<HostnameResolver> getDefault();
+
+  /**
+   * @brief Resolve a hostname asynchronously.
+   *
+   * Resolve `hostname`, calling `callback` once resolution completes. If the hostname is
+   * cached the callback is called immediately by the calling thread, otherwise it is
+   * called by one of the resolver threads. This method is thread-safe.
+   *
+   * @param[in] hostname  the hostname or IP address to resolve.
+   * @param[in] callback  the callback to call with the result.
+   */
+  void resolve(const std::string& hostname, CallbackType callback);
+
+  /**
+   * @brief Resolve a hostname on the calling thread.
+   *
+   * Resolve `hostname` on the calling thread unless it is cached, caching the result.
+   * This method is thread-safe.
+   *
+   * @param[in]  hostname  the hostname or IP address to resolve.
+   * @param[out] address   the resolved address, whose port is left unset.
+   * @param[out] length    the length of the resolved address.
+   *
+   * @returns `UCS_OK` if resolved successfully, `UCS_ERR_INVALID_ADDR` otherwise.
+   */
+  ucs_status_t resolveBlocking(const std::string& hostname,
+                               sockaddr_storage& address,
+                               socklen_t& length);
+
+  /**
+   * @brief Remove all cached addresses.
+   *
+   * Remove all cached addresses, subsequent lookups resolve hostnames again.
+   */
+  void clearCache();
+
+  /**
+   * @brief Get the number of lookups served by the cache.
+   *
+   * @returns The number of lookups served by the cache.
+   */
+  uint64_t getCacheHits() const;
+
+  /**
+   * @brief Get the number of lookups that required resolution.
+   *
+   * Get the number of lookups that were not served by the cache, including those that
+   * waited on a concurrent resolution of the same hostname.
+   *
+   * @returns The number of lookups that required resolution.
+   */
+  uint64_t getCacheMisses() const;
+};
+
+}  // namespace ucxx
@@ -4,31 +4,69 @@
  */
 #pragma once
 
-#include <map>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace ucxx {
 
+class InflightRequests;
 class Request;
 
-typedef std::map<const Request* const, std::shared_ptr<Request>> InflightRequestsMap;
-typedef std::unique_ptr<InflightRequestsMap> InflightRequestsMapPtr;
+/**
+ * @brief Intrusive hook used to track a request in an `InflightRequests` container.
+ *
+ * Each `ucxx::Request` embeds one hook, allowing it to be linked into an `InflightRequests`
+ * container without any allocations. A request may only be tracked by one container at a
+ * time, the container currently tracking the request is identified by `_owner`. All
+ * members except `_owner` are protected by the owner's mutex.
+ */
+struct InflightRequestsHook {
+  InflightRequestsHook* _prev{nullptr};  ///< Previous hook in the owner's list
+  InflightRequestsHook* _next{nullptr};  ///< Next hook in the owner's list
+  std::atomic<InflightRequests*> _owner{
+    nullptr};        ///< The container tracking the request, `nullptr` if untracked
+  uint64_t _epoch{0};  ///< The owner's epoch at the time the request was linked
+  std::shared_ptr<Request> _request{
+    nullptr};  ///< Reference keeping the request alive while it is tracked
+};
 
 class InflightRequests {
  private:
-  InflightRequestsMapPtr _inflightRequests{
-    std::make_unique<InflightRequestsMap>()};  ///< Container storing pointers to all inflight
-                                               ///< requests known to the owner of this object
+  InflightRequestsHook _head{};  ///< Sentinel of the circular list of inflight requests
+  std::atomic<size_t> _size{0};  ///< Number of requests in the list
+  uint64_t _epoch{0};  ///< Incremented each time the list is detached by `cancelAll()`
   std::mutex _mutex{};  ///< Mutex to control access to inflight requests container
-  std::mutex
-    _cancelMutex{};  ///< Mutex to allow cancelation and prevent removing requests simultaneously
+
+  /**
+   * @brief Unlink a hook from the list it is currently linked into.
+   *
+   * Unlink a hook from the list it is currently linked into, which is either the internal
+   * list or a list detached by `cancelAll()`. The caller must hold `_mutex`.
+   *
+   * @param[in] hook the hook to unlink.
+   *
+   * @returns The reference to the request that was held by the hook.
+   */
+  std::shared_ptr<Request> unlink(InflightRequestsHook* hook);
+
+  /**
+   * @brief Link a request at the end of the internal list.
+   *
+   * Link a request at the end of the internal list, unless it is already tracked by this
+   * container. The caller must hold `_mutex`.
+   *
+   * @param[in] request the request to link.
+   */
+  void link(std::shared_ptr<Request> request);
 
  public:
   /**
    * @brief Default constructor.
    */
-  InflightRequests() = default;
+  InflightRequests();
 
   InflightRequests(const InflightRequests&) = delete;
   InflightRequests& operator=(InflightRequests const&) = delete;
@@ -52,30 +90,45 @@ class InflightRequests {
   /**
    * @brief Insert an inflight requests to the container.
    *
+   * Link the request into the container in constant time, without allocating. Inserting
+   * a request already tracked by this container is a no-op.
+   *
    * @param[in] request a `std::shared_ptr<Request>` with the inflight request.
    */
   void insert(std::shared_ptr<Request> request);
 
   /**
-   * @brief Merge a container of inflight requests with the internal container.
+   * @brief Insert multiple inflight requests to the container.
+   *
+   * Link all requests into the container acquiring the lock only once, without
+   * allocating. Requests already tracked by this container are skipped.
+   *
+   * @param[in] requests the inflight requests.
+   */
+  void insert(const std::vector<std::shared_ptr<Request>>& requests);
+
+  /**
+   * @brief Merge another container of inflight requests with the internal container.
    *
-   * Merge a container of inflight requests obtained from `InflightRequests::release()` of
-   * another object with the internal container.
+   * Move all requests tracked by `inflightRequests` into this container, leaving
+   * `inflightRequests` as a clean, new object. Requests completing concurrently are
+   * removed from whichever container tracks them at that time.
    *
-   * @param[in] inflightRequestsMap container of inflight requests to merge with the
-   *                                internal container.
+   * @param[in] inflightRequests container of inflight requests to merge with the
+   *                             internal container.
    */
-  void merge(InflightRequestsMapPtr inflightRequestsMap);
+  void merge(InflightRequests& inflightRequests);
 
   /**
    * @brief Remove an inflight request from the internal container.
    *
-   * Remove the reference to a specific request from the internal container. This should
-   * be called when a request has completed and the `InflightRequests` owner does not need
-   * to keep track of it anymore. The raw pointer to a `ucxx::Request` is passed here as
-   * opposed to the usual `std::shared_ptr<ucxx::Request>` used elsewhere, this is because
-   * the raw pointer address is used as key to the requests reference, and this is called
-   * called from the object's destructor.
+   * Remove the reference to a specific request from the internal container in constant
+   * time. This should be called when a request has completed and the `InflightRequests`
+   * owner does not need to keep track of it anymore. The raw pointer to a
+   * `ucxx::Request` is passed here as opposed to the usual
+   * `std::shared_ptr<ucxx::Request>` used elsewhere, this is because this is called when
+   * the request is completing and no other reference may be available. If the request is
+   * not tracked by this container this is a no-op and does not acquire any locks.
    *
    * @param[in] request raw pointer to the request
    */
@@ -85,22 +138,13 @@ class InflightRequests {
    * @brief Issue cancelation of all inflight requests and clear the internal container.
    *
    * Issue cancelation of all inflight requests known to this object and clear the
-   * internal container. The total number of canceled requests is returned.
+   * internal container. The internal list is detached in constant time, requests inserted
+   * while cancelation is in progress are not canceled. The total number of canceled
+   * requests is returned.
    *
    * @returns The total number of canceled requests.
    */
   size_t cancelAll();
-
-  /**
-   * @brief Releases the internal container.
-   *
-   * Releases the internal container that can be merged into another `InflightRequests`
-   * object with `InflightRequests::release()`. Effectively leaves the internal state as a
-   * clean, new object.
-   *
-   * @returns The internal container.
-   */
-  InflightRequestsMapPtr release();
 };
 
 }  // namespace ucxx
@@ -0,0 +1,142 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <memory>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/context.h>
+
+namespace ucxx {
+
+class RemoteKey;
+
+class MemoryHandle : public Component {
+ private:
+  ucp_mem_h _handle{nullptr};                            ///< The UCP memory handle
+  size_t _size{0};                                       ///< The size of the mapped memory
+  uint64_t _baseAddress{0};                              ///< The base address of the memory
+  ucs_memory_type_t _memoryType{UCS_MEMORY_TYPE_HOST};  ///< The type of the mapped memory
+
+  /**
+   * @brief Private constructor of `ucxx::MemoryHandle`.
+   *
+   * This is the internal implementation of `ucxx::MemoryHandle` constructor, made private
+   * not to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Context::createMemoryHandle()`
+   * - `ucxx::createMemoryHandle()`
+   *
+   * @throws ucxx::Error if the memory could not be mapped.
+   *
+   * @param[in] context     the `std::shared_ptr<Context>` parent component.
+   * @param[in] size        the size in bytes of the memory to map.
+   * @param[in] buffer      a raw pointer to the memory to map, or `nullptr` to let UCX
+   *                        allocate memory of `size` bytes.
+   * @param[in] memoryType  the type of the memory, only used to allocate memory if
+   *                        `buffer` is `nullptr`.
+   */
+  MemoryHandle(std::shared_ptr<Context> context,
+               const size_t size,
+               void* buffer,
+               const ucs_memory_type_t memoryType);
+
+ public:
+  MemoryHandle()                    = delete;
+  MemoryHandle(const MemoryHandle&) = delete;
+  MemoryHandle& operator=(MemoryHandle const&) = delete;
+  MemoryHandle(MemoryHandle&& o)               = delete;
+  MemoryHandle& operator=(MemoryHandle&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::MemoryHandle>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::MemoryHandle>` object, mapping memory with
+   * the UCP context so that it may be accessed by remote endpoints with one-sided
+   * operations, given they are provided a `ucxx::RemoteKey` created from the handle. If
+   * `buffer` is `nullptr` memory of `size` bytes and type `memoryType` is allocated by
+   * UCX, otherwise the memory at `buffer` is mapped and must remain valid for the
+   * lifetime of the handle. The memory is unmapped, and released if allocated by UCX,
+   * when the handle is destroyed.
+   *
+   * @code{.cpp}
+   * // context is `std::shared_ptr<ucxx::Context>`
+   * auto memoryHandle = context->createMemoryHandle(1048576, nullptr);
+   *
+   * // Equivalent to line above
+   * // auto memoryHandle = ucxx::createMemoryHandle(context, 1048576, nullptr);
+   * @endcode
+   *
+   * @throws ucxx::Error if the memory could not be mapped.
+   *
+   * @param[in] context     the `std::shared_ptr<Context>` parent component.
+   * @param[in] size        the size in bytes of the memory to map.
+   * @param[in] buffer      a raw pointer to the memory to map, or `nullptr` to let UCX
+   *                        allocate memory of `size` bytes.
+   * @param[in] memoryType  the type of the memory, only used to allocate memory if
+   *                        `buffer` is `nullptr`.
+   *
+   * @returns The `shared_ptr<ucxx::MemoryHandle>` object
+   */
+  friend std::shared_ptr<MemoryHandle> createMemoryHandle(std::shared_ptr<Context> context,
+                                                          const size_t size,
+                                                          void* buffer,
+                                                          const ucs_memory_type_t memoryType);
+
+  ~MemoryHandle();
+
+  /**
+   * @brief Get the underlying `ucp_mem_h` handle.
+   *
+   * Lifetime of the `ucp_mem_h` handle is managed by the `ucxx::MemoryHandle` object and
+   * its ownership is non-transferrable. Once the `ucxx::MemoryHandle` is destroyed the
+   * memory is unmapped and the handle is not valid anymore, it is the user's
+   * responsibility to ensure the owner's lifetime while using the handle.
+   *
+   * @returns The underlying `ucp_mem_h` handle.
+   */
+  ucp_mem_h getHandle();
+
+  /**
+   * @brief Get the size of the mapped memory.
+   *
+   * @returns The size in bytes of the mapped memory, which may be larger than requested.
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief Get the base address of the mapped memory.
+   *
+   * @returns The base address of the mapped memory.
+   */
+  uint64_t getBaseAddress() const;
+
+  /**
+   * @brief Get the type of the mapped memory.
+   *
+   * @returns The type of the mapped memory as reported by UCX.
+   */
+  ucs_memory_type_t getMemoryType() const;
+
+  /**
+   * @brief Create a remote key of the mapped memory.
+   *
+   * Create a `ucxx::RemoteKey` packing the information a remote endpoint requires to
+   * access the mapped memory, which may then be serialized with
+   * `ucxx::RemoteKey::serialize()` and sent to the remote process.
+   *
+   * @throws ucxx::Error if the remote key could not be packed.
+   *
+   * @returns The `shared_ptr<ucxx::RemoteKey>` object
+   */
+  std::shared_ptr<RemoteKey> createRemoteKey();
+};
+
+}  // namespace ucxx
@@ -0,0 +1,263 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <ucxx/utils/affinity.h>
+
+namespace ucxx {
+
+/**
+ * @brief A bounded multi-producer/single-consumer ring with an unbounded overflow.
+ *
+ * A lock-free ring where values are stored inline, thus pushing a value does not require
+ * a lock nor heap allocations. If the ring is full, values are pushed to an unbounded
+ * overflow collection that is protected by a mutex, ensuring pushes never fail. Once a
+ * value overflowed, all further values are pushed to the overflow until it is popped,
+ * thus preserving the order in which each producer thread pushed its values.
+ *
+ * Values are popped from the ring with `pop()` and, once the ring has been drained, from
+ * the overflow with `popOverflow()`. Only one thread may pop values at any time.
+ *
+ * @tparam T  the type of values stored, must be default-constructible and movable.
+ */
+template <typename T>
+class MpscRing {
+ private:
+  /**
+   * @brief A slot in the ring.
+   *
+   * Each slot stores its value inline, the sequence number is used to synchronize
+   * producers and the consumer without locks: a slot at ring position `pos` is free for
+   * writing when its sequence equals `pos`, and ready for reading when it equals `pos + 1`.
+   */
+  struct Slot {
+    std::atomic<size_t> _sequence{0};  ///< Sequence number of the slot
+    T _value{};                        ///< The value stored inline
+  };
+
+  static constexpr size_t _cacheLineSize = 64;  ///< Size of a cache line to avoid false sharing
+
+  const size_t _capacity{0};        ///< Number of slots in the ring, always a power of 2
+  const size_t _mask{0};            ///< Mask to convert a position into a ring index
+  std::unique_ptr<Slot[]> _ring{};  ///< The ring storing the values
+  alignas(_cacheLineSize) std::atomic<size_t> _enqueuePosition{
+    0};  ///< Next position to be claimed by a producer
+  alignas(_cacheLineSize) size_t _dequeuePosition{
+    0};  ///< Next position to be read by the consumer, owned by the consumer only
+  alignas(_cacheLineSize) std::atomic<size_t> _overflowSize{
+    0};  ///< Number of values currently in the overflow collection
+  std::mutex _overflowMutex{};  ///< Mutex to provide access to the overflow collection
+  std::deque<T> _overflow{};    ///< The overflow collection, used only when the ring is full
+
+  static size_t roundUpPowerOfTwo(size_t value)
+  {
+    size_t ret = 1;
+    while (ret < value)
+      ret <<= 1;
+    return ret;
+  }
+
+  /**
+   * @brief Attempt to push a value into the ring.
+   *
+   * Attempt to push a value into the ring without blocking.
+   *
+   * @param[in] value  the value to push, only moved from if the push succeeds.
+   *
+   * @returns `true` if the value was pushed, `false` if the ring is full.
+   */
+  bool tryPush(T& value)
+  {
+    size_t pos = _enqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot;
+
+    while (true) {
+      slot            = &_ring[pos & _mask];
+      size_t sequence = slot->_sequence.load(std::memory_order_acquire);
+      auto diff       = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+      if (diff == 0) {
+        // Slot is free, attempt to claim it
+        if (_enqueuePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        // Slot still holds a value not popped from the previous lap, ring is full
+        return false;
+      } else {
+        // Another producer claimed this slot, reload and retry
+        pos = _enqueuePosition.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->_value = std::move(value);
+    slot->_sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+ public:
+  /**
+   * @brief Constructor of a ring.
+   *
+   * Construct an empty ring.
+   *
+   * @param[in] capacity  number of slots in the ring, rounded up to the next power of 2.
+   */
+  explicit MpscRing(const size_t capacity)
+    : _capacity(roundUpPowerOfTwo(capacity > 0 ? capacity : 1)),
+      _mask(_capacity - 1),
+      _ring(std::make_unique<Slot[]>(_capacity))
+  {
+    for (size_t i = 0; i < _capacity; ++i)
+      _ring[i]._sequence.store(i, std::memory_order_relaxed);
+  }
+
+  MpscRing(const MpscRing&) = delete;
+  MpscRing& operator=(MpscRing const&) = delete;
+  MpscRing(MpscRing&& o)               = delete;
+  MpscRing& operator=(MpscRing&& o) = delete;
+
+  /**
+   * @brief Push a value.
+   *
+   * Push a value to the ring, or to the overflow collection if the ring is full or the
+   * overflow is not empty. This method is safe to be called concurrently from multiple
+   * threads.
+   *
+   * @param[in] value  the value to push.
+   */
+  void push(T value)
+  {
+    if (_overflowSize.load(std::memory_order_acquire) == 0 && tryPush(value)) return;
+
+    std::lock_guard<std::mutex> lock(_overflowMutex);
+    _overflow.push_back(std::move(value));
+    _overflowSize.store(_overflow.size(), std::memory_order_release);
+  }
+
+  /**
+   * @brief Pop a value from the ring.
+   *
+   * Pop the next value from the ring, releasing its slot to producers immediately. The
+   * slot is reset to a default-constructed value so that it does not hold on to any
+   * resources. Values in the overflow collection are not popped.
+   *
+   * @param[out] value  where the popped value is moved to.
+   *
+   * @returns `true` if a value was popped, `false` if the ring is empty or the next slot
+   *          was claimed by a producer that has not published it yet.
+   */
+  bool pop(T& value)
+  {
+    Slot& slot      = _ring[_dequeuePosition & _mask];
+    size_t sequence = slot._sequence.load(std::memory_order_acquire);
+
+    // Slot is either empty or claimed by a producer that did not publish it yet
+    if (sequence != _dequeuePosition + 1) return false;
+
+    value       = std::move(slot._value);
+    slot._value = T{};
+    slot._sequence.store(_dequeuePosition + _capacity, std::memory_order_release);
+    ++_dequeuePosition;
+    return true;
+  }
+
+  /**
+   * @brief Pop values from the overflow collection.
+   *
+   * Pop up to `maxValues` values from the overflow collection in the order they were
+   * pushed, passing each of them to `consume` with the overflow mutex held. Values are
+   * only popped once the ring has been fully drained: while the overflow is not empty all
+   * producers push to it, thus any value still in the ring precedes those in the overflow.
+   * The ring is checked with the lock held, since a producer may push to the ring and then
+   * to the overflow while the ring was being drained.
+   *
+   * @param[in] maxValues  the maximum number of values to pop.
+   * @param[in] consume    callable invoked with each popped value as an rvalue reference.
+   *
+   * @returns The number of values popped.
+   */
+  template <typename Consumer>
+  size_t popOverflow(const size_t maxValues, Consumer&& consume)
+  {
+    if (_overflowSize.load(std::memory_order_acquire) == 0) return 0;
+
+    std::lock_guard<std::mutex> lock(_overflowMutex);
+    if (_dequeuePosition != _enqueuePosition.load(std::memory_order_acquire)) return 0;
+
+    size_t popped = 0;
+    while (popped < maxValues && !_overflow.empty()) {
+      consume(std::move(_overflow.front()));
+      _overflow.pop_front();
+      ++popped;
+    }
+    _overflowSize.store(_overflow.size(), std::memory_order_release);
+
+    return popped;
+  }
+
+  /**
+   * @brief Get the capacity of the ring.
+   *
+   * Get the number of slots in the ring, beyond which values are pushed to the overflow
+   * collection.
+   *
+   * @returns the number of slots in the ring.
+   */
+  size_t getCapacity() const { return _capacity; }
+
+  /**
+   * @brief Get the position past the last value claimed by a producer.
+   *
+   * @returns the enqueue position of the ring.
+   */
+  size_t getEnqueuePosition() const { return _enqueuePosition.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Get the position of the next value to be popped from the ring.
+   *
+   * Must only be called from the consumer thread.
+   *
+   * @returns the dequeue position of the ring.
+   */
+  size_t getDequeuePosition() const { return _dequeuePosition; }
+
+  /**
+   * @brief Check whether there are values pending.
+   *
+   * Check whether all pushed values have been popped. A value claimed by a producer that
+   * has not been published yet is considered pending. Must only be called from the
+   * consumer thread.
+   *
+   * @returns `true` if there are no pending values, `false` otherwise.
+   */
+  bool isEmpty() const
+  {
+    return _dequeuePosition == _enqueuePosition.load(std::memory_order_acquire) &&
+           _overflowSize.load(std::memory_order_acquire) == 0;
+  }
+
+  /**
+   * @brief Bind the ring to a NUMA node.
+   *
+   * Bind the memory of the ring to a NUMA node, migrating pages that have already been
+   * allocated. This is a best-effort operation, failures are ignored.
+   *
+   * @param[in] numaNode the NUMA node to bind the ring to, no-op if negative.
+   */
+  void bindToNumaNode(const int numaNode)
+  {
+    utils::bindMemoryToNumaNode(_ring.get(), _capacity * sizeof(Slot), numaNode, true);
+  }
+};
+
+}  // namespace ucxx
@@ -0,0 +1,223 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/future.h>
+#include <ucxx/notifier.h>
+
+namespace ucxx {
+
+typedef std::function<void(ucs_status_t)> NativeFutureCallbackType;
+typedef uint64_t NativeFutureCallbackId;
+
+class NativeFuture : public Future {
+ private:
+  std::mutex _mutex{};                          ///< Mutex to access the future's state
+  std::condition_variable _conditionVariable{};  ///< Condition variable to wait for completion
+  bool _completed{false};                       ///< Whether the future has been set
+  ucs_status_t _status{UCS_INPROGRESS};         ///< The completion status once set
+  std::vector<std::pair<NativeFutureCallbackId, NativeFutureCallbackType>>
+    _callbacks{};  ///< Continuations to execute once the future is set
+  NativeFutureCallbackId _nextCallbackId{1};  ///< Identifier of the next continuation
+
+  /**
+   * @brief Execute a continuation.
+   *
+   * Execute a continuation, logging and otherwise ignoring exceptions it raises.
+   *
+   * @param[in] callback  the continuation to execute.
+   * @param[in] status    the completion status of the future.
+   */
+  void runCallback(const NativeFutureCallbackType& callback, ucs_status_t status);
+
+  /**
+   * @brief Construct a future that may be notified from a notifier thread.
+   *
+   * Construct a future that may be notified from a notifier running on its own thread and
+   * thus will decrease overhead from the worker progress thread.
+   *
+   * @param[in] notifier  notifier object running on a separate thread.
+   */
+  explicit NativeFuture(std::shared_ptr<Notifier> notifier);
+
+ public:
+  NativeFuture()                    = delete;
+  NativeFuture(const NativeFuture&) = delete;
+  NativeFuture& operator=(NativeFuture const&) = delete;
+  NativeFuture(NativeFuture&& o)               = delete;
+  NativeFuture& operator=(NativeFuture&& o) = delete;
+
+  /**
+   * @brief Constructor of `shared_ptr<ucxx::NativeFuture>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::NativeFuture>` object. The default constructor
+   * is made private to ensure all UCXX objects are shared pointers and correct lifetime
+   * management.
+   *
+   * Native futures are created by a `ucxx::Worker` created with `enableFuture=true` for
+   * each request with future enabled, they are not usually created directly.
+   *
+   * @param[in] notifier  notifier object running on a separate thread.
+   *
+   * @returns The `shared_ptr<ucxx::NativeFuture>` object
+   */
+  friend std::shared_ptr<Future> createNativeFuture(std::shared_ptr<Notifier> notifier);
+
+  /**
+   * @brief Virtual destructor.
+   *
+   * Virtual destructor with empty implementation.
+   */
+  virtual ~NativeFuture();
+
+  /**
+   * @brief Inform the notifier thread that the future has completed.
+   *
+   * Inform the notifier thread that the future has completed so it can set the future
+   * status, awakening waiters and executing continuations from the notifier thread.
+   *
+   * @param[in] status  request completion status.
+   */
+  void notify(ucs_status_t status) override;
+
+  /**
+   * @brief Set the future completion status.
+   *
+   * Set the future status as completed, either with a successful completion or error,
+   * awakening all threads waiting on the future and executing all registered continuations
+   * from the calling thread. Only the first call has any effect, subsequent calls are
+   * ignored.
+   *
+   * @param[in] status  request completion status.
+   */
+  void set(ucs_status_t status) override;
+
+  /**
+   * @brief Get the underlying handle but does not release ownership.
+   *
+   * Get the underlying handle, which for a native future is the `ucxx::NativeFuture*`
+   * itself.
+   *
+   * @returns The underlying handle.
+   */
+  void* getHandle() override;
+
+  /**
+   * @brief Get the underlying handle.
+   *
+   * Native futures are owned by `std::shared_ptr`, thus ownership cannot be released and
+   * this is equivalent to `getHandle()`.
+   *
+   * @returns The underlying handle.
+   */
+  void* release() override;
+
+  /**
+   * @brief Check whether the future has been set.
+   *
+   * @returns `true` if the future has been set, `false` otherwise.
+   */
+  bool isCompleted();
+
+  /**
+   * @brief Get the completion status.
+   *
+   * @returns The completion status, or `UCS_INPROGRESS` if the future has not been set.
+   */
+  ucs_status_t getStatus();
+
+  /**
+   * @brief Block until the future is set.
+   *
+   * Block the calling thread until the future is set or a timeout occurred (only if
+   * `periodNs > 0`).
+   *
+   * @code{.cpp}
+   * // request is `std::shared_ptr<ucxx::Request>` submitted with future enabled
+   * auto future = std::dynamic_pointer_cast<ucxx::NativeFuture>(request->getFutureObject());
+   *
+   * // Wait for up to 1 second
+   * if (future->wait(1000000000)) ucxx::utils::ucsErrorThrow(future->getStatus());
+   * @endcode
+   *
+   * @param[in] periodNs  the time in nanoseconds to wait for completion, a period of zero
+   *                      means this call will block until the future is set.
+   *
+   * @returns `true` if the future has been set, `false` if a timeout occurred.
+   */
+  bool wait(uint64_t periodNs = 0);
+
+  /**
+   * @brief Register a continuation.
+   *
+   * Register a callback to execute once the future is set, receiving the completion
+   * status. Continuations are executed from the thread setting the future, usually the
+   * notifier thread, in registration order, or immediately from the calling thread if the
+   * future has already been set. Continuations must not block for long, as that delays
+   * notification of other futures, and must not release the last reference to the worker.
+   * Exceptions raised by continuations are logged and otherwise ignored.
+   *
+   * @param[in] callback  the continuation to execute.
+   *
+   * @returns The identifier of the continuation, which may be passed to
+   *          `removeContinuation()`, or `0` if it was executed immediately.
+   */
+  NativeFutureCallbackId then(NativeFutureCallbackType callback);
+
+  /**
+   * @brief Remove a continuation.
+   *
+   * Remove a continuation registered with `then()` that is no longer needed, so that it is
+   * not executed and the resources it holds are released without waiting for the future
+   * to be set.
+   *
+   * @param[in] id  the identifier returned by `then()`.
+   *
+   * @returns `true` if the continuation was removed, `false` if it has already been
+   *          executed, is executing or was never registered.
+   */
+  bool removeContinuation(NativeFutureCallbackId id);
+};
+
+/**
+ * @brief Block until all futures are set.
+ *
+ * Block the calling thread until all futures are set or a timeout occurred (only if
+ * `periodNs > 0`), the timeout applies to the entire group and not to each future.
+ *
+ * @param[in] futures   the futures to wait on.
+ * @param[in] periodNs  the time in nanoseconds to wait for completion, a period of zero
+ *                      means this call will block until all futures are set.
+ *
+ * @returns `true` if all futures have been set, `false` if a timeout occurred.
+ */
+bool waitAll(const std::vector<std::shared_ptr<NativeFuture>>& futures, uint64_t periodNs = 0);
+
+/**
+ * @brief Block until any future is set.
+ *
+ * Block the calling thread until at least one of the futures is set or a timeout occurred
+ * (only if `periodNs > 0`).
+ *
+ * @param[in] futures   the futures to wait on.
+ * @param[in] periodNs  the time in nanoseconds to wait for completion, a period of zero
+ *                      means this call will block until a future is set.
+ *
+ * @returns The index of a future that has been set, or `-1` if a timeout occurred or
+ *          `futures` is empty.
+ */
+int64_t waitAny(const std::vector<std::shared_ptr<NativeFuture>>& futures, uint64_t periodNs = 0);
+
+}  // namespace ucxx
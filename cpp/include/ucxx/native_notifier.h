@@ -0,0 +1,154 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/future.h>
+#include <ucxx/notifier.h>
+
+namespace ucxx {
+
+class NativeNotifier : public Notifier {
+ private:
+  /**
+   * @brief State shared between the notifier and its thread.
+   *
+   * The notifier thread holds its own reference to the state, thus the notifier may be
+   * destroyed when setting a future on the notifier thread releases its last reference.
+   */
+  struct State {
+    std::mutex mutex{};     ///< Mutex to access the state
+    std::mutex runMutex{};  ///< Mutex serializing calls to `notify()`
+    std::vector<std::pair<std::shared_ptr<Future>, ucs_status_t>>
+      futureStatus{};  ///< Container with futures and statuses to set
+    std::vector<std::pair<std::shared_ptr<Future>, ucs_status_t>>
+      batch{};          ///< Batch being notified, reused to avoid allocations
+    bool ready{false};  ///< Whether a future is scheduled for notification
+    RequestNotifierThreadState threadState{
+      RequestNotifierThreadState::NotRunning};  ///< State of the notifier thread
+    std::condition_variable cv{};               ///< Condition variable used to wait for event
+  };
+
+  std::shared_ptr<State> _state{std::make_shared<State>()};  ///< The shared state
+  std::thread _notifierThread{};  ///< Thread setting futures scheduled for notification
+
+  /**
+   * @brief Private constructor of `ucxx::NativeNotifier`.
+   *
+   * This is the internal `ucxx::NativeNotifier` constructor, made private not to be called
+   * directly. Instead the user should call `ucxx::createNativeNotifier()`.
+   */
+  NativeNotifier();
+
+  /**
+   * @brief The notifier thread loop.
+   *
+   * Block until futures are scheduled for notification and set them, until the notifier
+   * is stopped. Futures scheduled before the notifier was stopped are set before exiting.
+   *
+   * @param[in] state the notifier state.
+   */
+  static void run(std::shared_ptr<State> state);
+
+  /**
+   * @brief Set all pending completed futures of a notifier state.
+   *
+   * @param[in] state the notifier state.
+   */
+  static void notify(State& state);
+
+ public:
+  NativeNotifier(const NativeNotifier&) = delete;
+  NativeNotifier& operator=(NativeNotifier const&) = delete;
+  NativeNotifier(NativeNotifier&& o)               = delete;
+  NativeNotifier& operator=(NativeNotifier&& o) = delete;
+
+  /**
+   * @brief Constructor of `shared_ptr<ucxx::NativeNotifier>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::NativeNotifier>` object. The default
+   * constructor is made private to ensure all UCXX objects are shared pointers for correct
+   * lifetime management.
+   *
+   * The native notifier runs on its own thread, setting futures of completed requests
+   * outside of the worker progress thread. This allows threads waiting on a future to
+   * block instead of polling `ucxx::Request::isCompleted()`, and continuations to execute
+   * without delaying the worker progress thread.
+   *
+   * @returns The `shared_ptr<ucxx::NativeNotifier>` object
+   */
+  friend std::shared_ptr<Notifier> createNativeNotifier();
+
+  /**
+   * @brief Virtual destructor.
+   *
+   * Stops the notifier thread if it is still running.
+   */
+  virtual ~NativeNotifier();
+
+  /**
+   * @brief Schedule notification of completed future.
+   *
+   * Schedule the notification of a completed future, which is later set by the notifier
+   * thread. If the notifier thread has been stopped, the future is set immediately from
+   * the calling thread instead.
+   *
+   * This is meant to be called from `ucxx::NativeFuture::notify()`.
+   *
+   * @param[in] future  future to notify.
+   * @param[in] status  the request completion status.
+   */
+  void scheduleFutureNotify(std::shared_ptr<Future> future, ucs_status_t status) override;
+
+  /**
+   * @brief Wait for a new event with a timeout in nanoseconds.
+   *
+   * Block while waiting for an event (new future to be notified or stop signal) with added
+   * timeout in nanoseconds to unblock after a that period if no event has occurred. A
+   * period of zero means this call will never unblock until an event occurs. Futures are
+   * set by the notifier thread, thus calling this method is not required.
+   *
+   * @param[in] period the time in nanoseconds to wait for an event before unblocking.
+   */
+  RequestNotifierWaitState waitRequestNotifier(uint64_t period) override;
+
+  /**
+   * @brief Set all pending completed futures.
+   *
+   * Set all futures scheduled with `scheduleFutureNotify()`, draining them at once. This
+   * is called by the notifier thread, but may also be called from other threads to set
+   * pending futures eagerly, calls are serialized.
+   */
+  void runRequestNotifier() override;
+
+  /**
+   * @brief Get the file descriptor signaled when futures are ready to be notified.
+   *
+   * The native notifier is driven by its own thread and does not provide a file
+   * descriptor.
+   *
+   * @returns `-1`.
+   */
+  int getEventFileDescriptor() override;
+
+  /**
+   * @brief Stop the notifier thread.
+   *
+   * Stop the notifier thread after setting all futures already scheduled for
+   * notification, and block until it exits. Futures scheduled after the notifier thread
+   * has been stopped are set immediately from the thread scheduling them.
+   */
+  void stopRequestNotifierThread() override;
+};
+
+}  // namespace ucxx
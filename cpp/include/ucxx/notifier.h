@@ -72,6 +72,17 @@ class Notifier {
    */
   virtual void runRequestNotifier() = 0;
 
+  /**
+   * @brief Get the file descriptor signaled when futures are ready to be notified.
+   *
+   * Get a file descriptor that becomes readable when completed futures are scheduled
+   * with `scheduleFutureNotify()`, allowing an event loop to wait for them and call
+   * `runRequestNotifier()` without a dedicated notifier thread.
+   *
+   * @returns The file descriptor, or `-1` if not supported by the implementation.
+   */
+  virtual int getEventFileDescriptor() = 0;
+
   /**
    * @brief Make known to the notifier thread that it should stop.
    *
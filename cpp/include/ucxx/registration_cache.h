@@ -0,0 +1,229 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/context.h>
+#include <ucxx/memory_handle.h>
+
+namespace ucxx {
+
+class RegistrationCache : public Component {
+ private:
+  /**
+   * @brief A registered address range.
+   */
+  struct Entry {
+    std::shared_ptr<MemoryHandle> memoryHandle{nullptr};  ///< The registration
+    uint64_t end{0};                                      ///< End of the registered range
+    std::list<Entry*>::iterator recency{};                ///< Position in the recency list
+  };
+
+  typedef std::multimap<uint64_t, std::unique_ptr<Entry>> EntryMap;
+
+  size_t _maxBytes{0};                  ///< Maximum number of bytes kept registered
+  mutable std::shared_mutex _mutex{};   ///< Mutex to access the entries
+  EntryMap _entries{};                  ///< Registered ranges indexed by their base address
+  std::mutex _recencyMutex{};           ///< Mutex to reorder `_recency` under a shared lock
+  std::list<Entry*> _recency{};         ///< Entries from most to least recently used
+  size_t _maxEntryLength{0};            ///< Length of the largest registered range
+  size_t _cachedBytes{0};               ///< Number of bytes currently registered
+  std::atomic<uint64_t> _hits{0};       ///< Number of lookups served by a registration
+  std::atomic<uint64_t> _misses{0};     ///< Number of lookups that registered memory
+  std::atomic<uint64_t> _evictions{0};  ///< Number of registrations evicted
+
+  /**
+   * @brief Private constructor of `ucxx::RegistrationCache`.
+   *
+   * This is the internal implementation of `ucxx::RegistrationCache` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all
+   * UCXX objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Context::createRegistrationCache()`
+   * - `ucxx::createRegistrationCache()`
+   *
+   * @param[in] context   the `std::shared_ptr<Context>` parent component.
+   * @param[in] maxBytes  maximum number of bytes kept registered.
+   */
+  RegistrationCache(std::shared_ptr<Context> context, const size_t maxBytes);
+
+  /**
+   * @brief Find a registration covering an address range.
+   *
+   * Find a registration covering `[begin, end)`, must be called with `_mutex` held.
+   *
+   * @param[in] begin the first address of the range.
+   * @param[in] end   the address past the end of the range.
+   *
+   * @returns The entry covering the range, or `nullptr` if none does.
+   */
+  Entry* find(const uint64_t begin, const uint64_t end) const;
+
+  /**
+   * @brief Mark a registration as the most recently used.
+   *
+   * Move the entry to the front of the recency list in constant time, must be called with
+   * `_mutex` held, either shared or exclusively.
+   *
+   * @param[in] entry the entry that was looked up.
+   */
+  void touch(Entry* entry);
+
+  /**
+   * @brief Remove a registration.
+   *
+   * Remove the entry from both the address index and the recency list, must be called
+   * with `_mutex` held exclusively.
+   *
+   * @param[in] it  the position of the entry in the address index.
+   *
+   * @returns The position following the removed entry in the address index.
+   */
+  EntryMap::iterator erase(EntryMap::iterator it);
+
+  /**
+   * @brief Evict the least recently used registration.
+   *
+   * Evict the registration at the back of the recency list in constant time, must be
+   * called with `_mutex` held exclusively. The memory is unmapped once no user holds the
+   * handle anymore.
+   */
+  void evictLeastRecentlyUsed();
+
+ public:
+  static constexpr size_t defaultMaxBytes = 1ull << 30;  ///< Default maximum bytes registered
+
+  RegistrationCache()                         = delete;
+  RegistrationCache(const RegistrationCache&) = delete;
+  RegistrationCache& operator=(RegistrationCache const&) = delete;
+  RegistrationCache(RegistrationCache&& o)               = delete;
+  RegistrationCache& operator=(RegistrationCache&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::RegistrationCache>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::RegistrationCache>` object, caching memory
+   * registrations of a context so that buffers used repeatedly are only registered once.
+   * Registrations are indexed by address range, any lookup of a range within a cached
+   * registration is served by it. Once more than `maxBytes` are registered, the least
+   * recently used registrations are evicted.
+   *
+   * @code{.cpp}
+   * // context is `std::shared_ptr<ucxx::Context>`
+   * auto registrationCache = context->createRegistrationCache();
+   * auto memoryHandle = registrationCache->get(buffer, length);
+   * @endcode
+   *
+   * @param[in] context   the `std::shared_ptr<Context>` parent component.
+   * @param[in] maxBytes  maximum number of bytes kept registered.
+   *
+   * @returns The `shared_ptr<ucxx::RegistrationCache>` object
+   */
+  friend std::shared_ptr<RegistrationCache> createRegistrationCache(
+    std::shared_ptr<Context> context, const size_t maxBytes);
+
+  /**
+   * @brief Get a registration covering an address range.
+   *
+   * Get a registration covering `[address, address + length)`, registering the range if
+   * no cached registration covers it. Lookups served by a cached registration only take a
+   * shared lock and may proceed concurrently, while registering a new range is done
+   * without holding any lock. A registration larger than the cache capacity is returned
+   * without being cached.
+   *
+   * The memory must remain valid while the returned handle is in use. If it is released
+   * while a registration may still be cached, `invalidate()` must be called before the
+   * address range is reused.
+   *
+   * @throws ucxx::Error if the memory could not be registered.
+   *
+   * @param[in] address     the first address of the range.
+   * @param[in] length      the length in bytes of the range.
+   * @param[in] memoryType  the type of the memory, used when registering the range.
+   *
+   * @returns The memory handle of a registration covering the range.
+   */
+  std::shared_ptr<MemoryHandle> get(void* address,
+                                    const size_t length,
+                                    const ucs_memory_type_t memoryType = UCS_MEMORY_TYPE_HOST);
+
+  /**
+   * @brief Invalidate registrations overlapping an address range.
+   *
+   * Remove all cached registrations overlapping `[address, address + length)`, which must
+   * be called when memory that may be registered is released. Handles already returned
+   * remain valid until they are destroyed.
+   *
+   * @param[in] address the first address of the range.
+   * @param[in] length  the length in bytes of the range.
+   *
+   * @returns The number of registrations removed.
+   */
+  size_t invalidate(void* address, const size_t length);
+
+  /**
+   * @brief Remove all cached registrations.
+   *
+   * Remove all cached registrations, handles already returned remain valid until they
+   * are destroyed.
+   */
+  void clear();
+
+  /**
+   * @brief Get the number of lookups served by a cached registration.
+   *
+   * @returns The number of cache hits.
+   */
+  uint64_t getHits() const;
+
+  /**
+   * @brief Get the number of lookups that required registering memory.
+   *
+   * @returns The number of cache misses.
+   */
+  uint64_t getMisses() const;
+
+  /**
+   * @brief Get the number of registrations evicted to respect the capacity.
+   *
+   * @returns The number of evictions.
+   */
+  uint64_t getEvictions() const;
+
+  /**
+   * @brief Get the number of bytes currently registered by the cache.
+   *
+   * @returns The number of bytes currently registered.
+   */
+  size_t getCachedBytes() const;
+
+  /**
+   * @brief Get the maximum number of bytes kept registered by the cache.
+   *
+   * @returns The capacity of the cache in bytes.
+   */
+  size_t getMaxBytes() const;
+
+  /**
+   * @brief Get the number of cached registrations.
+   *
+   * @returns The number of cached registrations.
+   */
+  size_t getSize() const;
+};
+
+}  // namespace ucxx
@@ -0,0 +1,159 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/memory_handle.h>
+
+namespace ucxx {
+
+class RemoteKey : public Component {
+ private:
+  ucp_rkey_h _handle{nullptr};      ///< The unpacked UCP remote key, `nullptr` if local
+  std::string _packedRemoteKey{};  ///< The remote key packed by UCX
+  uint64_t _memoryBaseAddress{0};  ///< The base address of the remote memory
+  size_t _memorySize{0};           ///< The size of the remote memory
+
+  /**
+   * @brief Private constructor of `ucxx::RemoteKey` from a memory handle.
+   *
+   * This is the internal implementation of `ucxx::RemoteKey` constructor from a local
+   * memory handle, made private not to be called directly. This constructor is made
+   * private to ensure all UCXX objects are shared pointers and the correct lifetime
+   * management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::MemoryHandle::createRemoteKey()`
+   * - `ucxx::createRemoteKeyFromMemoryHandle()`
+   *
+   * @throws ucxx::Error if the remote key could not be packed.
+   *
+   * @param[in] memoryHandle  the `std::shared_ptr<MemoryHandle>` parent component.
+   */
+  explicit RemoteKey(std::shared_ptr<MemoryHandle> memoryHandle);
+
+  /**
+   * @brief Private constructor of `ucxx::RemoteKey` from a serialized remote key.
+   *
+   * This is the internal implementation of `ucxx::RemoteKey` constructor from a remote
+   * key serialized by the remote process, made private not to be called directly. This
+   * constructor is made private to ensure all UCXX objects are shared pointers and the
+   * correct lifetime management of each one.
+   *
+   * Instead the user should use `ucxx::createRemoteKeyFromSerialized()`.
+   *
+   * @throws std::runtime_error if `serializedRemoteKey` is malformed.
+   * @throws ucxx::Error        if the remote key could not be unpacked.
+   *
+   * @param[in] endpoint             the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] serializedRemoteKey  the remote key serialized by the remote process.
+   */
+  RemoteKey(std::shared_ptr<Endpoint> endpoint, const std::string& serializedRemoteKey);
+
+ public:
+  RemoteKey()                 = delete;
+  RemoteKey(const RemoteKey&) = delete;
+  RemoteKey& operator=(RemoteKey const&) = delete;
+  RemoteKey(RemoteKey&& o)               = delete;
+  RemoteKey& operator=(RemoteKey&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::RemoteKey>` from a memory handle.
+   *
+   * The constructor for a `shared_ptr<ucxx::RemoteKey>` object, packing the information
+   * a remote endpoint requires to access the memory mapped by `memoryHandle`. The remote
+   * key can then be serialized with `serialize()` and sent to the remote process, where
+   * it must be unpacked with `ucxx::createRemoteKeyFromSerialized()`.
+   *
+   * @code{.cpp}
+   * // memoryHandle is `std::shared_ptr<ucxx::MemoryHandle>`
+   * auto remoteKey = memoryHandle->createRemoteKey();
+   * auto serializedRemoteKey = remoteKey->serialize();
+   * // Send `serializedRemoteKey` to the remote process
+   * @endcode
+   *
+   * @throws ucxx::Error if the remote key could not be packed.
+   *
+   * @param[in] memoryHandle  the `std::shared_ptr<MemoryHandle>` parent component.
+   *
+   * @returns The `shared_ptr<ucxx::RemoteKey>` object
+   */
+  friend std::shared_ptr<RemoteKey> createRemoteKeyFromMemoryHandle(
+    std::shared_ptr<MemoryHandle> memoryHandle);
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::RemoteKey>` from a serialized remote key.
+   *
+   * The constructor for a `shared_ptr<ucxx::RemoteKey>` object, unpacking a remote key
+   * serialized by the remote process against the endpoint connected to it, after which
+   * the remote memory can be accessed with `ucxx::Endpoint::put()` and
+   * `ucxx::Endpoint::get()`.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * // serializedRemoteKey is `std::string` received from the remote process
+   * auto remoteKey = ucxx::createRemoteKeyFromSerialized(endpoint, serializedRemoteKey);
+   * @endcode
+   *
+   * @throws std::runtime_error if `serializedRemoteKey` is malformed.
+   * @throws ucxx::Error        if the remote key could not be unpacked.
+   *
+   * @param[in] endpoint             the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] serializedRemoteKey  the remote key serialized by the remote process.
+   *
+   * @returns The `shared_ptr<ucxx::RemoteKey>` object
+   */
+  friend std::shared_ptr<RemoteKey> createRemoteKeyFromSerialized(
+    std::shared_ptr<Endpoint> endpoint, const std::string& serializedRemoteKey);
+
+  ~RemoteKey();
+
+  /**
+   * @brief Get the underlying `ucp_rkey_h` handle.
+   *
+   * Lifetime of the `ucp_rkey_h` handle is managed by the `ucxx::RemoteKey` object and
+   * its ownership is non-transferrable. Once the `ucxx::RemoteKey` is destroyed the handle
+   * is not valid anymore, it is the user's responsibility to ensure the owner's lifetime
+   * while using the handle.
+   *
+   * @returns The underlying `ucp_rkey_h` handle, or `nullptr` if the remote key was
+   *          created from a local memory handle.
+   */
+  ucp_rkey_h getHandle();
+
+  /**
+   * @brief Get the base address of the remote memory.
+   *
+   * @returns The base address of the memory the remote key grants access to.
+   */
+  uint64_t getBaseAddress() const;
+
+  /**
+   * @brief Get the size of the remote memory.
+   *
+   * @returns The size in bytes of the memory the remote key grants access to.
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief Serialize the remote key.
+   *
+   * Serialize the remote key, including the base address and size of the memory, into a
+   * blob that can be sent to a remote process and unpacked there with
+   * `ucxx::createRemoteKeyFromSerialized()`.
+   *
+   * @returns The serialized remote key.
+   */
+  std::string serialize() const;
+};
+
+}  // namespace ucxx
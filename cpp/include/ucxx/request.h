@@ -8,12 +8,16 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include <ucp/api/ucp.h>
 
 #include <ucxx/component.h>
+#include <ucxx/delayed_submission.h>
 #include <ucxx/endpoint.h>
 #include <ucxx/future.h>
+#include <ucxx/inflight_requests.h>
+#include <ucxx/request_pool.h>
 #include <ucxx/typedefs.h>
 
 #define ucxx_trace_req_f(_owner, _req, _name, _message, ...) \
@@ -22,6 +26,26 @@
 namespace ucxx {
 
 class Request : public Component {
+  friend class InflightRequests;
+
+  template <class T, class... Args>
+  friend std::shared_ptr<T> allocateRequest(std::shared_ptr<Worker> worker, Args&&... args);
+
+  /**
+   * @brief Get the allocator for requests of a worker.
+   *
+   * Get the allocator for requests of `worker`, reserving room for the UCP request ahead of
+   * each request if the worker has user-allocated UCP request memory enabled.
+   *
+   * @param[in] worker      the worker, or `nullptr` to use the global `operator new`.
+   * @param[out] allocation where to store the address of the request if room for the UCP
+   *                        request is reserved, left untouched otherwise.
+   *
+   * @returns The allocator.
+   */
+  static RequestPoolAllocator<Request> getAllocator(std::shared_ptr<Worker> worker,
+                                                    void** allocation);
+
  protected:
   std::atomic<ucs_status_t> _status{UCS_INPROGRESS};  ///< Requests status
   std::string _status_msg{};                          ///< Human-readable status message
@@ -33,13 +57,13 @@ class Request : public Component {
     nullptr};  ///< Worker that generated request (if not from endpoint)
   std::shared_ptr<Endpoint> _endpoint{
     nullptr};  ///< Endpoint that generated request (if not from worker)
-  std::string _ownerString{
-    "undetermined owner"};  ///< String to print owner (endpoint or worker) when logging
-  std::shared_ptr<DelayedSubmission> _delayedSubmission{
-    nullptr};  ///< The submission object that will dispatch the request
-  std::string _operationName{
-    "request_undefined"};          ///< Human-readable operation name, mostly used for log messages
-  bool _enablePythonFuture{true};  ///< Whether Python future is enabled for this request
+  DelayedSubmission _delayedSubmission;  ///< The submission object that will dispatch the request
+  const char* _operationName{
+    "request_undefined"};  ///< Human-readable operation name, mostly used for log messages
+  bool _enablePythonFuture{true};     ///< Whether Python future is enabled for this request
+  void* _userRequestMemory{nullptr};  ///< User-allocated UCP request handle, or `nullptr`
+  mutable InflightRequestsHook
+    _inflightRequestsHook{};  ///< Hook to track the request in an `InflightRequests` container
 
   /**
    * @brief Protected constructor of an abstract `ucxx::Request`.
@@ -56,13 +80,15 @@ class Request : public Component {
    *                                `std::shared_ptr<Worker>`.
    * @param[in] delayedSubmission   the object to manage request submission.
    * @param[in] operationName       a human-readable operation name to help identifying
-   *                                requests by their types when UCXX logging is enabled.
+   *                                requests by their types when UCXX logging is enabled,
+   *                                must be a string literal or otherwise outlive the
+   *                                request.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
    */
   Request(std::shared_ptr<Component> endpointOrWorker,
-          std::shared_ptr<DelayedSubmission> delayedSubmission,
-          const std::string operationName,
+          const DelayedSubmission& delayedSubmission,
+          const char* operationName,
           const bool enablePythonFuture = false);
 
   /**
@@ -86,6 +112,39 @@ class Request : public Component {
    */
   void setStatus(ucs_status_t status);
 
+  /**
+   * @brief Place the UCP request in user-allocated memory if enabled.
+   *
+   * If the request was allocated with room for the UCP request, which is the case when
+   * the worker had user-allocated UCP request memory enabled at the time, set it in
+   * `param`. Otherwise do nothing, letting UCX allocate the UCP request. Must be called by
+   * the derived class before submitting the UCP operation.
+   *
+   * @param[in,out] param the UCP request parameters to be passed to the UCP operation.
+   */
+  void setUserRequestMemory(ucp_request_param_t& param);
+
+  /**
+   * @brief Register the request for submission.
+   *
+   * Register the request with the worker, which submits it either immediately or in its
+   * next progress iteration, see `ucxx::Worker::registerDelayedSubmission()`. Must be
+   * called by the factory once the request is allocated, rather than by its constructor,
+   * so that the UCP request may be placed in the memory reserved ahead of the request.
+   */
+  void registerSubmission();
+
+  /**
+   * @brief Get the length of the data transferred.
+   *
+   * Get the length in bytes of the data transferred by the completed request, reported in
+   * the records of the worker's completion queue. Defaults to the length the request was
+   * submitted with, requests that may receive less data than that must override it.
+   *
+   * @returns The length in bytes of the data transferred.
+   */
+  virtual size_t getTransferredLength() const;
+
  public:
   Request()               = delete;
   Request(const Request&) = delete;
@@ -107,7 +166,7 @@ class Request : public Component {
    * Cancel the request. Often called by the an error handler or parent's object
    * destructor but may be called by the user to cancel the request as well.
    */
-  void cancel();
+  virtual void cancel();
 
   /**
    * @brief Return the status of the request.
@@ -130,6 +189,36 @@ class Request : public Component {
    */
   void* getFuture();
 
+  /**
+   * @brief Return the `ucxx::Future` object notified upon completion.
+   *
+   * If the object has enabled future support, return the `ucxx::Future` object that is
+   * notified upon completion, returns `nullptr` otherwise. For workers created with native
+   * future support it may be cast to `ucxx::NativeFuture` to wait for completion.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>` created with `enableFuture=true`
+   * auto request = worker->tagRecv(buffer, length, tag, true);
+   * auto future  = std::dynamic_pointer_cast<ucxx::NativeFuture>(request->getFutureObject());
+   * future->wait();
+   * @endcode
+   *
+   * @returns the `ucxx::Future` object or `nullptr`.
+   */
+  std::shared_ptr<Future> getFutureObject();
+
+  /**
+   * @brief Get the underlying UCP request handle.
+   *
+   * Get the UCP request handle of a submitted operation that did not complete
+   * immediately, `nullptr` if the request has not been submitted or completed immediately,
+   * or a pointer encoding the error status if the submission failed. The handle must not
+   * be used after the request completed.
+   *
+   * @returns The UCP request handle.
+   */
+  void* getHandle() const;
+
   /**
    * @brief Check whether the request completed with an error.
    *
@@ -187,11 +276,36 @@ class Request : public Component {
    * Get a formatted string with owner type (worker or endpoint) and its respective handle
    * address. This is meant to get logging information for a request's callback, which is
    * not a member attribute of `ucxx::Request` or derived class, but a static method
-   * or external function instead.
+   * or external function instead. The string is formatted on each call, thus it should
+   * only be called when logging is enabled.
    *
    * @returns the formatted string containing the owner type and its handle.
    */
-  const std::string& getOwnerString() const;
+  std::string getOwnerString() const;
 };
 
+/**
+ * @brief Allocate a request from the pool of a worker.
+ *
+ * Allocate and construct a request of type `T` from the request pool of `worker`, placing
+ * the request and its reference count in a single block. If the worker has user-allocated
+ * UCP request memory enabled, the UCP request is placed immediately ahead of the request
+ * in that same block, thus requiring no allocation other than the request's own.
+ *
+ * @param[in] worker  the worker, or `nullptr` to use the global `operator new`.
+ * @param[in] args    arguments forwarded to the constructor of `T`.
+ *
+ * @returns The `shared_ptr<T>` object.
+ */
+template <class T, class... Args>
+std::shared_ptr<T> allocateRequest(std::shared_ptr<Worker> worker, Args&&... args)
+{
+  void* allocation = nullptr;
+  auto request     = std::allocate_shared<T>(
+    RequestPoolAllocator<T>(Request::getAllocator(std::move(worker), &allocation)),
+    std::forward<Args>(args)...);
+  request->_userRequestMemory = allocation;
+  return request;
+}
+
 }  // namespace ucxx
@@ -0,0 +1,223 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/buffer.h>
+#include <ucxx/delayed_submission.h>
+#include <ucxx/request.h>
+#include <ucxx/request_pool.h>
+#include <ucxx/typedefs.h>
+
+namespace ucxx {
+
+/**
+ * @brief An Active Message received by a worker.
+ *
+ * An Active Message passed to the handler registered with `ucxx::Worker::registerAmHandler()`
+ * for its identifier.
+ */
+struct AmMessage {
+  unsigned id{0};                           ///< Identifier of the handler sent to
+  ucs_status_t status{UCS_OK};              ///< `UCS_OK`, or the error fetching the data
+  std::string header{};                     ///< User-defined header sent with the message
+  void* data{nullptr};                      ///< Pointer to the message data
+  size_t length{0};                         ///< Length in bytes of the message data
+  std::shared_ptr<Buffer> buffer{nullptr};  ///< Owner of rendezvous `data`, `nullptr` if eager
+};
+
+class RequestAm : public Request {
+ private:
+  template <class T>
+  friend class RequestPoolAllocator;
+
+  unsigned _amId{0};                         ///< Identifier of the handler of the message
+  std::string _header{};                     ///< Header, kept alive until the send completes
+  void* _dataDescriptor{nullptr};            ///< UCX descriptor of rendezvous data to fetch
+  std::shared_ptr<Buffer> _buffer{nullptr};  ///< Buffer receiving rendezvous data
+  AmHandlerType _handler{nullptr};           ///< Handler to call once rendezvous data arrived
+  void* _handlerArg{nullptr};                ///< Argument to be passed to the handler
+
+  /**
+   * @brief Private constructor of an Active Message send `ucxx::RequestAm`.
+   *
+   * This is the internal implementation of `ucxx::RequestAm` send constructor, made
+   * private not to be called directly. This constructor is made private to ensure all UCXX
+   * objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Endpoint::amSend()`
+   * - `ucxx::createRequestAmSend()`
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] id                  the identifier of the handler on the remote worker.
+   * @param[in] header              the user-defined header to send with the message.
+   * @param[in] buffer              a raw pointer to the data to be sent.
+   * @param[in] length              the size in bytes of the data to be sent.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   */
+  RequestAm(std::shared_ptr<Endpoint> endpoint,
+            const unsigned id,
+            const std::string& header,
+            void* buffer,
+            size_t length,
+            const bool enablePythonFuture                               = false,
+            std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+            std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Private constructor of an Active Message rendezvous receive `ucxx::RequestAm`.
+   *
+   * This is the internal implementation of `ucxx::RequestAm` rendezvous receive
+   * constructor, made private not to be called directly. Instead the receive is created by
+   * `ucxx::Worker` when a rendezvous Active Message arrives, see
+   * `ucxx::createRequestAmRecvData()`.
+   *
+   * @param[in] worker          the `std::shared_ptr<Worker>` parent component.
+   * @param[in] id              the identifier of the handler the message was sent to.
+   * @param[in] header          the user-defined header received with the message.
+   * @param[in] dataDescriptor  the UCX descriptor of the data to fetch.
+   * @param[in] buffer          the buffer to fetch the data into.
+   * @param[in] handler         the handler to call once the data is fetched.
+   * @param[in] handlerArg      the argument to be passed to the handler.
+   */
+  RequestAm(std::shared_ptr<Worker> worker,
+            const unsigned id,
+            std::string header,
+            void* dataDescriptor,
+            std::shared_ptr<Buffer> buffer,
+            AmHandlerType handler,
+            void* handlerArg);
+
+ public:
+  /**
+   * @brief Constructor for `std::shared_ptr<ucxx::RequestAm>` sending an Active Message.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestAm>` object, creating an Active
+   * Message send request, returning a pointer to a request object that can be later
+   * awaited and checked for errors. This is a non-blocking operation, and the status of
+   * the transfer must be verified from the resulting request object before the data can be
+   * released. The header is copied and does not need to be kept alive by the caller.
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] id                  the identifier of the handler on the remote worker.
+   * @param[in] header              the user-defined header to send with the message.
+   * @param[in] buffer              a raw pointer to the data to be sent.
+   * @param[in] length              the size in bytes of the data to be sent.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestAm>` object
+   */
+  friend std::shared_ptr<RequestAm> createRequestAmSend(
+    std::shared_ptr<Endpoint> endpoint,
+    const unsigned id,
+    const std::string& header,
+    void* buffer,
+    size_t length,
+    const bool enablePythonFuture,
+    std::function<void(std::shared_ptr<void>)> callbackFunction,
+    std::shared_ptr<void> callbackData);
+
+  /**
+   * @brief Constructor for `std::shared_ptr<ucxx::RequestAm>` fetching rendezvous data.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestAm>` object, fetching the data of
+   * a rendezvous Active Message directly into `buffer` with `ucp_am_recv_data_nbx()`, and
+   * calling `handler` once the data has been fetched or fetching has failed. Must be
+   * called from the Active Message receive callback executed by UCX, and is not usually
+   * called directly.
+   *
+   * @param[in] worker          the `std::shared_ptr<Worker>` parent component.
+   * @param[in] id              the identifier of the handler the message was sent to.
+   * @param[in] header          the user-defined header received with the message.
+   * @param[in] dataDescriptor  the UCX descriptor of the data to fetch.
+   * @param[in] buffer          the buffer to fetch the data into, with at least the size
+   *                            of the data.
+   * @param[in] handler         the handler to call once the data is fetched.
+   * @param[in] handlerArg      the argument to be passed to the handler.
+   *
+   * @returns The `shared_ptr<ucxx::RequestAm>` object
+   */
+  friend std::shared_ptr<RequestAm> createRequestAmRecvData(std::shared_ptr<Worker> worker,
+                                                            const unsigned id,
+                                                            std::string header,
+                                                            void* dataDescriptor,
+                                                            std::shared_ptr<Buffer> buffer,
+                                                            AmHandlerType handler,
+                                                            void* handlerArg);
+
+  virtual void populateDelayedSubmission();
+
+  /**
+   * @brief Create and submit an Active Message request.
+   *
+   * This is the method that should be called to actually submit an Active Message send, or
+   * to fetch the data of a rendezvous Active Message. Sends are submitted from
+   * `populateDelayedSubmission()`, which is decided at the discretion of
+   * `std::shared_ptr<ucxx::Worker>`, whereas fetching rendezvous data is submitted
+   * immediately as it is always initiated by the worker progress.
+   */
+  void request();
+
+  /**
+   * @brief Call the handler with the rendezvous data fetched.
+   *
+   * Call the handler with the message whose data was fetched by this request, or with the
+   * error that occurred while fetching it. Any exception raised by the handler is logged
+   * and discarded, as the handler is called from the worker progress.
+   *
+   * WARNING: This is not intended to be called by the user, but it currently needs to be
+   * a public method so that UCX may access it.
+   */
+  void callHandler();
+
+  /**
+   * @brief Callback executed by UCX when an Active Message send request is completed.
+   *
+   * Callback executed by UCX when an Active Message send request is completed, that will
+   * dispatch `ucxx::Request::callback()`.
+   *
+   * WARNING: This is not intended to be called by the user, but it currently needs to be
+   * a public method so that UCX may access it. In future changes this will be moved to
+   * an internal object and remove this method from the public API.
+   *
+   * @param[in] request the UCX request pointer.
+   * @param[in] status  the completion status of the request.
+   * @param[in] arg     the pointer to the `ucxx::Request` object that created the
+   *                    transfer, effectively `this` pointer as seen by `request()`.
+   */
+  static void amSendCallback(void* request, ucs_status_t status, void* arg);
+
+  /**
+   * @brief Callback executed by UCX when rendezvous data has been fetched.
+   *
+   * Callback executed by UCX when the data of a rendezvous Active Message has been
+   * fetched, that will dispatch `ucxx::Request::callback()` and then call the handler.
+   *
+   * WARNING: This is not intended to be called by the user, but it currently needs to be
+   * a public method so that UCX may access it. In future changes this will be moved to
+   * an internal object and remove this method from the public API.
+   *
+   * @param[in] request the UCX request pointer.
+   * @param[in] status  the completion status of the request.
+   * @param[in] length  the length in bytes of the data fetched.
+   * @param[in] arg     the pointer to the `ucxx::Request` object that created the
+   *                    transfer, effectively `this` pointer as seen by `request()`.
+   */
+  static void amRecvDataCallback(void* request, ucs_status_t status, size_t length, void* arg);
+};
+
+}  // namespace ucxx
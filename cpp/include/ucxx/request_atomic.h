@@ -0,0 +1,160 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+#include <functional>
+#include <memory>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/remote_key.h>
+#include <ucxx/request.h>
+#include <ucxx/request_pool.h>
+#include <ucxx/typedefs.h>
+
+namespace ucxx {
+
+class RequestAtomic : public Request {
+ private:
+  template <class T>
+  friend class RequestPoolAllocator;
+
+  ucp_atomic_op_t _opcode{UCP_ATOMIC_OP_ADD};      ///< The atomic operation to perform
+  bool _fetch{false};                              ///< Whether the previous value is fetched
+  uint64_t _value{0};                              ///< The operand of the atomic operation
+  uint64_t* _result{nullptr};                      ///< Where the previous remote value is stored
+  uint64_t _remoteAddress{0};                      ///< The remote address to operate on
+  std::shared_ptr<RemoteKey> _remoteKey{nullptr};  ///< The remote key of the remote memory
+
+  /**
+   * @brief Private constructor of `ucxx::RequestAtomic`.
+   *
+   * This is the internal implementation of `ucxx::RequestAtomic` constructor, made private
+   * not to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Endpoint::atomicAdd()`
+   * - `ucxx::Endpoint::fetchAdd()`
+   * - `ucxx::Endpoint::compareSwap()`
+   * - `ucxx::Endpoint::swap()`
+   * - `ucxx::createRequestAtomic()`
+   *
+   * @throws std::out_of_range if the remote value is not within the remote memory.
+   * @throws std::invalid_argument if `result` does not match `fetch`, or if `fetch` is
+   *                               `false` for an operation other than `UCP_ATOMIC_OP_ADD`.
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] opcode              the atomic operation, one of `UCP_ATOMIC_OP_ADD`,
+   *                                `UCP_ATOMIC_OP_SWAP` or `UCP_ATOMIC_OP_CSWAP`.
+   * @param[in] fetch               whether the remote value prior to the operation is
+   *                                fetched into `result`, may only be `false` for
+   *                                `UCP_ATOMIC_OP_ADD`.
+   * @param[in] value               the operand of the atomic operation.
+   * @param[in] compare             the value compared with the remote value, only used by
+   *                                `UCP_ATOMIC_OP_CSWAP`.
+   * @param[in] result              where the remote value prior to the operation is
+   *                                stored, must be `nullptr` if and only if `fetch` is
+   *                                `false`.
+   * @param[in] remoteAddress       the address of the remote 64-bit value.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   */
+  RequestAtomic(std::shared_ptr<Endpoint> endpoint,
+                const ucp_atomic_op_t opcode,
+                const bool fetch,
+                const uint64_t value,
+                const uint64_t compare,
+                uint64_t* result,
+                uint64_t remoteAddress,
+                std::shared_ptr<RemoteKey> remoteKey,
+                const bool enablePythonFuture                               = false,
+                std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+                std::shared_ptr<void> callbackData                          = nullptr);
+
+ public:
+  /**
+   * @brief Constructor for `std::shared_ptr<ucxx::RequestAtomic>`.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestAtomic>` object, creating a remote
+   * atomic operation on a 64-bit value, returning a pointer to a request object that can
+   * be later awaited and checked for errors. The remote process is not involved in the
+   * operation, which may be performed by the network hardware when supported by the
+   * transport. When `result` is specified, it must remain valid until the request
+   * completes, at which point it holds the remote value prior to the operation.
+   *
+   * @throws std::out_of_range if the remote value is not within the remote memory.
+   * @throws std::invalid_argument if `result` does not match `fetch`, or if `fetch` is
+   *                               `false` for an operation other than `UCP_ATOMIC_OP_ADD`.
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] opcode              the atomic operation, one of `UCP_ATOMIC_OP_ADD`,
+   *                                `UCP_ATOMIC_OP_SWAP` or `UCP_ATOMIC_OP_CSWAP`.
+   * @param[in] fetch               whether the remote value prior to the operation is
+   *                                fetched into `result`, may only be `false` for
+   *                                `UCP_ATOMIC_OP_ADD`.
+   * @param[in] value               the operand of the atomic operation.
+   * @param[in] compare             the value compared with the remote value, only used by
+   *                                `UCP_ATOMIC_OP_CSWAP`.
+   * @param[in] result              where the remote value prior to the operation is
+   *                                stored, must be `nullptr` if and only if `fetch` is
+   *                                `false`.
+   * @param[in] remoteAddress       the address of the remote 64-bit value.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestAtomic>` object
+   */
+  friend std::shared_ptr<RequestAtomic> createRequestAtomic(
+    std::shared_ptr<Endpoint> endpoint,
+    const ucp_atomic_op_t opcode,
+    const bool fetch,
+    const uint64_t value,
+    const uint64_t compare,
+    uint64_t* result,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture,
+    std::function<void(std::shared_ptr<void>)> callbackFunction,
+    std::shared_ptr<void> callbackData);
+
+  virtual void populateDelayedSubmission();
+
+  /**
+   * @brief Create and submit an atomic request.
+   *
+   * This is the method that should be called to actually submit an atomic request. It is
+   * meant to be called from `populateDelayedSubmission()`, which is decided at the
+   * discretion of `std::shared_ptr<ucxx::Worker>`. See `populateDelayedSubmission()` for
+   * more details.
+   */
+  void request();
+
+  /**
+   * @brief Callback executed by UCX when an atomic request is completed.
+   *
+   * Callback executed by UCX when an atomic request is completed, that will dispatch
+   * `ucxx::Request::callback()`.
+   *
+   * WARNING: This is not intended to be called by the user, but it currently needs to be
+   * a public method so that UCX may access it. In future changes this will be moved to
+   * an internal object and remove this method from the public API.
+   *
+   * @param[in] request the UCX request pointer.
+   * @param[in] status  the completion status of the request.
+   * @param[in] arg     the pointer to the `ucxx::Request` object that created the
+   *                    transfer, effectively `this` pointer as seen by `request()`.
+   */
+  static void atomicCallback(void* request, ucs_status_t status, void* arg);
+};
+
+}  // namespace ucxx
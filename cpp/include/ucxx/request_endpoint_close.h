@@ -0,0 +1,129 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/request.h>
+#include <ucxx/request_pool.h>
+#include <ucxx/typedefs.h>
+
+namespace ucxx {
+
+class RequestEndpointClose : public Request {
+ private:
+  template <class T>
+  friend class RequestPoolAllocator;
+
+  EndpointCloseMode _mode{EndpointCloseMode::Flush};  ///< Whether to flush or force close
+
+  /**
+   * @brief Private constructor of `ucxx::RequestEndpointClose`.
+   *
+   * This is the internal implementation of `ucxx::RequestEndpointClose` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all UCXX
+   * objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Endpoint::closeAsync()`
+   * - `ucxx::Worker::closeEndpoints()`
+   * - `ucxx::createRequestEndpointClose()`
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] mode                whether to flush outstanding operations or force close.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   */
+  RequestEndpointClose(std::shared_ptr<Endpoint> endpoint,
+                       const EndpointCloseMode mode,
+                       const bool enablePythonFuture                               = false,
+                       std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+                       std::shared_ptr<void> callbackData                          = nullptr);
+
+ public:
+  /**
+   * @brief Constructor for `std::shared_ptr<ucxx::RequestEndpointClose>`.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestEndpointClose>` object, creating a
+   * request to close the endpoint without blocking, returning a pointer to a request object
+   * that can be later awaited and checked for errors. Once the request is submitted by the
+   * worker the endpoint is closed and must not be used anymore, the request completes once
+   * UCX has released its resources.
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] mode                whether to flush outstanding operations or force close.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestEndpointClose>` object
+   */
+  friend std::shared_ptr<RequestEndpointClose> createRequestEndpointClose(
+    std::shared_ptr<Endpoint> endpoint,
+    const EndpointCloseMode mode,
+    const bool enablePythonFuture,
+    std::function<void(std::shared_ptr<void>)> callbackFunction,
+    std::shared_ptr<void> callbackData);
+
+  /**
+   * @brief Constructor for a batch of `std::shared_ptr<ucxx::RequestEndpointClose>`.
+   *
+   * Create one close request for each endpoint without registering them for delayed
+   * submission, the caller must register all requests at once, usually with
+   * `ucxx::Worker::registerDelayedSubmissionBatch()`, thus paying for a single worker
+   * wakeup regardless of the number of endpoints. All endpoints must belong to the same
+   * worker.
+   *
+   * @param[in] endpoints           the endpoints to close.
+   * @param[in] mode                whether to flush outstanding operations or force close.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   *
+   * @returns The requests, in the same order as `endpoints`.
+   */
+  friend std::vector<std::shared_ptr<Request>> createRequestEndpointCloseBatch(
+    const std::vector<std::shared_ptr<Endpoint>>& endpoints,
+    const EndpointCloseMode mode,
+    const bool enablePythonFuture);
+
+  virtual void populateDelayedSubmission();
+
+  /**
+   * @brief Create and submit an endpoint close request.
+   *
+   * This is the method that should be called to actually submit an endpoint close request.
+   * It is meant to be called from `populateDelayedSubmission()`, which is decided at the
+   * discretion of `std::shared_ptr<ucxx::Worker>`. See `populateDelayedSubmission()` for
+   * more details.
+   */
+  void request();
+
+  /**
+   * @brief Callback executed by UCX when an endpoint close request is completed.
+   *
+   * Callback executed by UCX when an endpoint close request is completed, that will
+   * dispatch `ucxx::Request::callback()`.
+   *
+   * WARNING: This is not intended to be called by the user, but it currently needs to be
+   * a public method so that UCX may access it. In future changes this will be moved to
+   * an internal object and remove this method from the public API.
+   *
+   * @param[in] request the UCX request pointer.
+   * @param[in] status  the completion status of the request.
+   * @param[in] arg     the pointer to the `ucxx::Request` object that created the
+   *                    transfer, effectively `this` pointer as seen by `request()`.
+   */
+  static void endpointCloseCallback(void* request, ucs_status_t status, void* arg);
+};
+
+}  // namespace ucxx
@@ -0,0 +1,113 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+#include <sys/socket.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/request.h>
+#include <ucxx/request_pool.h>
+#include <ucxx/typedefs.h>
+
+namespace ucxx {
+
+class RequestEndpointCreate : public Request {
+ private:
+  template <class T>
+  friend class RequestPoolAllocator;
+
+  std::string _ipAddress{};                         ///< Hostname or IP address to connect to
+  uint16_t _port{0};                                ///< Port to connect to
+  bool _endpointErrorHandling{true};                ///< Whether to enable endpoint error handling
+  ucs_status_t _resolveStatus{UCS_OK};              ///< Status of the hostname resolution
+  sockaddr_storage _address{};                      ///< The resolved address
+  socklen_t _addressLength{0};                      ///< Length of the resolved address
+  std::shared_ptr<Endpoint> _newEndpoint{nullptr};  ///< The endpoint created
+
+  /**
+   * @brief Private constructor of `ucxx::RequestEndpointCreate`.
+   *
+   * This is the internal implementation of `ucxx::RequestEndpointCreate` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all UCXX
+   * objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Worker::createEndpointFromHostnameAsync()`
+   * - `ucxx::createRequestEndpointCreate()`
+   *
+   * @param[in] worker                the `std::shared_ptr<Worker>` parent component.
+   * @param[in] ipAddress             hostname or IP address the listener is bound to.
+   * @param[in] port                  port the listener is bound to.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   * @param[in] enablePythonFuture    whether a python future should be created and
+   *                                  subsequently notified.
+   * @param[in] callbackFunction      user-defined callback function to call upon completion.
+   * @param[in] callbackData          user-defined data to pass to the `callbackFunction`.
+   */
+  RequestEndpointCreate(std::shared_ptr<Worker> worker,
+                        std::string ipAddress,
+                        uint16_t port,
+                        bool endpointErrorHandling,
+                        const bool enablePythonFuture                               = false,
+                        std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+                        std::shared_ptr<void> callbackData                          = nullptr);
+
+ public:
+  /**
+   * @brief Constructor for `std::shared_ptr<ucxx::RequestEndpointCreate>`.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestEndpointCreate>` object, creating
+   * a request to resolve the hostname without blocking on the worker's
+   * `ucxx::HostnameResolver` and subsequently create the endpoint, returning a pointer to
+   * a request object that can be later awaited and checked for errors. The request
+   * completes once the endpoint is created, which is then available via `getEndpoint()`.
+   *
+   * @param[in] worker                the `std::shared_ptr<Worker>` parent component.
+   * @param[in] ipAddress             hostname or IP address the listener is bound to.
+   * @param[in] port                  port the listener is bound to.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   * @param[in] enablePythonFuture    whether a python future should be created and
+   *                                  subsequently notified.
+   * @param[in] callbackFunction      user-defined callback function to call upon completion.
+   * @param[in] callbackData          user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestEndpointCreate>` object
+   */
+  friend std::shared_ptr<RequestEndpointCreate> createRequestEndpointCreate(
+    std::shared_ptr<Worker> worker,
+    std::string ipAddress,
+    uint16_t port,
+    bool endpointErrorHandling,
+    const bool enablePythonFuture,
+    std::function<void(std::shared_ptr<void>)> callbackFunction,
+    std::shared_ptr<void> callbackData);
+
+  /**
+   * @brief Create the endpoint once the hostname is resolved.
+   *
+   * Create the endpoint from the resolved address, or complete the request with the
+   * resolution error. Called by the worker, either immediately after the hostname is
+   * resolved or by the worker progress thread if delayed submission is enabled.
+   */
+  virtual void populateDelayedSubmission();
+
+  /**
+   * @brief Get the endpoint created.
+   *
+   * Get the endpoint created by this request, only valid once the request has completed
+   * successfully.
+   *
+   * @returns The endpoint created, or `nullptr` if not completed successfully.
+   */
+  std::shared_ptr<Endpoint> getEndpoint();
+};
+
+}  // namespace ucxx
@@ -0,0 +1,99 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+#include <functional>
+#include <memory>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/request.h>
+#include <ucxx/request_pool.h>
+#include <ucxx/typedefs.h>
+
+namespace ucxx {
+
+class RequestFlush : public Request {
+ private:
+  template <class T>
+  friend class RequestPoolAllocator;
+
+  /**
+   * @brief Private constructor of `ucxx::RequestFlush`.
+   *
+   * This is the internal implementation of `ucxx::RequestFlush` constructor, made private
+   * not to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Endpoint::flush()`
+   * - `ucxx::createRequestFlush()`
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   */
+  RequestFlush(std::shared_ptr<Endpoint> endpoint,
+               const bool enablePythonFuture                               = false,
+               std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+               std::shared_ptr<void> callbackData                          = nullptr);
+
+ public:
+  /**
+   * @brief Constructor for `std::shared_ptr<ucxx::RequestFlush>`.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestFlush>` object, creating a flush
+   * request that completes once all one-sided operations previously issued on the
+   * endpoint have completed remotely, returning a pointer to a request object that can be
+   * later awaited and checked for errors.
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestFlush>` object
+   */
+  friend std::shared_ptr<RequestFlush> createRequestFlush(
+    std::shared_ptr<Endpoint> endpoint,
+    const bool enablePythonFuture,
+    std::function<void(std::shared_ptr<void>)> callbackFunction,
+    std::shared_ptr<void> callbackData);
+
+  virtual void populateDelayedSubmission();
+
+  /**
+   * @brief Create and submit a flush request.
+   *
+   * This is the method that should be called to actually submit a flush request. It is
+   * meant to be called from `populateDelayedSubmission()`, which is decided at the
+   * discretion of `std::shared_ptr<ucxx::Worker>`. See `populateDelayedSubmission()` for
+   * more details.
+   */
+  void request();
+
+  /**
+   * @brief Callback executed by UCX when a flush request is completed.
+   *
+   * Callback executed by UCX when a flush request is completed, that will dispatch
+   * `ucxx::Request::callback()`.
+   *
+   * WARNING: This is not intended to be called by the user, but it currently needs to be
+   * a public method so that UCX may access it. In future changes this will be moved to
+   * an internal object and remove this method from the public API.
+   *
+   * @param[in] request the UCX request pointer.
+   * @param[in] status  the completion status of the request.
+   * @param[in] arg     the pointer to the `ucxx::Request` object that created the
+   *                    transfer, effectively `this` pointer as seen by `request()`.
+   */
+  static void flushCallback(void* request, ucs_status_t status, void* arg);
+};
+
+}  // namespace ucxx
@@ -0,0 +1,133 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+#include <functional>
+#include <memory>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/remote_key.h>
+#include <ucxx/request.h>
+#include <ucxx/request_pool.h>
+#include <ucxx/typedefs.h>
+
+namespace ucxx {
+
+class RequestMem : public Request {
+ private:
+  template <class T>
+  friend class RequestPoolAllocator;
+
+  uint64_t _remoteAddress{0};                   ///< The remote address to access
+  std::shared_ptr<RemoteKey> _remoteKey{nullptr};  ///< The remote key of the remote memory
+
+  /**
+   * @brief Private constructor of `ucxx::RequestMem`.
+   *
+   * This is the internal implementation of `ucxx::RequestMem` constructor, made private
+   * not to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Endpoint::put()`
+   * - `ucxx::Endpoint::get()`
+   * - `ucxx::createRequestMem()`
+   *
+   * @throws std::out_of_range if the remote range is not within the remote memory.
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] put                 whether this is a put (`true`) or get (`false`) request.
+   * @param[in] buffer              a raw pointer to the local data to be written to remote
+   *                                memory (put) or where remote data is read into (get).
+   * @param[in] length              the size in bytes of the data to be transferred.
+   * @param[in] remoteAddress       the address of the remote memory to access.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   */
+  RequestMem(std::shared_ptr<Endpoint> endpoint,
+             const bool put,
+             void* buffer,
+             size_t length,
+             uint64_t remoteAddress,
+             std::shared_ptr<RemoteKey> remoteKey,
+             const bool enablePythonFuture                               = false,
+             std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+             std::shared_ptr<void> callbackData                          = nullptr);
+
+ public:
+  /**
+   * @brief Constructor for `std::shared_ptr<ucxx::RequestMem>`.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestMem>` object, creating a one-sided
+   * put or get request, returning a pointer to a request object that can be later awaited
+   * and checked for errors. This is a non-blocking operation, and the status of the
+   * transfer must be verified from the resulting request object before the data can be
+   * released (for a put operation) or consumed (for a get operation). The remote process
+   * is not involved in the transfer and is not notified of its completion, a completed
+   * put is only guaranteed to be visible remotely after `ucxx::Endpoint::flush()`.
+   *
+   * @throws std::out_of_range if the remote range is not within the remote memory.
+   *
+   * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component.
+   * @param[in] put                 whether this is a put (`true`) or get (`false`) request.
+   * @param[in] buffer              a raw pointer to the local data to be written to remote
+   *                                memory (put) or where remote data is read into (get).
+   * @param[in] length              the size in bytes of the data to be transferred.
+   * @param[in] remoteAddress       the address of the remote memory to access.
+   * @param[in] remoteKey           the remote key of the remote memory.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestMem>` object
+   */
+  friend std::shared_ptr<RequestMem> createRequestMem(
+    std::shared_ptr<Endpoint> endpoint,
+    const bool put,
+    void* buffer,
+    size_t length,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture,
+    std::function<void(std::shared_ptr<void>)> callbackFunction,
+    std::shared_ptr<void> callbackData);
+
+  virtual void populateDelayedSubmission();
+
+  /**
+   * @brief Create and submit a one-sided request.
+   *
+   * This is the method that should be called to actually submit a put or get request. It
+   * is meant to be called from `populateDelayedSubmission()`, which is decided at the
+   * discretion of `std::shared_ptr<ucxx::Worker>`. See `populateDelayedSubmission()` for
+   * more details.
+   */
+  void request();
+
+  /**
+   * @brief Callback executed by UCX when a one-sided request is completed.
+   *
+   * Callback executed by UCX when a put or get request is completed, that will dispatch
+   * `ucxx::Request::callback()`.
+   *
+   * WARNING: This is not intended to be called by the user, but it currently needs to be
+   * a public method so that UCX may access it. In future changes this will be moved to
+   * an internal object and remove this method from the public API.
+   *
+   * @param[in] request the UCX request pointer.
+   * @param[in] status  the completion status of the request.
+   * @param[in] arg     the pointer to the `ucxx::Request` object that created the
+   *                    transfer, effectively `this` pointer as seen by `request()`.
+   */
+  static void memCallback(void* request, ucs_status_t status, void* arg);
+};
+
+}  // namespace ucxx
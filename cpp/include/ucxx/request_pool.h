@@ -0,0 +1,232 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace ucxx {
+
+class RequestPool {
+ private:
+  /**
+   * @brief A block of memory in a free list.
+   *
+   * Free blocks are reused to store the free list itself, thus requiring no additional
+   * memory to keep track of them.
+   */
+  struct FreeBlock {
+    FreeBlock* _next{nullptr};  ///< The next free block of the same size class
+  };
+
+  static constexpr size_t _sizeClassGranularity = 64;  ///< Size difference between classes
+  static constexpr size_t _numSizeClasses = 16;  ///< Number of size classes, up to 1KiB blocks
+
+  std::mutex _mutex{};  ///< Mutex to control access to the free lists
+  std::array<FreeBlock*, _numSizeClasses> _freeLists{};  ///< Free list of each size class
+  std::array<size_t, _numSizeClasses> _freeCounts{};  ///< Number of blocks in each free list
+  const size_t _maxCachedBlocks{0};  ///< Maximum number of free blocks kept per size class
+
+  /**
+   * @brief Get the size class of an allocation.
+   *
+   * @param[in] size the size in bytes of the allocation.
+   *
+   * @returns The index of the size class, equal to or larger than `_numSizeClasses` if
+   *          the allocation is too large to be pooled.
+   */
+  static size_t getSizeClass(const size_t size);
+
+ public:
+  static constexpr size_t defaultMaxCachedBlocks =
+    1024;  ///< Default maximum number of free blocks kept per size class
+
+  /**
+   * @brief Constructor of a request pool.
+   *
+   * Construct a thread-safe pool of memory blocks used to allocate requests. Blocks are
+   * grouped in size classes, each with its own free list, blocks released to the pool are
+   * reused by subsequent allocations of the same size class, thus requests allocated in
+   * steady-state do not require any heap allocations. Allocations larger than the largest
+   * size class are forwarded to the global `operator new`.
+   *
+   * @code{.cpp}
+   * auto pool = std::make_shared<ucxx::RequestPool>();
+   *
+   * // Allocate a request from the pool, `endpoint` is `std::shared_ptr<ucxx::Endpoint>`
+   * auto request = ucxx::allocateRequest<ucxx::RequestTag>(pool, endpoint, true, buffer, 8, 0);
+   * @endcode
+   *
+   * @param[in] maxCachedBlocks maximum number of free blocks kept per size class, blocks
+   *                            released beyond that are returned to the system.
+   */
+  explicit RequestPool(const size_t maxCachedBlocks = defaultMaxCachedBlocks);
+
+  RequestPool(const RequestPool&) = delete;
+  RequestPool& operator=(RequestPool const&) = delete;
+  RequestPool(RequestPool&& o)               = delete;
+  RequestPool& operator=(RequestPool&& o) = delete;
+
+  /**
+   * @brief Destructor of a request pool.
+   *
+   * Return all cached free blocks to the system.
+   */
+  ~RequestPool();
+
+  /**
+   * @brief Allocate a block of memory.
+   *
+   * Allocate a block of memory of at least `size` bytes, reusing a free block of the same
+   * size class if one is available.
+   *
+   * @param[in] size the size in bytes of the block to allocate.
+   *
+   * @throws std::bad_alloc if the allocation failed.
+   *
+   * @returns A pointer to the allocated block.
+   */
+  void* allocate(const size_t size);
+
+  /**
+   * @brief Deallocate a block of memory.
+   *
+   * Deallocate a block of memory previously allocated with `allocate()`, keeping it cached
+   * for reuse unless the free list of its size class is full.
+   *
+   * @param[in] ptr   pointer to the block to deallocate.
+   * @param[in] size  the size in bytes the block was allocated with.
+   */
+  void deallocate(void* ptr, const size_t size) noexcept;
+
+  /**
+   * @brief Get the number of cached free blocks.
+   *
+   * @returns The total number of free blocks cached in all size classes.
+   */
+  size_t getCachedBlocks();
+};
+
+/**
+ * @brief Allocator of requests backed by a `ucxx::RequestPool`.
+ *
+ * An allocator meeting the standard allocator requirements, intended to be used with
+ * `std::allocate_shared` so that the request and its reference count are placed in a single
+ * block from the pool. The allocator holds a reference to the pool, ensuring the pool
+ * outlives all requests allocated from it. If no pool is specified, allocations are
+ * forwarded to the global `operator new`.
+ *
+ * Optionally, a headroom of bytes is reserved immediately ahead of each allocation within
+ * the same block, such as the memory UCX requires preceding a user-allocated UCP request
+ * handle.
+ */
+template <class T>
+class RequestPoolAllocator {
+ private:
+  template <class U>
+  friend class RequestPoolAllocator;
+
+  std::shared_ptr<RequestPool> _pool{nullptr};  ///< The pool to allocate from
+  size_t _headroom{0};                          ///< Bytes reserved ahead of each allocation
+  void** _allocation{nullptr};  ///< Where to store the address of the latest allocation
+
+ public:
+  typedef T value_type;
+
+  static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                "Over-aligned types are not supported by RequestPoolAllocator");
+
+  /**
+   * @brief Constructor of the allocator.
+   *
+   * @param[in] pool        the pool to allocate from, or `nullptr` to use the global
+   *                        `operator new`.
+   * @param[in] headroom    bytes reserved immediately ahead of each allocation, must be a
+   *                        multiple of `__STDCPP_DEFAULT_NEW_ALIGNMENT__`.
+   * @param[out] allocation where to store the address of each allocation, may be
+   *                        `nullptr`. Must remain valid until the allocation is performed.
+   */
+  explicit RequestPoolAllocator(std::shared_ptr<RequestPool> pool,
+                                const size_t headroom = 0,
+                                void** allocation     = nullptr) noexcept
+    : _pool(std::move(pool)), _headroom(headroom), _allocation(allocation)
+  {
+  }
+
+  template <class U>
+  RequestPoolAllocator(const RequestPoolAllocator<U>& o) noexcept
+    : _pool(o._pool), _headroom(o._headroom), _allocation(o._allocation)
+  {
+  }
+
+  T* allocate(const size_t n)
+  {
+    const size_t size = _headroom + n * sizeof(T);
+    void* block       = _pool == nullptr ? ::operator new(size) : _pool->allocate(size);
+    auto ptr          = reinterpret_cast<T*>(static_cast<char*>(block) + _headroom);
+    if (_allocation != nullptr) *_allocation = ptr;
+    return ptr;
+  }
+
+  void deallocate(T* ptr, const size_t n) noexcept
+  {
+    void* block = reinterpret_cast<char*>(ptr) - _headroom;
+    if (_pool == nullptr)
+      ::operator delete(block);
+    else
+      _pool->deallocate(block, _headroom + n * sizeof(T));
+  }
+
+  /**
+   * @brief Construct an object in-place.
+   *
+   * Construct an object in-place, request classes declare the allocator as friend so that
+   * their private constructors remain inaccessible to users.
+   *
+   * @param[in] ptr   pointer to the memory where the object is constructed.
+   * @param[in] args  arguments forwarded to the constructor of `U`.
+   */
+  template <class U, class... Args>
+  void construct(U* ptr, Args&&... args)
+  {
+    ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+  }
+
+  template <class U>
+  bool operator==(const RequestPoolAllocator<U>& o) const noexcept
+  {
+    return _pool == o._pool && _headroom == o._headroom;
+  }
+
+  template <class U>
+  bool operator!=(const RequestPoolAllocator<U>& o) const noexcept
+  {
+    return !(*this == o);
+  }
+};
+
+/**
+ * @brief Allocate a request from a pool.
+ *
+ * Allocate and construct a request of type `T` from `pool`, placing the request and its
+ * reference count in a single block.
+ *
+ * @param[in] pool  the pool to allocate from, or `nullptr` to use the global `operator new`.
+ * @param[in] args  arguments forwarded to the constructor of `T`.
+ *
+ * @returns The `shared_ptr<T>` object.
+ */
+template <class T, class... Args>
+std::shared_ptr<T> allocateRequest(std::shared_ptr<RequestPool> pool, Args&&... args)
+{
+  return std::allocate_shared<T>(RequestPoolAllocator<T>(std::move(pool)),
+                                 std::forward<Args>(args)...);
+}
+
+}  // namespace ucxx
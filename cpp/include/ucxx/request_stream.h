@@ -9,12 +9,16 @@
 
 #include <ucxx/delayed_submission.h>
 #include <ucxx/request.h>
+#include <ucxx/request_pool.h>
 #include <ucxx/typedefs.h>
 
 namespace ucxx {
 
 class RequestStream : public Request {
  private:
+  template <class T>
+  friend class RequestPoolAllocator;
+
   size_t _length{0};  ///< The stream request length in bytes
 
   /**
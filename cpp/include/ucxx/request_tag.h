@@ -5,18 +5,47 @@
 #pragma once
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <ucp/api/ucp.h>
 
 #include <ucxx/delayed_submission.h>
 #include <ucxx/request.h>
+#include <ucxx/request_pool.h>
 #include <ucxx/typedefs.h>
 
 namespace ucxx {
 
 class RequestTag : public Request {
  private:
-  size_t _length{0};  ///< The tag message length in bytes
+  template <class T>
+  friend class RequestPoolAllocator;
+
+  size_t _length{0};                ///< The tag message length in bytes
+  bool _allowShorterMessage{false};  ///< Whether a receive accepts messages shorter than `_length`
+  TagMask _tagMask{TagMaskFull};     ///< The mask applied to tags of incoming messages
+  ucp_tag_t _senderTag{0};           ///< The tag of the message received
+  size_t _receivedLength{0};         ///< The length in bytes of the message received
+
+  /**
+   * @brief Verify the length of a received message.
+   *
+   * Verify the length of a received message matches the length of the receive buffer, or
+   * that it fits in the buffer if shorter messages are allowed, storing the received
+   * length if so and setting the status message otherwise.
+   *
+   * @param[in] length  the length in bytes of the message received.
+   *
+   * @returns `UCS_OK` if the length is valid, `UCS_ERR_MESSAGE_TRUNCATED` otherwise.
+   */
+  ucs_status_t verifyReceivedLength(const size_t length);
+
+  /**
+   * @brief Get the length of the message transferred.
+   *
+   * @returns The length in bytes of the message transferred, see `getReceivedLength()`.
+   */
+  size_t getTransferredLength() const override;
 
   /**
    * @brief Private constructor of `ucxx::RequestTag`.
@@ -30,6 +59,9 @@ class RequestTag : public Request {
    * - `ucxx::Endpoint::tagRecv()`
    * - `ucxx::Endpoint::tagSend()`
    * - `ucxx::Worker::tagRecv()`
+   * - `ucxx::Endpoint::tagRecvBatch()`
+   * - `ucxx::Endpoint::tagSendBatch()`
+   * - `ucxx::Worker::tagRecvBatch()`
    * - `ucxx::createRequestTag()`
    *
    * @throws ucxx::Error  if send is `true` and `endpointOrWorker` is not a
@@ -43,19 +75,25 @@ class RequestTag : public Request {
    * @param[in] buffer              a raw pointer to the data to be transferred.
    * @param[in] length              the size in bytes of the tag message to be transferred.
    * @param[in] tag                 the tag to match.
+   * @param[in] tagMask             the mask applied to tags of incoming messages before
+   *                                matching them against `tag`, only applies to receives.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
    * @param[in] callbackFunction    user-defined callback function to call upon completion.
    * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] allowShorterMessage whether a receive request accepts messages shorter
+   *                                than `length`.
    */
   RequestTag(std::shared_ptr<Component> endpointOrWorker,
              bool send,
              void* buffer,
              size_t length,
              ucp_tag_t tag,
+             const TagMask tagMask,
              const bool enablePythonFuture                               = false,
              std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
-             std::shared_ptr<void> callbackData                          = nullptr);
+             std::shared_ptr<void> callbackData                          = nullptr,
+             const bool allowShorterMessage                              = false);
 
  public:
   /**
@@ -78,10 +116,15 @@ class RequestTag : public Request {
    * @param[in] buffer              a raw pointer to the data to be transferred.
    * @param[in] length              the size in bytes of the tag message to be transferred.
    * @param[in] tag                 the tag to match.
+   * @param[in] tagMask             the mask applied to tags of incoming messages before
+   *                                matching them against `tag`, only applies to receives.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
    * @param[in] callbackFunction    user-defined callback function to call upon completion.
    * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] allowShorterMessage whether a receive request accepts messages shorter
+   *                                than `length`, instead of completing with
+   *                                `UCS_ERR_MESSAGE_TRUNCATED`.
    *
    * @returns The `shared_ptr<ucxx::RequestTag>` object
    */
@@ -91,9 +134,45 @@ class RequestTag : public Request {
     void* buffer,
     size_t length,
     ucp_tag_t tag,
+    const TagMask tagMask,
     const bool enablePythonFuture,
     std::function<void(std::shared_ptr<void>)> callbackFunction,
-    std::shared_ptr<void> callbackData);
+    std::shared_ptr<void> callbackData,
+    const bool allowShorterMessage);
+
+  /**
+   * @brief Constructor for a batch of `std::shared_ptr<ucxx::RequestTag>`.
+   *
+   * Construct a batch of send or receive tag requests, one for each (buffer, length, tag)
+   * entry. Unlike `createRequestTag()`, the requests are not registered for delayed
+   * submission, the caller is responsible for registering the entire batch at once,
+   * usually with `ucxx::Worker::registerDelayedSubmissionBatch()`, thus paying for a
+   * single registration and worker wakeup.
+   *
+   * @throws ucxx::Error         if send is `true` and `endpointOrWorker` is not a
+   *                             `std::shared_ptr<ucxx::Endpoint>`.
+   * @throws std::runtime_error  if sizes of `buffers`, `lengths` and `tags` do not match.
+   *
+   * @param[in] endpointOrWorker    the parent component, which may either be a
+   *                                `std::shared_ptr<Endpoint>` or
+   *                                `std::shared_ptr<Worker>`.
+   * @param[in] send                whether these are send (`true`) or receive (`false`)
+   *                                tag requests.
+   * @param[in] buffers             raw pointers to the data to be transferred.
+   * @param[in] lengths             the size in bytes of each tag message.
+   * @param[in] tags                the tag to match for each message.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified for each request.
+   *
+   * @returns The requests in the same order as `buffers`, none of which has been submitted.
+   */
+  friend std::vector<std::shared_ptr<Request>> createRequestTagBatch(
+    std::shared_ptr<Component> endpointOrWorker,
+    bool send,
+    const std::vector<void*>& buffers,
+    const std::vector<size_t>& lengths,
+    const std::vector<ucp_tag_t>& tags,
+    const bool enablePythonFuture);
 
   virtual void populateDelayedSubmission();
 
@@ -162,6 +241,29 @@ class RequestTag : public Request {
    *                    length of message received used to verify for truncation.
    */
   void callback(void* request, ucs_status_t status, const ucp_tag_recv_info_t* info);
+
+  /**
+   * @brief Get the length of the message transferred.
+   *
+   * Get the length in bytes of the message transferred. For a receive request that
+   * completed successfully this is the length of the message received, which may be
+   * smaller than the buffer if the request was created with `allowShorterMessage=true`,
+   * see `ucxx::Endpoint::tagRecvUpTo()`.
+   *
+   * @returns The length in bytes of the message transferred.
+   */
+  size_t getReceivedLength() const;
+
+  /**
+   * @brief Get the tag of the message received.
+   *
+   * Get the tag the sender attached to the message received, which may differ from the
+   * tag of the receive request if it was created with a `tagMask` other than
+   * `ucxx::TagMaskFull`. Only valid after a receive request completed successfully.
+   *
+   * @returns The tag of the message received.
+   */
+  ucp_tag_t getSenderTag() const;
 };
 
 }  // namespace ucxx
@@ -0,0 +1,173 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/buffer.h>
+#include <ucxx/request.h>
+#include <ucxx/typedefs.h>
+
+namespace ucxx {
+
+class RequestTagAnySize : public Request {
+ private:
+  template <class T>
+  friend class RequestPoolAllocator;
+
+  /**
+   * @brief State of the message being received.
+   */
+  enum class ProbeState {
+    Pending = 0, /* The message has not been probed yet */
+    Posted,      /* The message was probed and its receive posted */
+    Canceled,    /* The request was canceled before the message was probed */
+  };
+
+  BufferAllocatorType _allocator{nullptr};    ///< Allocator of the receive buffer
+  std::shared_ptr<Buffer> _buffer{nullptr};   ///< The buffer the message is received into
+  std::mutex _probeMutex{};                   ///< Mutex to access the probe state
+  ProbeState _probeState{ProbeState::Pending};  ///< State of the message being received
+
+  /**
+   * @brief Private constructor of `ucxx::RequestTagAnySize`.
+   *
+   * This is the internal implementation of `ucxx::RequestTagAnySize` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all UCXX
+   * objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Endpoint::tagRecvAnySize()`
+   * - `ucxx::Worker::tagRecvAnySize()`
+   * - `ucxx::createRequestTagAnySize()`
+   *
+   * @param[in] endpointOrWorker    the parent component, which may either be a
+   *                                `std::shared_ptr<Endpoint>` or
+   *                                `std::shared_ptr<Worker>`.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] allocator           allocator of the receive buffer, a host buffer is
+   *                                allocated if `nullptr`.
+   */
+  RequestTagAnySize(std::shared_ptr<Component> endpointOrWorker,
+                    ucp_tag_t tag,
+                    const bool enablePythonFuture,
+                    std::function<void(std::shared_ptr<void>)> callbackFunction,
+                    std::shared_ptr<void> callbackData,
+                    BufferAllocatorType allocator);
+
+ public:
+  /**
+   * @brief Constructor for `std::shared_ptr<ucxx::RequestTagAnySize>`.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestTagAnySize>` object, creating a
+   * tag receive request for a message of unknown size. Once a message matching `tag`
+   * arrives it is probed and removed from UCX's unexpected messages, a buffer of exactly
+   * the message length is allocated with `allocator` and the message received into it.
+   * Until a matching message arrives, probing is retried every time the worker is
+   * progressed.
+   *
+   * This is a non-blocking operation, the status of the transfer must be verified from the
+   * resulting request object before the data can be consumed with `getRecvBuffer()`.
+   *
+   * @param[in] endpointOrWorker    the parent component, which may either be a
+   *                                `std::shared_ptr<Endpoint>` or
+   *                                `std::shared_ptr<Worker>`.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] allocator           allocator of the receive buffer, must not throw, a host
+   *                                buffer is allocated if `nullptr`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestTagAnySize>` object
+   */
+  friend std::shared_ptr<RequestTagAnySize> createRequestTagAnySize(
+    std::shared_ptr<Component> endpointOrWorker,
+    ucp_tag_t tag,
+    const bool enablePythonFuture,
+    std::function<void(std::shared_ptr<void>)> callbackFunction,
+    std::shared_ptr<void> callbackData,
+    BufferAllocatorType allocator);
+
+  /**
+   * @brief Probe the message and post its receive.
+   *
+   * Register the request with the worker, which attempts to receive the message
+   * immediately if no older receives of unknown size are pending, and otherwise retries
+   * each time it is progressed until the message arrives.
+   */
+  virtual void populateDelayedSubmission();
+
+  /**
+   * @brief Attempt to probe the message and post its receive.
+   *
+   * Probe for a message matching the tag, and if one has arrived remove it from UCX's
+   * unexpected messages, allocate a buffer of its length and post the receive. This is
+   * called by the worker every time it is progressed while the message has not arrived,
+   * and is not usually called directly.
+   *
+   * @returns `true` if the receive was posted or the request was canceled, `false` if
+   *          the message has not arrived yet.
+   */
+  bool tryRecv();
+
+  /**
+   * @brief Cancel the request.
+   *
+   * Cancel the request, completing it immediately with `UCS_ERR_CANCELED` if the message
+   * has not been probed yet, otherwise canceling the posted receive.
+   */
+  void cancel() override;
+
+  /**
+   * @brief Callback executed by UCX when the receive request is completed.
+   *
+   * Callback executed by UCX when the receive request is completed, that will dispatch
+   * `ucxx::Request::callback()`.
+   *
+   * WARNING: This is not intended to be called by the user, but it currently needs to be
+   * a public method so that UCX may access it. In future changes this will be moved to
+   * an internal object and remove this method from the public API.
+   *
+   * @param[in] request the UCX request pointer.
+   * @param[in] status  the completion status of the request.
+   * @param[in] info    information of the completed transfer provided by UCX.
+   * @param[in] arg     the pointer to the `ucxx::Request` object that created the
+   *                    transfer, effectively `this` pointer as seen by `tryRecv()`.
+   */
+  static void tagRecvCallback(void* request,
+                              ucs_status_t status,
+                              const ucp_tag_recv_info_t* info,
+                              void* arg);
+
+  /**
+   * @brief Get the buffer the message was received into.
+   *
+   * Get the buffer allocated to receive the message, with exactly the size of the message.
+   * Only valid after the request completed successfully.
+   *
+   * @returns The receive buffer, or `nullptr` if the message has not been probed yet.
+   */
+  std::shared_ptr<Buffer> getRecvBuffer();
+
+  /**
+   * @brief Get the length of the message received.
+   *
+   * @returns The length in bytes of the message received, or `0` if the message has not
+   *          been probed yet.
+   */
+  size_t getReceivedLength() const;
+};
+
+}  // namespace ucxx
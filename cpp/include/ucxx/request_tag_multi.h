@@ -4,6 +4,7 @@
  */
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -37,6 +38,9 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
   std::vector<BufferRequest*> _completedRequests{};  ///< Requests that already completed
   ucs_status_t _status{UCS_INPROGRESS};              ///< Status of the multi-buffer request
   std::shared_ptr<Future> _future;  ///< Future to be notified when transfer of all frames complete
+  std::function<void(std::shared_ptr<void>)> _callback{
+    nullptr};  ///< User-defined callback to call once the receive completes
+  std::shared_ptr<void> _callbackData{nullptr};  ///< User-defined data to pass to `_callback`
 
  public:
   std::vector<BufferRequestPtr> _bufferRequests{};  ///< Container of all requests posted
@@ -60,10 +64,14 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
    * @param[in] tag                 the tag to match.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
    */
   RequestTagMulti(std::shared_ptr<Endpoint> endpoint,
                   const ucp_tag_t tag,
-                  const bool enablePythonFuture);
+                  const bool enablePythonFuture,
+                  std::function<void(std::shared_ptr<void>)> callbackFunction,
+                  std::shared_ptr<void> callbackData);
 
   /**
    * @brief Protected constructor of a multi-buffer tag send request.
@@ -188,15 +196,25 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
    * ensure the transfer has completed. Requires UCXX to be compiled with
    * `UCXX_ENABLE_PYTHON=1`.
    *
+   * The `callbackFunction` is called once after the status of the request has been set,
+   * either because all frames have been received or because receiving a header failed,
+   * this may happen before this function returns if all data was received immediately.
+   *
    * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component
    * @param[in] tag                 the tag to match.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
    *
    * @returns Request to be subsequently checked for the completion and its state.
    */
   friend std::shared_ptr<RequestTagMulti> createRequestTagMultiRecv(
-    std::shared_ptr<Endpoint> endpoint, const ucp_tag_t tag, const bool enablePythonFuture);
+    std::shared_ptr<Endpoint> endpoint,
+    const ucp_tag_t tag,
+    const bool enablePythonFuture,
+    std::function<void(std::shared_ptr<void>)> callbackFunction,
+    std::shared_ptr<void> callbackData);
 
   /**
    * @brief `ucxx::RequestTagMulti` destructor.
@@ -5,11 +5,16 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
+#include <ucp/api/ucp.h>
+
 namespace ucxx {
 
+struct AmMessage;
+class Buffer;
 class Request;
 
 // Logging levels
@@ -32,4 +37,31 @@ typedef enum {
 
 typedef std::unordered_map<std::string, std::string> ConfigMap;
 
+// Mask applied to tags before matching, bits set to 0 match any value of the tag's bit.
+// A distinct type prevents the mask from being mistaken for a tag or other integer argument.
+enum TagMask : ucp_tag_t {};
+
+// Mask matching all bits of the tag, the message tag must be equal to the receive tag
+static constexpr TagMask TagMaskFull{static_cast<ucp_tag_t>(-1)};
+
+// Allocator of a buffer to receive a message of the given length into
+typedef std::function<std::shared_ptr<Buffer>(const size_t)> BufferAllocatorType;
+
+// Handler of Active Messages received, called with the message and the registered argument
+typedef std::function<void(const AmMessage& message, void* arg)> AmHandlerType;
+
+// Mode used to close an endpoint
+enum class EndpointCloseMode {
+  Flush = 0, /* Complete outstanding operations before disconnecting */
+  Force,     /* Disconnect immediately, canceling outstanding operations */
+};
+
+// Strategy used by `ucxx::WorkerPool` to select a worker for new endpoints
+enum class WorkerPoolPlacement {
+  RoundRobin = 0, /* Cycle through workers in order */
+  LeastLoaded,    /* Pick the worker with the fewest live endpoints */
+  PeerHash,       /* Pick the worker from a hash of the remote peer */
+  LeastInflight,  /* Pick the worker with the fewest inflight requests */
+};
+
 }  // namespace ucxx
@@ -0,0 +1,67 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ucxx {
+
+namespace utils {
+
+/**
+ * @brief Pin the calling thread to a set of CPUs.
+ *
+ * Set the CPU affinity of the calling thread so that it may only be scheduled on the CPUs
+ * specified in `cpus`.
+ *
+ * @param[in] cpus  the indices of the CPUs the thread may run on.
+ *
+ * @throws std::invalid_argument if `cpus` is empty or contains an invalid CPU index.
+ * @throws ucxx::Error if setting the thread affinity failed.
+ */
+void setThreadCpuAffinity(const std::vector<size_t>& cpus);
+
+/**
+ * @brief Get the NUMA node of a CPU.
+ *
+ * Get the NUMA node a CPU belongs to, as reported by the Linux sysfs.
+ *
+ * @param[in] cpu the index of the CPU.
+ *
+ * @returns The NUMA node of the CPU, or `-1` if it could not be determined.
+ */
+int getCpuNumaNode(const size_t cpu);
+
+/**
+ * @brief Get the NUMA node of the CPU the calling thread is running on.
+ *
+ * @returns The NUMA node of the current CPU, or `-1` if it could not be determined.
+ */
+int getCurrentNumaNode();
+
+/**
+ * @brief Bind memory to a NUMA node.
+ *
+ * Set the memory policy of all whole pages in the range `[ptr, ptr + size)` to prefer
+ * allocation on NUMA node `numaNode`, pages that are partially contained in the range are
+ * not affected. Pages that have not been touched yet will be allocated on the NUMA node
+ * upon first touch, if `move` is `true` pages already allocated are migrated as well.
+ *
+ * This is a best-effort operation, failures (e.g., if the system does not support NUMA)
+ * are logged and otherwise ignored.
+ *
+ * @param[in] ptr       pointer to the start of the memory range.
+ * @param[in] size      the size in bytes of the memory range.
+ * @param[in] numaNode  the NUMA node to bind the memory to, no-op if negative.
+ * @param[in] move      whether to migrate pages that have already been allocated.
+ *
+ * @returns `true` if the memory policy was applied, `false` otherwise.
+ */
+bool bindMemoryToNumaNode(void* ptr, const size_t size, const int numaNode, const bool move);
+
+}  // namespace utils
+
+}  // namespace ucxx
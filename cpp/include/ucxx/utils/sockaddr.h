@@ -23,6 +23,25 @@ namespace utils {
  */
 int sockaddr_set(ucs_sock_addr_t* sockaddr, const char* ip_address, uint16_t port);
 
+/**
+ * @brief Set a resolved address and port in a socket address storage.
+ *
+ * Copy a resolved IPv4 or IPv6 address to newly allocated memory referenced by the
+ * socket address storage, setting its port as defined by the user.
+ *
+ * @param[in] sockaddr  pointer to the UCS socket address storage.
+ * @param[in] address   the resolved address, e.g. from `getaddrinfo`.
+ * @param[in] length    the length of the resolved address.
+ * @param[in] port      port to set the socket address storage to.
+ *
+ * @returns `0` on success, `1` if the address family is not supported or memory could
+ *          not be allocated.
+ */
+int sockaddr_set(ucs_sock_addr_t* sockaddr,
+                 const struct sockaddr_storage* address,
+                 socklen_t length,
+                 uint16_t port);
+
 /**
  * @brief Release the underlying socket address.
  *
@@ -4,42 +4,62 @@
  */
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <ucp/api/ucp.h>
 
+#include <ucxx/adaptive_progress.h>
+#include <ucxx/completion_queue.h>
 #include <ucxx/component.h>
 #include <ucxx/constructors.h>
 #include <ucxx/context.h>
 #include <ucxx/delayed_submission.h>
 #include <ucxx/future.h>
+#include <ucxx/hostname_resolver.h>
 #include <ucxx/inflight_requests.h>
 #include <ucxx/notifier.h>
+#include <ucxx/request_pool.h>
 #include <ucxx/worker_progress_thread.h>
 
 namespace ucxx {
 
 class Address;
 class Endpoint;
+class EndpointPool;
 class Listener;
+class RequestEndpointCreate;
+class RequestTagAnySize;
 
 class Worker : public Component {
  private:
   ucp_worker_h _handle{nullptr};        ///< The UCP worker handle
   int _epollFileDescriptor{-1};         ///< The epoll file descriptor
   int _workerFileDescriptor{-1};        ///< The worker file descriptor
-  std::mutex _inflightRequestsMutex{};  ///< Mutex to access the inflight requests pool
   std::shared_ptr<InflightRequests> _inflightRequests{
     std::make_shared<InflightRequests>()};  ///< The inflight requests
-  std::mutex
-    _inflightRequestsToCancelMutex{};  ///< Mutex to access the inflight requests to cancel pool
   std::shared_ptr<InflightRequests> _inflightRequestsToCancel{
     std::make_shared<InflightRequests>()};  ///< The inflight requests scheduled to be canceled
+  std::shared_ptr<RequestPool> _requestPool{
+    std::make_shared<RequestPool>()};  ///< Pool the worker's requests are allocated from
+  size_t _requestSize{0};              ///< Size of a UCP request of the parent context
+  std::atomic<bool> _enableUserRequestMemory{
+    false};  ///< Whether UCP requests are placed in memory allocated from `_requestPool`
+  std::unique_ptr<CompletionQueue> _completionQueueOwner{
+    nullptr};  ///< Owner of the completion queue, `nullptr` unless enabled
+  std::atomic<CompletionQueue*> _completionQueue{
+    nullptr};  ///< Queue of completed requests, never replaced once enabled
+  std::shared_ptr<HostnameResolver> _hostnameResolver{
+    nullptr};  ///< Resolver of hostnames, the process-wide default if `nullptr`
   std::shared_ptr<WorkerProgressThread> _progressThread{nullptr};  ///< The progress thread object
   std::function<void(void*)> _progressThreadStartCallback{
     nullptr};  ///< The callback function to execute at progress thread start
@@ -47,6 +67,53 @@ class Worker : public Component {
     nullptr};  ///< The argument to be passed to the progress thread start callback
   std::shared_ptr<DelayedSubmissionCollection> _delayedSubmissionCollection{
     nullptr};  ///< Collection of enqueued delayed submissions
+  std::mutex _tagProbesMutex{};  ///< Mutex to access the pending tag probes
+  std::vector<std::shared_ptr<RequestTagAnySize>>
+    _tagProbes{};  ///< Receives of unknown size whose message has not arrived yet
+  std::atomic<size_t> _tagProbesSize{0};  ///< Number of pending tag probes
+
+  /**
+   * @brief Active Message handler registered for an identifier.
+   */
+  struct AmHandler {
+    AmHandlerType handler{nullptr};          ///< Handler to call with the messages received
+    void* handlerArg{nullptr};               ///< Argument to be passed to the handler
+    BufferAllocatorType allocator{nullptr};  ///< Allocator of buffers for rendezvous data
+  };
+
+  /**
+   * @brief Argument of the UCX Active Message callback for an identifier.
+   *
+   * Its address is registered with UCX, thus slots are kept until the worker is destroyed
+   * even if the handler is removed or replaced.
+   */
+  struct AmHandlerSlot {
+    Worker* worker{nullptr};                      ///< The worker the handler is registered on
+    unsigned id{0};                               ///< Identifier of the handler
+    std::shared_ptr<AmHandler> handler{nullptr};  ///< The handler, `nullptr` if removed
+  };
+
+  std::mutex _amHandlersMutex{};  ///< Mutex to access the Active Message handlers
+  std::unordered_map<unsigned, std::unique_ptr<AmHandlerSlot>>
+    _amHandlers{};  ///< Active Message handlers by identifier
+  std::atomic<int> _numaNode{
+    -1};  ///< NUMA node of the pinned progress thread, `-1` if unknown, read concurrently
+          ///< by the progress thread when allocating Active Message buffers
+
+  /**
+   * @brief State of the thread progressing the worker, used to coalesce wakeups.
+   */
+  enum class WakeupState {
+    Awake,     ///< The progressing thread is running and will process pending submissions
+    Sleeping,  ///< The progressing thread is blocked, or about to block, waiting for events
+    Signaled,  ///< The progressing thread was signaled and is waking up
+  };
+
+  std::atomic<WakeupState> _wakeupState{
+    WakeupState::Awake};  ///< State of the thread progressing the worker
+  std::atomic<uint64_t> _signalsIssued{0};  ///< Number of wakeups issued by delayed submissions
+  std::atomic<uint64_t> _signalsSuppressed{
+    0};  ///< Number of wakeups suppressed by delayed submissions
 
  protected:
   bool _enableFuture{
@@ -74,14 +141,44 @@ class Worker : public Component {
   void stopProgressThreadNoWarn();
 
   /**
-   * @brief Register an inflight request.
+   * @brief Place the worker on the NUMA node of a set of CPUs.
    *
-   * Called each time a new transfer request is made by the `Worker`, such that it may
-   * be canceled when necessary.
+   * Set the worker's NUMA node to that of the first CPU in `cpuAffinity` and bind internal
+   * structures accessed by the progress thread to it, or reset it to `-1` if `cpuAffinity`
+   * is empty. Must only be called after the progress thread was pinned successfully.
    *
-   * @param[in] request the request to register.
+   * @param[in] cpuAffinity CPUs the progress thread is pinned to.
    */
-  void registerInflightRequest(std::shared_ptr<Request> request);
+  void setNumaPlacement(const std::vector<size_t>& cpuAffinity);
+
+  /**
+   * @brief Prepare the thread progressing the worker to block waiting for events.
+   *
+   * Transition the wakeup state to sleeping, unless there are pending delayed submissions,
+   * in which case the thread must not block. Must be called before the worker is armed
+   * or waited on, and followed by `markAwake()` once the thread wakes up.
+   *
+   * @returns `true` if the thread may block, `false` if it must process pending delayed
+   *          submissions first.
+   */
+  bool prepareToSleep();
+
+  /**
+   * @brief Mark the thread progressing the worker as awake.
+   *
+   * Transition the wakeup state to awake, after which delayed submissions will not signal
+   * the worker until the thread prepares to block again with `prepareToSleep()`.
+   */
+  void markAwake();
+
+  /**
+   * @brief Signal the worker only if the progressing thread is sleeping.
+   *
+   * Signal the worker on the sleeping-to-signaled transition, suppressing the signal if
+   * the thread progressing the worker is awake or has already been signaled. Must be
+   * called after the delayed submission that requires the wakeup has been registered.
+   */
+  void signalIfSleeping();
 
   /**
    * @brief Progress the worker until all communication events are completed.
@@ -92,6 +189,40 @@ class Worker : public Component {
    */
   bool progressPending();
 
+  /**
+   * @brief Attempt to receive messages of pending receives of unknown size.
+   *
+   * Probe for the messages of all receives of unknown size whose messages had not arrived
+   * yet, posting the receive of those that have arrived. Receives are attempted in the
+   * order they were registered, so that messages with the same tag are matched in order.
+   *
+   * @returns whether any receives have been posted.
+   */
+  bool progressTagProbes();
+
+  /**
+   * @brief Callback executed by UCX when an Active Message is received.
+   *
+   * Call the handler registered for the message identifier with eager data in place, or
+   * allocate a buffer with the handler's allocator and fetch rendezvous data directly into
+   * it, calling the handler once the data has been fetched.
+   *
+   * @param[in] arg           the `AmHandlerSlot` of the message identifier.
+   * @param[in] header        the user-defined header of the message.
+   * @param[in] headerLength  the length in bytes of the header.
+   * @param[in] data          the message data, or its descriptor if rendezvous.
+   * @param[in] length        the length in bytes of the message data.
+   * @param[in] param         the attributes of the message received.
+   *
+   * @returns `UCS_OK`, as data is never retained beyond the callback.
+   */
+  static ucs_status_t amRecvCallback(void* arg,
+                                     const void* header,
+                                     size_t headerLength,
+                                     void* data,
+                                     size_t length,
+                                     const ucp_am_recv_param_t* param);
+
  protected:
   /**
    * @brief Protected constructor of `ucxx::Worker`.
@@ -107,8 +238,15 @@ class Worker : public Component {
    *                                    submitted immediately, but instead delayed to
    *                                    the progress thread. Requires use of the
    *                                    progress thread.
+   * @param[in] enableFuture            if `true`, creates a native notifier so that
+   *                                    requests may be notified via
+   *                                    `ucxx::NativeFuture`. Derived classes providing
+   *                                    their own future implementation should pass
+   *                                    `false` and create their own notifier instead.
    */
-  explicit Worker(std::shared_ptr<Context> context, const bool enableDelayedSubmission = false);
+  explicit Worker(std::shared_ptr<Context> context,
+                  const bool enableDelayedSubmission = false,
+                  const bool enableFuture            = false);
 
  public:
   Worker()              = delete;
@@ -130,6 +268,10 @@ class Worker : public Component {
    *
    * // Equivalent to line above
    * // auto worker = ucxx::createWorker(context, false);
+   *
+   * // Worker with native futures, requests submitted with `enableFuture=true` may then
+   * // be waited on via `ucxx::NativeFuture` instead of polling `isCompleted()`
+   * auto futureWorker = context->createWorker(false, true);
    * @endcode
    *
    * @param[in] context the context from which to create the worker.
@@ -137,10 +279,14 @@ class Worker : public Component {
    *                                    submitted immediately, but instead delayed to
    *                                    the progress thread. Requires use of the
    *                                    progress thread.
+   * @param[in] enableFuture            if `true`, notifies the `ucxx::NativeFuture`
+   *                                    associated with each `ucxx::Request` from a
+   *                                    native notifier thread.
    * @returns The `shared_ptr<ucxx::Worker>` object
    */
   friend std::shared_ptr<Worker> createWorker(std::shared_ptr<Context> context,
-                                              const bool enableDelayedSubmission);
+                                              const bool enableDelayedSubmission,
+                                              const bool enableFuture);
 
   /**
    * @brief `ucxx::Worker` destructor.
@@ -216,6 +362,31 @@ class Worker : public Component {
    */
   bool arm();
 
+  /**
+   * @brief Get the epoll file descriptor of the worker.
+   *
+   * Get the epoll file descriptor created by `initBlockingProgressMode()`, which becomes
+   * readable when the worker has new events after being armed with `arm()`. This allows
+   * integrating the worker with an external event loop, such as Python's asyncio via
+   * `loop.add_reader()`, progressing the worker only when UCX has events.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * worker->initBlockingProgressMode();
+   * int fd = worker->getEpollFileDescriptor();
+   *
+   * // Register `fd` with the event loop, when it becomes readable progress the worker
+   * // until it can be armed again.
+   * do {
+   *   worker->progress();
+   * } while (!worker->arm());
+   * @endcode
+   *
+   * @returns The epoll file descriptor, or `-1` if blocking progress mode was not
+   *          initialized.
+   */
+  int getEpollFileDescriptor() const;
+
   /**
    * @brief Progress worker event while in blocking progress mode.
    *
@@ -343,11 +514,54 @@ class Worker : public Component {
    * thread, thus decreasing computation on the caller thread, but potentially increasing
    * transfer latency.
    *
+   * The worker is only signaled if the thread progressing it is sleeping, if it is awake
+   * it will process the submission before blocking again, thus consecutive registrations
+   * result in at most one wakeup.
+   *
+   * Requests register their own population this way rather than submitting from their
+   * constructor, allowing the worker progress thread to set their status and notify their
+   * Python future later on, so that the GIL is not required by the caller. Callbacks
+   * capturing no more than the request's `this` pointer are stored inline in the
+   * submission ring, without allocations.
+   *
    * @param[in] callback the callback set to execute the UCP transfer routine during the
    *                     worker thread loop.
    */
   void registerDelayedSubmission(DelayedSubmissionCallbackType callback);
 
+  /**
+   * @brief Register a batch of requests for delayed submission.
+   *
+   * Register a batch of `ucxx::Request` for delayed submission with a single callback
+   * that submits them all in order, thus paying for a single registration and worker
+   * wakeup regardless of the number of requests. Each request must have been created
+   * without registering itself for delayed submission, see
+   * `ucxx::createRequestTagBatch()`.
+   *
+   * @param[in] requests the requests to submit during the worker thread loop.
+   */
+  void registerDelayedSubmissionBatch(std::vector<std::shared_ptr<Request>> requests);
+
+  /**
+   * @brief Get the number of wakeups issued by delayed submissions.
+   *
+   * Get the number of times registering a delayed submission signaled the worker because
+   * the thread progressing it was sleeping.
+   *
+   * @returns The number of wakeups issued.
+   */
+  uint64_t getSignalsIssued() const;
+
+  /**
+   * @brief Get the number of wakeups suppressed by delayed submissions.
+   *
+   * Get the number of times registering a delayed submission did not signal the worker
+   * because the thread progressing it was already awake or had already been signaled.
+   *
+   * @returns The number of wakeups suppressed.
+   */
+  uint64_t getSignalsSuppressed() const;
+
   /**
    * @brief Inquire if worker has been created with future support.
    *
@@ -357,6 +571,16 @@ class Worker : public Component {
    */
   bool isFutureEnabled() const;
 
+  /**
+   * @brief Inquire if worker has been created with delayed submission enabled.
+   *
+   * Check whether the worker has been created with delayed submission enabled, in which
+   * case requests are only submitted to UCX by the worker progress thread.
+   *
+   * @returns `true` if delayed submission is enabled, `false` otherwise.
+   */
+  bool isDelayedSubmissionEnabled() const;
+
   /**
    * @brief Populate the future pool.
    *
@@ -366,7 +590,7 @@ class Worker : public Component {
    * a maximum size of 100 objects, and will refill once it goes under 50, otherwise
    * calling this functions results in a no-op.
    *
-   * @throws std::runtime_error if future support is not implemented.
+   * @throws std::runtime_error if future support is not enabled.
    */
   virtual void populateFuturesPool();
 
@@ -377,7 +601,7 @@ class Worker : public Component {
    * `ucxx::Worker::populateFuturesPool()` is called and a warning is raised, since
    * that likely means the user is missing to call the aforementioned method regularly.
    *
-   * @throws std::runtime_error if future support is not implemented.
+   * @throws std::runtime_error if future support is not enabled.
    *
    * @returns The `shared_ptr<ucxx::python::Future>` object
    */
@@ -391,7 +615,7 @@ class Worker : public Component {
    * intended for use from the notifier (such as the Python thread running it), where that
    * thread will block until one of the aforementioned events occur.
    *
-   * @throws std::runtime_error if future support is not implemented.
+   * @throws std::runtime_error if future support is not enabled.
    *
    * @returns `RequestNotifierWaitState::Ready` if some communication completed,
    *          `RequestNotifierWaitStats::Timeout` if a timeout occurred, or
@@ -409,7 +633,7 @@ class Worker : public Component {
    * a Python future, the thread where this method is called from must be using the same
    * Python event loop as the thread that submitted the transfer request.
    *
-   * @throws std::runtime_error if future support is not implemented.
+   * @throws std::runtime_error if future support is not enabled.
    */
   virtual void runRequestNotifier();
 
@@ -418,10 +642,33 @@ class Worker : public Component {
    *
    * Signals the notifier to terminate, awakening the `waitRequestNotifier()` blocking call.
    *
-   * @throws std::runtime_error if future support is not implemented.
+   * @throws std::runtime_error if future support is not enabled.
    */
   virtual void stopRequestNotifierThread();
 
+  /**
+   * @brief Get the file descriptor signaled when futures are ready to be notified.
+   *
+   * Get a file descriptor that becomes readable when some communication is completed and
+   * futures are ready to be notified. This allows an event loop to watch the file
+   * descriptor and call `runRequestNotifier()` when it becomes readable, as an alternative
+   * to a notifier thread blocking on `waitRequestNotifier()`. The file descriptor is owned
+   * by the notifier and must not be closed by the caller.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>` created with future support
+   * int fd = worker->getRequestNotifierFileDescriptor();
+   *
+   * // Wait for `fd` to become readable, for example with `poll()`, then
+   * worker->runRequestNotifier();
+   * @endcode
+   *
+   * @throws std::runtime_error if future support is not enabled.
+   *
+   * @returns The file descriptor signaled when futures are ready to be notified.
+   */
+  virtual int getRequestNotifierFileDescriptor();
+
   /**
    * @brief Set callback to be executed at the progress thread start.
    *
@@ -442,10 +689,53 @@ class Worker : public Component {
    * when worker events happen, or in polling mode by continuously calling `progress()`
    * (incurs in high CPU utilization).
    *
+   * The thread may optionally be pinned to a set of CPUs, in which case the worker's NUMA
+   * node is set to that of the first CPU in the set, and internal structures accessed by
+   * the progress thread as well as host buffers allocated for the worker are placed on
+   * that NUMA node, see `getNumaNode()`.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * // Blocking mode, progress thread pinned to CPUs 2 and 3
+   * worker->startProgressThread(false, {2, 3});
+   * @endcode
+   *
    * @param[in] pollingMode use polling mode if `true`, or blocking mode if `false`.
-   * @param[in] callbackArg argument to be passed to the callback function
+   * @param[in] cpuAffinity CPUs to pin the progress thread to, not pinned if empty.
+   *
+   * @throws std::invalid_argument  if `cpuAffinity` contains an invalid CPU index.
+   * @throws ucxx::Error            if pinning the thread to `cpuAffinity` failed.
    */
-  void startProgressThread(const bool pollingMode = false);
+  void startProgressThread(const bool pollingMode                = false,
+                           const std::vector<size_t>& cpuAffinity = {});
+
+  /**
+   * @brief Start the progress thread in adaptive mode.
+   *
+   * Spawns a new thread that will take care of continuously progressing the worker in
+   * adaptive spin-then-block mode. The thread spins calling `progress()` for a time budget,
+   * backing off with CPU pause instructions between unproductive iterations, and once the
+   * budget is exhausted arms the worker and blocks with `progressWorkerEvent()`. The spin
+   * budget adapts to the observed inter-arrival time of worker activity, providing
+   * latencies close to polling mode under load while not keeping a CPU core busy when
+   * idle, see `ucxx::AdaptiveProgress` for details.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * ucxx::AdaptiveProgressConfig config{};
+   * config.maxSpinDuration = std::chrono::microseconds(50);
+   * worker->startAdaptiveProgressThread(config);
+   * @endcode
+   *
+   * @param[in] config      the adaptive progress configuration.
+   * @param[in] cpuAffinity CPUs to pin the progress thread to, not pinned if empty, see
+   *                        `startProgressThread()` for details.
+   *
+   * @throws std::invalid_argument  if `cpuAffinity` contains an invalid CPU index.
+   * @throws ucxx::Error            if pinning the thread to `cpuAffinity` failed.
+   */
+  void startAdaptiveProgressThread(const AdaptiveProgressConfig& config = AdaptiveProgressConfig(),
+                                   const std::vector<size_t>& cpuAffinity = {});
 
   /**
    * @brief Stop the progress thread.
@@ -457,6 +747,177 @@ class Worker : public Component {
    */
   void stopProgressThread();
 
+  /**
+   * @brief Check whether the progress thread is running.
+   *
+   * @returns `true` if the progress thread was started and not stopped yet, `false`
+   *          otherwise.
+   */
+  bool isProgressThreadRunning() const;
+
+  /**
+   * @brief Check whether the calling thread is the progress thread.
+   *
+   * @returns `true` if the progress thread is running and is the calling thread, `false`
+   *          otherwise.
+   */
+  bool isOnProgressThread() const;
+
+  /**
+   * @brief Get the NUMA node of the worker.
+   *
+   * Get the NUMA node the worker's progress thread is placed on, as determined when
+   * starting the progress thread pinned to a set of CPUs. Host buffers allocated by the
+   * worker, such as those of multi-buffer receive transfers, are allocated on this NUMA
+   * node.
+   *
+   * @returns The NUMA node of the worker, or `-1` if the progress thread is not running,
+   *          not pinned or the NUMA node could not be determined.
+   */
+  int getNumaNode() const;
+
+  /**
+   * @brief Get the request pool of the worker.
+   *
+   * Get the pool that requests created by the worker and its endpoints are allocated from,
+   * allowing request objects to be reused without heap allocations in steady-state.
+   *
+   * @returns The `std::shared_ptr<ucxx::RequestPool>` of the worker.
+   */
+  std::shared_ptr<RequestPool> getRequestPool() const;
+
+  /**
+   * @brief Set the hostname resolver of the worker.
+   *
+   * Set the resolver used to resolve hostnames when creating endpoints, allowing a
+   * resolver with custom settings to be shared by multiple workers. Must not be called
+   * concurrently with endpoint creation.
+   *
+   * @param[in] resolver  the resolver, or `nullptr` to use the process-wide default.
+   */
+  void setHostnameResolver(std::shared_ptr<HostnameResolver> resolver);
+
+  /**
+   * @brief Get the hostname resolver of the worker.
+   *
+   * Get the resolver used to resolve hostnames when creating endpoints, which is the
+   * process-wide `ucxx::HostnameResolver::getDefault()` unless set with
+   * `setHostnameResolver()`.
+   *
+   * @returns The `std::shared_ptr<ucxx::HostnameResolver>` of the worker.
+   */
+  std::shared_ptr<HostnameResolver> getHostnameResolver() const;
+
+  /**
+   * @brief Enable or disable user-allocated UCP request memory.
+   *
+   * By default UCX allocates the memory of each UCP request from its internal memory pool,
+   * and the request is released with `ucp_request_free()` upon completion. When enabled,
+   * new requests instead place the UCP request by means of `UCP_OP_ATTR_FIELD_REQUEST`
+   * immediately ahead of the `ucxx::Request` object, in the same block allocated from the
+   * worker's request pool, saving an allocation and release in UCX for each operation at
+   * the cost of a larger request block. Only affects requests created after the call.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * worker->setUserRequestMemory(true);
+   * @endcode
+   *
+   * @param[in] enable whether to enable user-allocated UCP request memory.
+   */
+  void setUserRequestMemory(const bool enable);
+
+  /**
+   * @brief Check whether user-allocated UCP request memory is enabled.
+   *
+   * @returns `true` if UCP requests are placed in user-allocated memory, `false`
+   *          otherwise.
+   */
+  bool isUserRequestMemoryEnabled() const;
+
+  /**
+   * @brief Get the size of a UCP request.
+   *
+   * Get the size in bytes UCX requires preceding a user-allocated request handle, see
+   * `ucxx::Context::getRequestSize()`.
+   *
+   * @returns Size in bytes of a UCP request.
+   */
+  size_t getRequestSize() const;
+
+  /**
+   * @brief Enable the completion queue.
+   *
+   * Enable the completion queue of the worker, an alternative to per-request callbacks
+   * and polling `ucxx::Request::isCompleted()`. Once enabled, requests of the worker and
+   * its endpoints created with a `callbackData` but no `callbackFunction` push a compact
+   * `ucxx::Completion` record to the queue when they complete, which the application
+   * drains in batches with `pollCompletions()`, keeping user code out of the UCX callback
+   * context. The user context of each record holds a reference to the `callbackData`,
+   * keeping it alive until the record is released by the application.
+   * Requests created with a `callbackFunction` or without `callbackData` are not queued.
+   *
+   * Must be called before submitting any requests whose completions should be queued.
+   * It is safe to enable the queue while the worker is progressed from another thread,
+   * requests completing before that are not queued. Subsequent calls have no effect.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`, ep is `std::shared_ptr<ucxx::Endpoint>`
+   * worker->enableCompletionQueue();
+   *
+   * auto context = std::make_shared<int>(42);
+   * auto request = ep->tagRecv(buffer, length, tag, false, nullptr, context);
+   *
+   * std::vector<ucxx::Completion> completions(64);
+   * while (true) {
+   *   worker->progress();
+   *   size_t n = worker->pollCompletions(completions.data(), completions.size());
+   *   for (size_t i = 0; i < n; ++i)
+   *     handle(completions[i].context.get(), completions[i].status, completions[i].length);
+   * }
+   * @endcode
+   *
+   * @param[in] capacity  number of completions the queue holds without locking, rounded
+   *                      up to the next power of 2, completions beyond that are never
+   *                      lost but require a lock.
+   */
+  void enableCompletionQueue(const size_t capacity = CompletionQueue::defaultCapacity);
+
+  /**
+   * @brief Check whether the completion queue is enabled.
+   *
+   * @returns `true` if the completion queue has been enabled, `false` otherwise.
+   */
+  bool isCompletionQueueEnabled() const;
+
+  /**
+   * @brief Push a completion to the completion queue.
+   *
+   * Push the completion record of a request to the completion queue if enabled, otherwise
+   * this is a no-op. This is called by `ucxx::Request` when it completes, and is not
+   * usually called directly. Safe to be called concurrently from multiple threads.
+   *
+   * @param[in] completion  the completion record to push.
+   */
+  void pushCompletion(const Completion& completion);
+
+  /**
+   * @brief Poll the completion queue.
+   *
+   * Pop up to `maxCompletions` records of completed requests from the completion queue,
+   * storing them in `completions`. This does not progress the worker. Only one thread may
+   * call this method at any time.
+   *
+   * @param[out] completions     array where completions are stored, must hold at least
+   *                             `maxCompletions` elements.
+   * @param[in]  maxCompletions  the maximum number of completions to pop.
+   *
+   * @throws std::runtime_error  if the completion queue has not been enabled.
+   *
+   * @returns The number of completions popped.
+   */
+  size_t pollCompletions(Completion* completions, const size_t maxCompletions);
+
   /**
    * @brief Cancel inflight requests.
    *
@@ -467,6 +928,31 @@ class Worker : public Component {
    */
   size_t cancelInflightRequests();
 
+  /**
+   * @brief Cancel all requests tracked by the worker.
+   *
+   * Cancel requests posted directly on the worker that have not completed yet, such as
+   * worker tag receives, in addition to those scheduled for cancelation with
+   * `scheduleRequestCancel()`, which are the only ones `cancelInflightRequests()` cancels.
+   * Requests submitted on endpoints are tracked by each endpoint, see
+   * `ucxx::Endpoint::cancelInflightRequests()`.
+   *
+   * @returns Number of requests that were canceled.
+   */
+  size_t cancelAllInflightRequests();
+
+  /**
+   * @brief Get the number of inflight requests.
+   *
+   * Get the number of requests tracked by the worker that have not completed yet, such as
+   * receives posted directly on the worker and non-blocking endpoint closes. Requests
+   * submitted on endpoints are tracked by each endpoint, see
+   * `ucxx::Endpoint::getInflightRequestCount()`.
+   *
+   * @returns Number of inflight requests.
+   */
+  size_t getInflightRequestCount();
+
   /**
    * @brief Schedule cancelation of inflight requests.
    *
@@ -480,15 +966,26 @@ class Worker : public Component {
    */
   void scheduleRequestCancel(std::shared_ptr<InflightRequests> inflightRequests);
 
+  /**
+   * @brief Register an inflight request.
+   *
+   * Called each time a new transfer request is made by the `Worker`, such that it may
+   * be canceled when necessary. Also used to keep requests that are not tracked by an
+   * endpoint, such as endpoint close requests, alive until they complete.
+   *
+   * @param[in] request the request to register.
+   */
+  void registerInflightRequest(std::shared_ptr<Request> request);
+
   /**
    * @brief Remove reference to request from internal container.
    *
    * Remove the reference to a specific request from the internal container. This should
    * be called when a request has completed and the `ucxx::Worker` does not need to keep
-   * track of it anymore. The raw pointer to a `ucxx::Request` is passed here as opposed
-   * to the usual `std::shared_ptr<ucxx::Request>` used elsewhere, this is because the
-   * raw pointer address is used as key to the requests reference, and this is called
-   * from the object's destructor.
+   * track of it anymore, including requests scheduled for cancelation. The raw pointer to
+   * a `ucxx::Request` is passed here as opposed to the usual
+   * `std::shared_ptr<ucxx::Request>` used elsewhere, this is because this is called when
+   * the request is completing and no other reference may be available.
    *
    * @param[in] request raw pointer to the request
    */
@@ -509,11 +1006,24 @@ class Worker : public Component {
    * ep->tagSend(buffer, length, 0);
    *
    * assert(worker->tagProbe(0));
+   *
+   * // Check for messages with any tag whose upper 32 bits are `1`
+   * ucp_tag_t senderTag;
+   * if (worker->tagProbe(1ull << 32, ucxx::TagMask{0xffffffff00000000}, &senderTag))
+   *   std::cout << "Message with tag " << senderTag << " arrived" << std::endl;
    * @endcode
    *
+   * @param[in]  tag        the tag to match.
+   * @param[in]  tagMask    the mask applied to tags of uncaught messages before matching
+   *                        them against `tag`.
+   * @param[out] senderTag  if not `nullptr`, set to the tag of the first matching
+   *                        uncaught message, if any.
+   *
    * @returns `true` if any uncaught messages were received, `false` otherwise.
    */
-  bool tagProbe(ucp_tag_t tag);
+  bool tagProbe(ucp_tag_t tag,
+                const TagMask tagMask = TagMaskFull,
+                ucp_tag_t* senderTag  = nullptr);
 
   /**
    * @brief Enqueue a tag receive operation.
@@ -546,6 +1056,227 @@ class Worker : public Component {
     std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
     std::shared_ptr<void> callbackData                          = nullptr);
 
+  /**
+   * @brief Enqueue a masked tag receive operation.
+   *
+   * Enqueue a tag receive operation matching any message whose tag equals `tag` in all
+   * bits set in `tagMask`, returning a `std::shared<ucxx::RequestTag>` that can be later
+   * awaited and checked for errors. This allows a single receive to serve a range of tags,
+   * for example all messages from one peer or of one type when those are encoded in
+   * distinct bits of the tag. Once completed, the tag of the message received is available
+   * from `ucxx::RequestTag::getSenderTag()`.
+   *
+   * Using a future may be requested by specifying `enableFuture` if the worker
+   * implementation has support for it. If a future is requested, the application must then
+   * await on this future to ensure the transfer has completed.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`, receive a message with any tag whose
+   * // upper 32 bits are `1`
+   * auto request =
+   *   worker->tagRecv(buffer, length, 1ull << 32, ucxx::TagMask{0xffffffff00000000});
+   * while (!request->isCompleted())
+   *   worker->progress();
+   * auto lowerBits = request->getSenderTag() & 0xffffffff;
+   * @endcode
+   *
+   * @param[in] buffer            a raw pointer to pre-allocated memory where resulting
+   *                              data will be stored.
+   * @param[in] length            the size in bytes of the tag message to be received.
+   * @param[in] tag               the tag to match.
+   * @param[in] tagMask           the mask applied to tags of incoming messages before
+   *                              matching them against `tag`.
+   * @param[in] enableFuture      whether a future should be created and subsequently
+   *                              notified.
+   * @param[in] callbackFunction  user-defined callback function to call upon completion.
+   * @param[in] callbackData      user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion, its state and the
+   *          tag of the message received.
+   */
+  std::shared_ptr<RequestTag> tagRecv(
+    void* buffer,
+    size_t length,
+    ucp_tag_t tag,
+    const TagMask tagMask,
+    const bool enableFuture                                     = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a tag receive operation for a message of up to a maximum length.
+   *
+   * Enqueue a tag receive operation into a buffer that may be larger than the message,
+   * returning a `std::shared<ucxx::RequestTag>` that can be later awaited and checked for
+   * errors. Once completed, the actual length of the message received is available from
+   * `ucxx::RequestTag::getReceivedLength()`. If the message is larger than `maxLength`
+   * the request completes with `UCS_ERR_MESSAGE_TRUNCATED`.
+   *
+   * Using a future may be requested by specifying `enableFuture` if the worker
+   * implementation has support for it. If a future is requested, the application must then
+   * await on this future to ensure the transfer has completed.
+   *
+   * @param[in] buffer            a raw pointer to pre-allocated memory where resulting
+   *                              data will be stored.
+   * @param[in] maxLength         the size in bytes of `buffer`, the maximum length of the
+   *                              tag message to be received.
+   * @param[in] tag               the tag to match.
+   * @param[in] enableFuture      whether a future should be created and subsequently
+   *                              notified.
+   * @param[in] callbackFunction  user-defined callback function to call upon completion.
+   * @param[in] callbackData      user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion, its state and the
+   *          length of the message received.
+   */
+  std::shared_ptr<RequestTag> tagRecvUpTo(
+    void* buffer,
+    size_t maxLength,
+    ucp_tag_t tag,
+    const bool enableFuture                                     = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
+  /**
+   * @brief Enqueue a tag receive operation for a message of unknown size.
+   *
+   * Enqueue a tag receive operation for a message whose size is not known in advance,
+   * returning a `std::shared<ucxx::RequestTagAnySize>` that can be later awaited and
+   * checked for errors. The message is probed with `ucp_tag_probe_nb()` each time the
+   * worker is progressed until it arrives, at which point a buffer of exactly its size is
+   * allocated with `allocator` and the message received into it with
+   * `ucp_tag_msg_recv_nbx()`. The received buffer is then available from
+   * `ucxx::RequestTagAnySize::getRecvBuffer()`.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`
+   * auto request = worker->tagRecvAnySize(0);
+   * while (!request->isCompleted())
+   *   worker->progress();
+   * request->checkError();
+   * auto buffer = request->getRecvBuffer();
+   * @endcode
+   *
+   * @param[in] tag               the tag to match.
+   * @param[in] enableFuture      whether a future should be created and subsequently
+   *                              notified.
+   * @param[in] callbackFunction  user-defined callback function to call upon completion.
+   * @param[in] callbackData      user-defined data to pass to the `callbackFunction`.
+   * @param[in] allocator         allocator of the receive buffer given the message length,
+   *                              a host buffer is allocated if `nullptr`.
+   *
+   * @returns Request to be subsequently checked for the completion, its state and the
+   *          buffer received.
+   */
+  std::shared_ptr<RequestTagAnySize> tagRecvAnySize(
+    ucp_tag_t tag,
+    const bool enableFuture                                     = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr,
+    BufferAllocatorType allocator                               = nullptr);
+
+  /**
+   * @brief Register a receive of unknown size whose message has not arrived yet.
+   *
+   * Register a receive of unknown size to be probed for its message each time the worker
+   * is progressed, until the message arrives or the request is canceled. If no older
+   * receives of unknown size are pending, the message is probed immediately. This is
+   * called by `ucxx::RequestTagAnySize` and is not usually called directly.
+   *
+   * @param[in] request the request to register.
+   */
+  void registerTagProbe(std::shared_ptr<RequestTagAnySize> request);
+
+  /**
+   * @brief Register a handler of Active Messages.
+   *
+   * Register a handler to be called with each Active Message sent with identifier `id` to
+   * this worker, see `ucxx::Endpoint::amSend()`, replacing any handler previously
+   * registered for it. Messages sent eagerly are passed to the handler with their data in
+   * place, valid only until the handler returns. Rendezvous data is instead fetched
+   * directly into a buffer allocated by `allocator`, and the handler is called once the
+   * data has been fetched, taking ownership of the buffer via `ucxx::AmMessage::buffer`.
+   *
+   * Handlers are called from the thread progressing the worker and must not block. Passing
+   * `nullptr` as `handler` removes the handler registered for `id`, after which messages
+   * sent with `id` are discarded by UCX.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`
+   * worker->registerAmHandler(0, [](const ucxx::AmMessage& message, void* arg) {
+   *   // Copy `message.data` or keep `message.buffer` before returning
+   * });
+   * @endcode
+   *
+   * @throws ucxx::Error if UCX failed to register the handler.
+   *
+   * @param[in] id          the identifier of the Active Messages to handle.
+   * @param[in] handler     the handler to call with each message, or `nullptr` to remove
+   *                        the handler registered for `id`.
+   * @param[in] handlerArg  the argument to be passed to the handler.
+   * @param[in] allocator   allocator of buffers for rendezvous data given its length, must
+   *                        not throw, a host buffer is allocated if `nullptr`.
+   */
+  void registerAmHandler(unsigned id,
+                         AmHandlerType handler,
+                         void* handlerArg              = nullptr,
+                         BufferAllocatorType allocator = nullptr);
+
+  /**
+   * @brief Enqueue a batch of tag receive operations.
+   *
+   * Enqueue one tag receive operation for each (buffer, length, tag) entry, returning the
+   * group of `std::shared<ucxx::Request>` in the same order, each of which must be
+   * verified for completion before its data can be consumed. The entire batch pays for a
+   * single inflight requests registration, a single delayed submission registration and,
+   * if delayed submission is enabled, a single worker wakeup.
+   *
+   * @throws  std::runtime_error  if sizes of `buffers`, `lengths` and `tags` do not match.
+   *
+   * @param[in] buffers       a vector of raw pointers to pre-allocated memory where
+   *                          resulting data will be stored.
+   * @param[in] lengths       a vector of size in bytes of each message to be received.
+   * @param[in] tags          a vector of the tag to match for each message.
+   * @param[in] enableFuture  whether a future should be created and subsequently
+   *                          notified for each request.
+   *
+   * @returns Requests to be subsequently checked for the completion and their state.
+   */
+  std::vector<std::shared_ptr<Request>> tagRecvBatch(const std::vector<void*>& buffers,
+                                                     const std::vector<size_t>& lengths,
+                                                     const std::vector<ucp_tag_t>& tags,
+                                                     const bool enableFuture = false);
+
+  /**
+   * @brief Enqueue closing many endpoints concurrently.
+   *
+   * Enqueue a non-blocking close of each endpoint, equivalent to calling
+   * `ucxx::Endpoint::closeAsync()` on each of them, returning the group of
+   * `std::shared<ucxx::Request>` in the same order. All closes are submitted together by
+   * a single delayed submission and thus progress concurrently, instead of serializing
+   * one blocking close after another. Endpoints that were already closed complete with
+   * `UCS_ERR_NOT_CONNECTED`.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`, `endpoints` are endpoints created
+   * // from it.
+   * auto requests = worker->closeEndpoints(endpoints, ucxx::EndpointCloseMode::Force);
+   * @endcode
+   *
+   * @throws  ucxx::Error if any of the endpoints was not created from this worker.
+   *
+   * @param[in] endpoints     the endpoints to close.
+   * @param[in] mode          whether to flush outstanding operations or force close.
+   * @param[in] enableFuture  whether a future should be created and subsequently
+   *                          notified for each request.
+   *
+   * @returns Requests to be subsequently checked for the completion and their state.
+   */
+  std::vector<std::shared_ptr<Request>> closeEndpoints(
+    const std::vector<std::shared_ptr<Endpoint>>& endpoints,
+    const EndpointCloseMode mode = EndpointCloseMode::Flush,
+    const bool enableFuture      = false);
+
   /**
    * @brief Get the address of the UCX worker object.
    *
@@ -572,9 +1303,8 @@ class Worker : public Component {
    * auto ep = worker->createEndpointFromHostname("10.10.10.10", 12345);
    * @endcode
    *
-   * @throws std::invalid_argument if the IP address or hostname is invalid.
-   * @throws std::bad_alloc if there was an error allocating space to handle the address.
-   * @throws ucxx::Error if an error occurred while attempting to create the endpoint.
+   * @throws ucxx::Error if the IP address or hostname could not be resolved or an error
+   *                     occurred while attempting to create the endpoint.
    *
    * @param[in] ipAddress string containing the IP address of the remote worker.
    * @param[in] port port number where the remote worker is listening at.
@@ -587,6 +1317,46 @@ class Worker : public Component {
                                                        uint16_t port,
                                                        bool endpointErrorHandling = true);
 
+  /**
+   * @brief Enqueue creating an endpoint to worker listening on specific IP and port.
+   *
+   * Enqueue creating an endpoint to a remote worker listening on a specific hostname or
+   * IP address and port, without blocking the caller on hostname resolution. The hostname
+   * is resolved by the worker's `ucxx::HostnameResolver`, which caches resolved addresses
+   * and supports both IPv4 and IPv6, after which the endpoint is created. The request
+   * completes once the endpoint is created, which is then available via
+   * `ucxx::RequestEndpointCreate::getEndpoint()`. If the hostname can't be resolved the
+   * request completes with `UCS_ERR_INVALID_ADDR`.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`
+   * // Create endpoint to worker listening on `remote-host:12345`.
+   * auto request = worker->createEndpointFromHostnameAsync("remote-host", 12345);
+   * while (!request->isCompleted()) worker->progress();
+   * request->checkError();
+   * auto ep = request->getEndpoint();
+   * @endcode
+   *
+   * @param[in] ipAddress             string containing the hostname or IP address of the
+   *                                  remote worker.
+   * @param[in] port                  port number where the remote worker is listening at.
+   * @param[in] endpointErrorHandling enable endpoint error handling if `true`,
+   *                                  disable otherwise.
+   * @param[in] enableFuture          whether a future should be created and subsequently
+   *                                  notified.
+   * @param[in] callbackFunction      user-defined callback function to call upon completion.
+   * @param[in] callbackData          user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<RequestEndpointCreate> createEndpointFromHostnameAsync(
+    std::string ipAddress,
+    uint16_t port,
+    bool endpointErrorHandling                                  = true,
+    const bool enableFuture                                     = false,
+    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+    std::shared_ptr<void> callbackData                          = nullptr);
+
   /**
    * @brief Create endpoint to worker located at UCX address.
    *
@@ -618,6 +1388,55 @@ class Worker : public Component {
   std::shared_ptr<Endpoint> createEndpointFromWorkerAddress(std::shared_ptr<Address> address,
                                                             bool endpointErrorHandling = true);
 
+  /**
+   * @brief Accept a connection request on this worker.
+   *
+   * Create an endpoint on this worker from a `ucp_conn_request_h` delivered by the
+   * connection callback of a `ucxx::Listener`, which may have been created from a
+   * different worker. This allows a single listener to spread accepted connections
+   * across multiple workers, see also `ucxx::WorkerPool::createEndpointFromConnRequest()`.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`, with a `ucp_conn_request_h` delivered
+   * // by the connection callback of a listener created from another worker.
+   * auto ep = worker->createEndpointFromConnRequest(connRequest);
+   * @endcode
+   *
+   * @throws ucxx::Error if an error occurred while attempting to create the endpoint.
+   *
+   * @param[in] connRequest           handle to connection request delivered by a
+   *                                  listener callback.
+   * @param[in] endpointErrorHandling enable endpoint error handling if `true`,
+   *                                  disable otherwise.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object
+   */
+  std::shared_ptr<Endpoint> createEndpointFromConnRequest(ucp_conn_request_h connRequest,
+                                                          bool endpointErrorHandling = true);
+
+  /**
+   * @brief Create a pool of reusable endpoints.
+   *
+   * Create a new `ucxx::EndpointPool` as a child of the current `ucxx::Worker`, keeping
+   * endpoints released by the application for reuse by subsequent connections to the
+   * same peer. See `ucxx::createEndpointPool()` for details.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`
+   * auto endpointPool = worker->createEndpointPool(128, std::chrono::seconds(30));
+   * auto ep = endpointPool->getFromHostname("10.10.10.10", 12345);
+   * @endcode
+   *
+   * @param[in] maxSize      maximum number of idle endpoints kept, the least recently
+   *                         released are evicted beyond that.
+   * @param[in] idleTimeout  time after which idle endpoints are evicted.
+   *
+   * @returns The `shared_ptr<ucxx::EndpointPool>` object
+   */
+  std::shared_ptr<EndpointPool> createEndpointPool(
+    const size_t maxSize                        = 1024,
+    const std::chrono::milliseconds idleTimeout = std::chrono::milliseconds(60000));
+
   /**
    * @brief Listen for remote connections on given port.
    *
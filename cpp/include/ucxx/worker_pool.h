@@ -0,0 +1,343 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/constructors.h>
+#include <ucxx/context.h>
+#include <ucxx/typedefs.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+class WorkerPool : public Component {
+ private:
+  std::vector<std::shared_ptr<Worker>> _workers{};  ///< The workers owned by the pool
+  std::vector<std::vector<std::weak_ptr<Endpoint>>>
+    _endpoints{};  ///< Endpoints created by the pool on each worker, used to compute load
+  std::mutex _endpointsMutex{};        ///< Mutex to access the endpoints created by the pool
+  std::atomic<size_t> _nextWorker{0};  ///< Index of the next worker for round-robin placement
+  WorkerPoolPlacement _placement{WorkerPoolPlacement::RoundRobin};  ///< The placement strategy
+
+  /**
+   * @brief Private constructor of `ucxx::WorkerPool`.
+   *
+   * This is the internal implementation of `ucxx::WorkerPool` constructor, made private not
+   * to be called directly. Instead the user should call `context::createWorkerPool()` or
+   * `ucxx::createWorkerPool()`.
+   *
+   * @param[in] context                 the context from which to create the workers.
+   * @param[in] numWorkers              the number of workers in the pool.
+   * @param[in] enableDelayedSubmission whether the workers should delay transfer requests
+   *                                    to their progress threads.
+   * @param[in] placement               the strategy to select a worker for new endpoints.
+   */
+  WorkerPool(std::shared_ptr<Context> context,
+             const size_t numWorkers,
+             const bool enableDelayedSubmission,
+             const WorkerPoolPlacement placement);
+
+  /**
+   * @brief Remove endpoints that were destroyed.
+   *
+   * Remove expired references from the endpoints created by the pool on a worker, must be
+   * called with `_endpointsMutex` held.
+   *
+   * @param[in] endpoints the endpoints created by the pool on a worker.
+   */
+  static void pruneEndpoints(std::vector<std::weak_ptr<Endpoint>>& endpoints);
+
+  /**
+   * @brief Register an endpoint created by the pool.
+   *
+   * Register an endpoint created by the pool on the worker of index `workerIndex`, to be
+   * accounted for in least-loaded placement. Destroyed endpoints are pruned whenever the
+   * container would grow, thus its size stays proportional to the live endpoints.
+   *
+   * @param[in] workerIndex the index of the worker the endpoint was created on.
+   * @param[in] endpoint    the endpoint that was created.
+   */
+  void registerEndpoint(const size_t workerIndex, std::shared_ptr<Endpoint> endpoint);
+
+  /**
+   * @brief Select the index of the worker for a new endpoint.
+   *
+   * Select the index of the worker on which a new endpoint should be created according to
+   * the placement strategy.
+   *
+   * @param[in] peerKey a key identifying the remote peer, used by `PeerHash` placement.
+   *
+   * @returns The index of the selected worker.
+   */
+  size_t selectWorkerIndex(const std::string& peerKey);
+
+ public:
+  WorkerPool()                  = delete;
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(WorkerPool const&) = delete;
+  WorkerPool(WorkerPool&& o)               = delete;
+  WorkerPool& operator=(WorkerPool&& o) = delete;
+
+  /**
+   * @brief Constructor of `shared_ptr<ucxx::WorkerPool>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::WorkerPool>` object. A worker pool owns
+   * `numWorkers` workers, each with its own progress thread once started, allowing
+   * progress to scale to multiple cores. Endpoints are sharded across workers according
+   * to the `placement` strategy.
+   *
+   * @code{.cpp}
+   * // context is `std::shared_ptr<ucxx::Context>`
+   * auto workerPool = context->createWorkerPool(4);
+   * workerPool->startProgressThreads(false);
+   *
+   * // Equivalent to line above
+   * // auto workerPool = ucxx::createWorkerPool(context, 4, false,
+   * //                                          ucxx::WorkerPoolPlacement::RoundRobin);
+   *
+   * auto ep = workerPool->createEndpointFromHostname("10.10.10.10", 12345);
+   * @endcode
+   *
+   * @param[in] context                 the context from which to create the workers.
+   * @param[in] numWorkers              the number of workers in the pool.
+   * @param[in] enableDelayedSubmission whether the workers should delay transfer requests
+   *                                    to their progress threads.
+   * @param[in] placement               the strategy to select a worker for new endpoints.
+   *
+   * @throws std::invalid_argument if `numWorkers` is `0`.
+   *
+   * @returns The `shared_ptr<ucxx::WorkerPool>` object.
+   */
+  friend std::shared_ptr<WorkerPool> createWorkerPool(std::shared_ptr<Context> context,
+                                                      const size_t numWorkers,
+                                                      const bool enableDelayedSubmission,
+                                                      const WorkerPoolPlacement placement);
+
+  /**
+   * @brief `ucxx::WorkerPool` destructor.
+   *
+   * Cancels inflight requests and stops progress threads of all workers in the pool.
+   */
+  ~WorkerPool();
+
+  /**
+   * @brief Get the number of workers in the pool.
+   *
+   * @returns The number of workers in the pool.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Get a worker from the pool.
+   *
+   * @param[in] index the index of the worker, must be smaller than `size()`.
+   *
+   * @throws std::out_of_range if `index` is not smaller than `size()`.
+   *
+   * @returns The `shared_ptr<ucxx::Worker>` at position `index`.
+   */
+  std::shared_ptr<Worker> getWorker(const size_t index) const;
+
+  /**
+   * @brief Get all workers from the pool.
+   *
+   * @returns The `shared_ptr<ucxx::Worker>` objects owned by the pool.
+   */
+  const std::vector<std::shared_ptr<Worker>>& getWorkers() const;
+
+  /**
+   * @brief Get the placement strategy.
+   *
+   * @returns The strategy used to select a worker for new endpoints.
+   */
+  WorkerPoolPlacement getPlacement() const;
+
+  /**
+   * @brief Select a worker for a new endpoint.
+   *
+   * Select a worker according to the placement strategy, useful for creating other
+   * objects, such as listeners, on the pool.
+   *
+   * @param[in] peerKey a key identifying the remote peer, used by `PeerHash` placement.
+   *
+   * @returns The selected `shared_ptr<ucxx::Worker>`.
+   */
+  std::shared_ptr<Worker> selectWorker(const std::string& peerKey = "");
+
+  /**
+   * @brief Get the number of live endpoints created by the pool on a worker.
+   *
+   * @param[in] index the index of the worker, must be smaller than `size()`.
+   *
+   * @returns The number of endpoints created by the pool on the worker that are alive.
+   */
+  size_t getEndpointCount(const size_t index);
+
+  /**
+   * @brief Get the number of inflight requests on a worker.
+   *
+   * Get the number of inflight requests of the worker itself and of the live endpoints
+   * created by the pool on it, used by `LeastInflight` placement.
+   *
+   * @param[in] index the index of the worker, must be smaller than `size()`.
+   *
+   * @returns The number of requests on the worker that have not completed yet.
+   */
+  size_t getInflightRequestCount(const size_t index);
+
+  /**
+   * @brief Set callback to be executed at the start of each progress thread.
+   *
+   * Sets a callback that will be executed at the beginning of the progress thread of each
+   * worker, see `ucxx::Worker::setProgressThreadStartCallback()`.
+   *
+   * @param[in] callback    function to execute during progress thread start.
+   * @param[in] callbackArg argument to be passed to the callback function.
+   */
+  void setProgressThreadStartCallback(std::function<void(void*)> callback, void* callbackArg);
+
+  /**
+   * @brief Start progress threads of all workers.
+   *
+   * Start progress threads of all workers, optionally pinning each of them to a set of
+   * CPUs, see `ucxx::Worker::startProgressThread()`.
+   *
+   * @code{.cpp}
+   * // Pin the progress thread of worker 0 to CPU 2 and of worker 1 to CPU 3
+   * workerPool->startProgressThreads(false, {{2}, {3}});
+   * @endcode
+   *
+   * @param[in] pollingMode   use polling mode if `true`, or blocking mode if `false`.
+   * @param[in] cpuAffinities the CPUs to pin the progress thread of each worker to, indexed
+   *                          by worker. Workers without an entry or with an empty entry are
+   *                          not pinned.
+   */
+  void startProgressThreads(const bool pollingMode                                = false,
+                            const std::vector<std::vector<size_t>>& cpuAffinities = {});
+
+  /**
+   * @brief Stop progress threads of all workers.
+   */
+  void stopProgressThreads();
+
+  /**
+   * @brief Cancel inflight requests of all workers.
+   *
+   * Cancel requests posted directly on the workers of the pool, see
+   * `ucxx::Worker::cancelAllInflightRequests()`, and requests submitted on endpoints
+   * created through the pool.
+   *
+   * @returns Total number of requests that were canceled.
+   */
+  size_t cancelInflightRequests();
+
+  /**
+   * @brief Shutdown the pool.
+   *
+   * Stop progress threads of all workers and cancel inflight requests, see
+   * `cancelInflightRequests()`, progressing each worker once so that canceled requests
+   * complete. Workers are still valid after shutdown and progress threads may be
+   * restarted.
+   */
+  void shutdown();
+
+  /**
+   * @brief Create endpoint to worker listening on specific IP and port.
+   *
+   * Create an endpoint on a worker selected by the placement strategy, `PeerHash`
+   * placement uses the IP address and port to identify the peer. See
+   * `ucxx::Worker::createEndpointFromHostname()` for details.
+   *
+   * @param[in] ipAddress             string containing the IP address of the remote
+   *                                  worker.
+   * @param[in] port                  port number where the remote worker is listening
+   *                                  at.
+   * @param[in] endpointErrorHandling enable endpoint error handling if `true`,
+   *                                  disable otherwise.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object.
+   */
+  std::shared_ptr<Endpoint> createEndpointFromHostname(std::string ipAddress,
+                                                       uint16_t port,
+                                                       bool endpointErrorHandling = true);
+
+  /**
+   * @brief Create endpoint to worker located at UCX address.
+   *
+   * Create an endpoint on a worker selected by the placement strategy, `PeerHash`
+   * placement uses the remote worker address to identify the peer. See
+   * `ucxx::Worker::createEndpointFromWorkerAddress()` for details.
+   *
+   * @param[in] address               address of the remote UCX worker.
+   * @param[in] endpointErrorHandling enable endpoint error handling if `true`,
+   *                                  disable otherwise.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object.
+   */
+  std::shared_ptr<Endpoint> createEndpointFromWorkerAddress(std::shared_ptr<Address> address,
+                                                            bool endpointErrorHandling = true);
+
+  /**
+   * @brief Accept a connection request on a worker of the pool.
+   *
+   * Create an endpoint from a `ucp_conn_request_h` delivered by a listener connection
+   * callback on a worker selected by the placement strategy, `PeerHash` placement uses
+   * the IP address of the client to identify the peer. Calling this from the callback of
+   * a listener created with `createListener()` spreads connections accepted on a single
+   * port across all workers of the pool and their progress threads, instead of having
+   * all of them progressed by the listener's worker.
+   *
+   * @code{.cpp}
+   * void listenerCallback(ucp_conn_request_h connRequest, void* arg)
+   * {
+   *   auto server = reinterpret_cast<Server*>(arg);
+   *   server->endpoints.push_back(server->workerPool->createEndpointFromConnRequest(connRequest));
+   * }
+   *
+   * // workerPool is `std::shared_ptr<ucxx::WorkerPool>`
+   * auto listener = workerPool->createListener(12345, listenerCallback, &server);
+   * @endcode
+   *
+   * @throws ucxx::Error if an error occurred while attempting to create the endpoint.
+   *
+   * @param[in] connRequest           handle to connection request delivered by a
+   *                                  listener callback.
+   * @param[in] endpointErrorHandling enable endpoint error handling if `true`,
+   *                                  disable otherwise.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object.
+   */
+  std::shared_ptr<Endpoint> createEndpointFromConnRequest(ucp_conn_request_h connRequest,
+                                                          bool endpointErrorHandling = true);
+
+  /**
+   * @brief Listen for remote connections on given port.
+   *
+   * Create a listener on a worker selected by the placement strategy. Endpoints created
+   * with `ucxx::Listener::createEndpointFromConnRequest()` live on the listener's worker,
+   * use `createEndpointFromConnRequest()` instead to spread them across the pool. See
+   * `ucxx::Worker::createListener()` for details.
+   *
+   * @param[in] port          port number where to listen at.
+   * @param[in] callback      to handle each incoming connection.
+   * @param[in] callbackArgs  pointer to argument to pass to the callback.
+   *
+   * @returns The `shared_ptr<ucxx::Listener>` object.
+   */
+  std::shared_ptr<Listener> createListener(uint16_t port,
+                                           ucp_listener_conn_callback_t callback,
+                                           void* callbackArgs);
+};
+
+}  // namespace ucxx
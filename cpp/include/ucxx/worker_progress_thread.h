@@ -5,9 +5,11 @@
 #pragma once
 
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include <ucxx/delayed_submission.h>
 
@@ -29,14 +31,17 @@ class WorkerProgressThread {
     nullptr};  ///< Callback to execute at start of the progress thread
   ProgressThreadStartCallbackArg _startCallbackArg{
     nullptr};  ///< Argument to pass to start callback
+  std::vector<size_t> _cpuAffinity{};  ///< CPUs the thread is pinned to, empty if not pinned
 
   /**
    * @brief The function executed in the new thread.
    *
-   * This function ensures the `startCallback` is executed once at the start of the thread,
-   * subsequently starting a continuous loop that processes any delayed submission requests
-   * that are pending in the `delayedSubmissionCollection` followed by the execution of the
-   * `progressFunction`, the loop repeats until `stop` is set.
+   * This function ensures the thread is pinned to `cpuAffinity` (if not empty) and the
+   * `startCallback` is executed once at the start of the thread, subsequently starting a
+   * continuous loop that processes any delayed submission requests that are pending in the
+   * `delayedSubmissionCollection` followed by the execution of the `progressFunction`, the
+   * loop repeats until `stop` is set. The result of pinning the thread is reported via
+   * `pinned`, if pinning fails the thread exits without progressing.
    *
    * @param[in] progressFunction            user-defined progress function implementation.
    * @param[in] stop                        reference to the stop signal causing the
@@ -46,13 +51,18 @@ class WorkerProgressThread {
    * @param[in] startCallbackArg            an argument to be passed to the start callback.
    * @param[in] delayedSubmissionCollection collection of delayed submissions to be
    *                                        processed during progress.
+   * @param[in] cpuAffinity                 CPUs to pin the thread to, not pinned if empty.
+   * @param[out] pinned                     promise set once the thread has been pinned,
+   *                                        or with the exception raised when pinning.
    */
   static void progressUntilSync(
     std::function<bool(void)> progressFunction,
     const bool& stop,
     ProgressThreadStartCallback startCallback,
     ProgressThreadStartCallbackArg startCallbackArg,
-    std::shared_ptr<DelayedSubmissionCollection> delayedSubmissionCollection);
+    std::shared_ptr<DelayedSubmissionCollection> delayedSubmissionCollection,
+    std::vector<size_t> cpuAffinity,
+    std::promise<void> pinned);
 
  public:
   WorkerProgressThread() = delete;
@@ -82,13 +92,19 @@ class WorkerProgressThread {
    * @param[in] startCallbackArg            an argument to be passed to the start callback.
    * @param[in] delayedSubmissionCollection collection of delayed submissions to be
    *                                        processed during progress.
+   * @param[in] cpuAffinity                 CPUs to pin the thread to before executing
+   *                                        `startCallback`, not pinned if empty.
+   *
+   * @throws std::invalid_argument  if `cpuAffinity` contains an invalid CPU index.
+   * @throws ucxx::Error            if pinning the thread to `cpuAffinity` failed.
    */
   WorkerProgressThread(const bool pollingMode,
                        std::function<bool(void)> progressFunction,
                        std::function<void(void)> signalWorkerFunction,
                        ProgressThreadStartCallback startCallback,
                        ProgressThreadStartCallbackArg startCallbackArg,
-                       std::shared_ptr<DelayedSubmissionCollection> delayedSubmissionCollection);
+                       std::shared_ptr<DelayedSubmissionCollection> delayedSubmissionCollection,
+                       const std::vector<size_t>& cpuAffinity = {});
 
   /**
    * @brief `ucxx::WorkerProgressThread destructor.
@@ -103,6 +119,20 @@ class WorkerProgressThread {
    * @returns Whether polling mode is enabled.
    */
   bool pollingMode() const;
+
+  /**
+   * @brief Returns the CPUs the thread is pinned to.
+   *
+   * @returns The CPUs the thread is pinned to, empty if the thread is not pinned.
+   */
+  const std::vector<size_t>& getCpuAffinity() const;
+
+  /**
+   * @brief Returns the identifier of the thread.
+   *
+   * @returns The identifier of the underlying `std::thread`.
+   */
+  std::thread::id getId() const;
 };
 
 }  // namespace ucxx
@@ -55,6 +55,38 @@ PyObject* future_set_result(PyObject* future, PyObject* value);
  */
 PyObject* future_set_exception(PyObject* future, PyObject* exception, const char* message);
 
+/**
+ * @brief Set the result of a Python future while holding the GIL.
+ *
+ * Set the result of a Python future, equivalent to `future_set_result()` but requiring
+ * the caller to already own the Python GIL. This allows setting the result of multiple
+ * futures acquiring the GIL only once.
+ *
+ * @param[in] future  Python object containing the `_asyncio.Future` object.
+ * @param[in] value   Python object containing an arbitrary value to set the future result
+ *                    to.
+ *
+ * @returns The result of the call to `_asyncio.Future.set_result()`.
+ */
+PyObject* future_set_result_with_gil(PyObject* future, PyObject* value);
+
+/**
+ * @brief Set the exception of a Python future while holding the GIL.
+ *
+ * Set the exception of a Python future, equivalent to `future_set_exception()` but
+ * requiring the caller to already own the Python GIL. This allows setting the exception
+ * of multiple futures acquiring the GIL only once.
+ *
+ * @param[in] future    Python object containing the `_asyncio.Future` object.
+ * @param[in] exception a Python exception derived of the `Exception` class.
+ * @param[in] message   human-readable error message for the exception.
+ *
+ * @returns The result of the call to `_asyncio.Future.set_exception()`.
+ */
+PyObject* future_set_exception_with_gil(PyObject* future,
+                                        PyObject* exception,
+                                        const char* message);
+
 }  // namespace python
 
 }  // namespace ucxx
@@ -22,19 +22,24 @@ class Notifier : public ::ucxx::Notifier {
   std::mutex _notifierThreadMutex{};  ///< Mutex to access thread's resources
   std::vector<std::pair<std::shared_ptr<::ucxx::Future>, ucs_status_t>>
     _notifierThreadFutureStatus{};               ///< Container with futures and statuses to set
+  std::vector<std::pair<std::shared_ptr<::ucxx::Future>, ucs_status_t>>
+    _notifierThreadFutureStatusBatch{};  ///< Batch being notified, reused to avoid allocations
   bool _notifierThreadFutureStatusReady{false};  ///< Whether a future is scheduled for notification
   RequestNotifierThreadState _notifierThreadFutureStatusFinished{
     RequestNotifierThreadState::NotRunning};  ///< State of the notifier thread
   std::condition_variable
     _notifierThreadConditionVariable{};  ///< Condition variable used to wait for event
+  int _eventFileDescriptor{-1};  ///< The eventfd signaled when futures are scheduled
 
   /**
    * @brief Private constructor of `ucxx::python::Notifier`.
    *
    * This is the internal `ucxx::python::Notifier` constructor, made private not to be
    * called directly. Instead the user should call `ucxx::python::createNotifier()`.
+   *
+   * @throws std::ios_base::failure if the eventfd could not be created.
    */
-  Notifier() = default;
+  Notifier();
 
   /**
    * @brief Wait for a new event without a timeout.
@@ -83,7 +88,7 @@ class Notifier : public ::ucxx::Notifier {
   /**
    * @brief Virtual destructor.
    *
-   * Virtual destructor with empty implementation.
+   * Closes the eventfd.
    */
   virtual ~Notifier();
 
@@ -95,6 +100,9 @@ class Notifier : public ::ucxx::Notifier {
    * this call does not notify the Python asyncio event loop, it does not require the GIL
    * to execute.
    *
+   * The eventfd is only written when the first future of a batch is scheduled, thus
+   * subsequent futures completing before the batch is notified require no system calls.
+   *
    * This is meant to be called from `ucxx::python::Future::notify()`.
    *
    * @param[in] future  Python future to notify.
@@ -123,9 +131,26 @@ class Notifier : public ::ucxx::Notifier {
    * futures. Notifying the event loop requires taking the Python GIL, thus it cannot run
    * indefinitely but must instead run periodically. Futures that completed must first be
    * scheduled with `scheduleFutureNotify()`.
+   *
+   * All pending futures are drained at once and completed in a single pass, acquiring the
+   * GIL only once per batch. The eventfd is cleared before draining, so that it becomes
+   * readable again if a new batch is scheduled meanwhile. Must not be called concurrently
+   * from multiple threads.
    */
   void runRequestNotifier() override;
 
+  /**
+   * @brief Get the eventfd signaled when futures are ready to be notified.
+   *
+   * Get the eventfd that becomes readable when completed futures are scheduled with
+   * `scheduleFutureNotify()`. Registering it with the asyncio event loop, for example via
+   * `loop.add_reader()`, allows the event loop to call `runRequestNotifier()` directly when
+   * futures are ready, without a notifier thread or a cross-thread handoff.
+   *
+   * @returns The eventfd.
+   */
+  int getEventFileDescriptor() override;
+
   /**
    * @brief Make known to the notifier thread that it should stop.
    *
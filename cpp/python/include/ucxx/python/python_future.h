@@ -86,6 +86,19 @@ class Future : public ::ucxx::Future {
    */
   void set(ucs_status_t status);
 
+  /**
+   * @brief Set the future completion status while holding the GIL.
+   *
+   * Set the future status as completed, either with a successful completion or error,
+   * equivalent to `set()` but requiring the caller to already own the Python GIL. Used by
+   * `ucxx::python::Notifier` to complete a batch of futures acquiring the GIL only once.
+   *
+   * @throws std::runtime_error if the object is invalid or has been already released.
+   *
+   * @param[in] status  request completion status.
+   */
+  void setWithGIL(ucs_status_t status);
+
   /**
    * @brief Get the underlying `PyObject*` handle but does not release ownership.
    *
@@ -126,6 +126,18 @@ class Worker : public ::ucxx::Worker {
    * Signals the notifier to terminate, awakening the `waitRequestNotifier()` blocking call.
    */
   void stopRequestNotifierThread() override;
+
+  /**
+   * @brief Get the file descriptor signaled when Python futures are ready to be notified.
+   *
+   * Get the notifier's file descriptor, which becomes readable when some communication is
+   * completed and Python futures are ready to be notified. It is intended to be registered
+   * with the Python asyncio event loop, which then calls `runRequestNotifier()` directly
+   * when it becomes readable, without the need for a Python notifier thread.
+   *
+   * @returns The file descriptor signaled when Python futures are ready to be notified.
+   */
+  int getRequestNotifierFileDescriptor() override;
 };
 
 }  // namespace python
@@ -105,45 +105,64 @@ static PyCFunction get_future_method(const char* method_name)
   if (PyErr_Occurred()) PyErr_Print();
   PyMethodDef* m = reinterpret_cast<PyTypeObject*>(future_object)->tp_methods;
 
-  for (; m != NULL; ++m) {
-    if (m->ml_name && !strcmp(m->ml_name, method_name)) {
+  for (; m != NULL && m->ml_name != NULL; ++m) {
+    if (!strcmp(m->ml_name, method_name)) {
       result = m->ml_meth;
       break;
     }
   }
 
   if (!result)
-    PyErr_Format(PyExc_RuntimeError, "Unable to load function pointer for `Future.set_result`.");
+    PyErr_Format(
+      PyExc_RuntimeError, "Unable to load function pointer for `Future.%s`.", method_name);
 
   PyGILState_Release(state);
   return result;
 }
 
-PyObject* future_set_result(PyObject* future, PyObject* value)
+// Method pointers are resolved once, both are only accessed while holding the GIL.
+static PyCFunction future_set_result_method    = NULL;
+static PyCFunction future_set_exception_method = NULL;
+
+PyObject* future_set_result_with_gil(PyObject* future, PyObject* value)
 {
   PyObject* result = NULL;
 
-  PyGILState_STATE state = PyGILState_Ensure();
+  if (future_set_result_method == NULL) future_set_result_method = get_future_method("set_result");
+  if (future_set_result_method == NULL) return NULL;
 
-  PyCFunction f = get_future_method("set_result");
-  result        = f(future, value);
+  result = future_set_result_method(future, value);
   if (PyErr_Occurred()) ucxx_trace_req("Python error here");
   if (PyErr_Occurred()) PyErr_Print();
 
+  return result;
+}
+
+PyObject* future_set_result(PyObject* future, PyObject* value)
+{
+  PyObject* result = NULL;
+
+  PyGILState_STATE state = PyGILState_Ensure();
+
+  result = future_set_result_with_gil(future, value);
+
   PyGILState_Release(state);
 
   return result;
 }
 
-PyObject* future_set_exception(PyObject* future, PyObject* exception, const char* message)
+PyObject* future_set_exception_with_gil(PyObject* future,
+                                        PyObject* exception,
+                                        const char* message)
 {
   PyObject* result           = NULL;
   PyObject* message_object   = NULL;
   PyObject* message_tuple    = NULL;
   PyObject* formed_exception = NULL;
-  PyCFunction f              = NULL;
 
-  PyGILState_STATE state = PyGILState_Ensure();
+  if (future_set_exception_method == NULL)
+    future_set_exception_method = get_future_method("set_exception");
+  if (future_set_exception_method == NULL) return NULL;
 
   message_object = PyUnicode_FromString(message);
   if (message_object == NULL) goto err;
@@ -152,9 +171,7 @@ PyObject* future_set_exception(PyObject* future, PyObject* exception, const char
   formed_exception = PyObject_Call(exception, message_tuple, NULL);
   if (formed_exception == NULL) goto err;
 
-  f = get_future_method("set_exception");
-
-  result = f(future, formed_exception);
+  result = future_set_exception_method(future, formed_exception);
   goto finish;
 
 err:
@@ -163,7 +180,19 @@ finish:
   Py_XDECREF(message_object);
   Py_XDECREF(message_tuple);
   Py_XDECREF(formed_exception);
+  return result;
+}
+
+PyObject* future_set_exception(PyObject* future, PyObject* exception, const char* message)
+{
+  PyObject* result = NULL;
+
+  PyGILState_STATE state = PyGILState_Ensure();
+
+  result = future_set_exception_with_gil(future, exception, message);
+
   PyGILState_Release(state);
+
   return result;
 }
 
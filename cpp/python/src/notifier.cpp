@@ -2,9 +2,18 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <cerrno>
+#include <cstdint>
+#include <ios>
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <Python.h>
 
 #include <ucxx/log.h>
 #include <ucxx/python/notifier.h>
@@ -19,19 +28,38 @@ std::shared_ptr<::ucxx::Notifier> createNotifier()
   return std::shared_ptr<::ucxx::Notifier>(new ::ucxx::python::Notifier());
 }
 
-Notifier::~Notifier() {}
+Notifier::Notifier()
+{
+  _eventFileDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (_eventFileDescriptor == -1) throw std::ios_base::failure("eventfd() returned -1");
+}
+
+Notifier::~Notifier()
+{
+  if (_eventFileDescriptor >= 0) close(_eventFileDescriptor);
+}
 
 void Notifier::scheduleFutureNotify(std::shared_ptr<::ucxx::Future> future, ucs_status_t status)
 {
   ucxx_trace_req(
     "Notifier::scheduleFutureNotify(): future: %p, handle: %p", future.get(), future->getHandle());
   auto p = std::make_pair(future, status);
+  bool firstInBatch{false};
   {
     std::lock_guard<std::mutex> lock(_notifierThreadMutex);
+    firstInBatch = _notifierThreadFutureStatus.empty();
     _notifierThreadFutureStatus.push_back(p);
     _notifierThreadFutureStatusReady = true;
   }
   _notifierThreadConditionVariable.notify_one();
+
+  // Only the first future of a batch needs to signal the eventfd, the batch is swapped out
+  // only after the eventfd is cleared by `runRequestNotifier()`.
+  if (firstInBatch) {
+    uint64_t value = 1;
+    if (write(_eventFileDescriptor, &value, sizeof(value)) != sizeof(value))
+      ucxx_trace_req("Notifier::scheduleFutureNotify() failed to write eventfd: %d", errno);
+  }
   ucxx_trace_req("Notifier::scheduleFutureNotify() notified: future: %p, handle: %p",
                  future.get(),
                  future->getHandle());
@@ -39,20 +67,46 @@ void Notifier::scheduleFutureNotify(std::shared_ptr<::ucxx::Future> future, ucs_
 
 void Notifier::runRequestNotifier()
 {
-  decltype(_notifierThreadFutureStatus) notifierThreadFutureStatus;
+  auto& batch = _notifierThreadFutureStatusBatch;
+
+  // Clear the eventfd before swapping, futures scheduled from now on belong to a new batch
+  // and signal the eventfd again.
+  uint64_t value;
+  if (read(_eventFileDescriptor, &value, sizeof(value)) < 0 && errno != EAGAIN)
+    ucxx_trace_req("Notifier::runRequestNotifier() failed to read eventfd: %d", errno);
+
   {
+    // Swapping preserves the capacity of both containers, avoiding reallocations.
     std::unique_lock<std::mutex> lock(_notifierThreadMutex);
-    notifierThreadFutureStatus = std::move(_notifierThreadFutureStatus);
+    std::swap(batch, _notifierThreadFutureStatus);
   }
 
-  ucxx_trace_req("Notifier::runRequestNotifier() notifying %lu", notifierThreadFutureStatus.size());
-  for (auto& p : notifierThreadFutureStatus) {
-    // r->future_set_result;
-    p.first->set(p.second);
-    ucxx_trace_req("Notifier::runRequestNotifier() notified future: %p, handle: %p",
-                   p.first.get(),
-                   p.first->getHandle());
+  if (batch.empty()) return;
+
+  ucxx_trace_req("Notifier::runRequestNotifier() notifying %lu", batch.size());
+
+  PyGILState_STATE state = PyGILState_Ensure();
+  try {
+    for (auto& p : batch) {
+      auto future = dynamic_cast<Future*>(p.first.get());
+      if (future != nullptr)
+        future->setWithGIL(p.second);
+      else
+        p.first->set(p.second);
+      ucxx_trace_req("Notifier::runRequestNotifier() notified future: %p, handle: %p",
+                     p.first.get(),
+                     p.first->getHandle());
+    }
+  } catch (...) {
+    batch.clear();
+    PyGILState_Release(state);
+    throw;
   }
+
+  // Release references while holding the GIL, futures destroyed here would otherwise
+  // reacquire it individually.
+  batch.clear();
+  PyGILState_Release(state);
 }
 
 RequestNotifierWaitState Notifier::waitRequestNotifierWithoutTimeout()
@@ -108,6 +162,8 @@ RequestNotifierWaitState Notifier::waitRequestNotifier(uint64_t period)
                       : waitRequestNotifierWithoutTimeout();
 }
 
+int Notifier::getEventFileDescriptor() { return _eventFileDescriptor; }
+
 void Notifier::stopRequestNotifierThread()
 {
   {
@@ -4,6 +4,7 @@
  */
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 #include <Python.h>
 
@@ -37,13 +38,24 @@ void Future::set(ucs_status_t status)
 {
   if (_handle == nullptr) throw std::runtime_error("Invalid object or already released");
 
+  PyGILState_STATE state = PyGILState_Ensure();
+  setWithGIL(status);
+  PyGILState_Release(state);
+}
+
+void Future::setWithGIL(ucs_status_t status)
+{
+  if (_handle == nullptr) throw std::runtime_error("Invalid object or already released");
+
   ucxx_trace_req(
     "Future::set() this: %p, _handle: %p, status: %s", this, _handle, ucs_status_string(status));
+  PyObject* result = NULL;
   if (status == UCS_OK)
-    future_set_result(_handle, Py_True);
+    result = future_set_result_with_gil(_handle, Py_True);
   else
-    future_set_exception(
+    result = future_set_exception_with_gil(
       _handle, get_python_exception_from_ucs_status(status), ucs_status_string(status));
+  Py_XDECREF(result);
 }
 
 void Future::notify(ucs_status_t status)
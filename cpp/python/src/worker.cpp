@@ -24,6 +24,7 @@ Worker::Worker(std::shared_ptr<Context> context,
                const bool enableFuture)
   : ::ucxx::Worker(context, enableDelayedSubmission)
 {
+  _enableFuture = enableFuture;
   if (_enableFuture) _notifier = createNotifier();
 }
 
@@ -114,6 +115,17 @@ void Worker::stopRequestNotifierThread()
   }
 }
 
+int Worker::getRequestNotifierFileDescriptor()
+{
+  if (_enableFuture) {
+    return _notifier->getEventFileDescriptor();
+  } else {
+    throw std::runtime_error(
+      "Worker future support disabled, please set enableFuture=true when creating the "
+      "Worker to use this method.");
+  }
+}
+
 }  // namespace python
 
 }  // namespace ucxx
@@ -0,0 +1,99 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <ucxx/adaptive_progress.h>
+
+namespace ucxx {
+
+static inline void cpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#else
+  std::this_thread::yield();
+#endif
+}
+
+AdaptiveProgress::AdaptiveProgress(const AdaptiveProgressConfig& config,
+                                   std::function<bool(void)> progressFunction,
+                                   std::function<bool(void)> blockingProgressFunction)
+  : _config(config),
+    _progressFunction(progressFunction),
+    _blockingProgressFunction(blockingProgressFunction),
+    _spinBudget(config.maxSpinDuration)
+{
+  _config.maxBackoffPauses = std::max<size_t>(_config.maxBackoffPauses, 1);
+}
+
+void AdaptiveProgress::recordActivity(Clock::time_point now)
+{
+  if (_lastActivity != Clock::time_point{}) {
+    double interval = std::chrono::duration<double, std::nano>(now - _lastActivity).count();
+    _interArrivalNs = (_interArrivalNs == 0.0) ? interval
+                                               : (1.0 - _config.smoothingFactor) * _interArrivalNs +
+                                                   _config.smoothingFactor * interval;
+
+    auto target = std::chrono::nanoseconds(
+      static_cast<int64_t>(_config.interArrivalMultiplier * _interArrivalNs));
+
+    // Activity arriving further apart than the maximum budget would not be caught by
+    // spinning, so spin only briefly before blocking.
+    _spinBudget = (target > _config.maxSpinDuration)
+                    ? _config.minSpinDuration
+                    : std::clamp(target, _config.minSpinDuration, _config.maxSpinDuration);
+  }
+
+  _lastActivity   = now;
+  _spinStart      = now;
+  _spinning       = true;
+  _spinIterations = 0;
+  _backoffPauses  = 1;
+}
+
+bool AdaptiveProgress::progress()
+{
+  if (_progressFunction()) {
+    recordActivity(Clock::now());
+    return true;
+  }
+
+  auto now = Clock::now();
+  if (!_spinning) {
+    _spinStart      = now;
+    _spinning       = true;
+    _spinIterations = 0;
+  }
+
+  ++_spinIterations;
+  bool withinIterations =
+    _config.maxSpinIterations == 0 || _spinIterations < _config.maxSpinIterations;
+
+  if (now - _spinStart < _spinBudget && withinIterations) {
+    for (size_t i = 0; i < _backoffPauses; ++i)
+      cpuRelax();
+    _backoffPauses = std::min(_backoffPauses * 2, _config.maxBackoffPauses);
+    return false;
+  }
+
+  // Spin budget exhausted, block until the next event. A new spin window starts after
+  // waking up.
+  _spinning      = false;
+  _backoffPauses = 1;
+  return _blockingProgressFunction();
+}
+
+std::chrono::nanoseconds AdaptiveProgress::getSpinBudget() const { return _spinBudget; }
+
+std::chrono::nanoseconds AdaptiveProgress::getInterArrivalTime() const
+{
+  return std::chrono::nanoseconds(static_cast<int64_t>(_interArrivalNs));
+}
+
+}  // namespace ucxx
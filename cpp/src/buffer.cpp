@@ -7,6 +7,7 @@
 #include <utility>
 
 #include <ucxx/buffer.h>
+#include <ucxx/utils/affinity.h>
 
 #if UCXX_ENABLE_RMM
 #include <rmm/device_buffer.hpp>
@@ -25,9 +26,11 @@ BufferType Buffer::getType() const noexcept { return _bufferType; }
 
 size_t Buffer::getSize() const noexcept { return _size; }
 
-HostBuffer::HostBuffer(const size_t size) : Buffer(BufferType::Host, size), _buffer{malloc(size)}
+HostBuffer::HostBuffer(const size_t size, const int numaNode)
+  : Buffer(BufferType::Host, size), _buffer{malloc(size)}
 {
-  ucxx_trace_data("HostBuffer(%lu), _buffer: %p", size, _buffer);
+  ucxx_trace_data("HostBuffer(%lu, %d), _buffer: %p", size, numaNode, _buffer);
+  if (_buffer != nullptr) utils::bindMemoryToNumaNode(_buffer, size, numaNode, false);
 }
 
 HostBuffer::~HostBuffer()
@@ -82,7 +85,7 @@ void* RMMBuffer::data()
 }
 #endif
 
-Buffer* allocateBuffer(const BufferType bufferType, const size_t size)
+Buffer* allocateBuffer(const BufferType bufferType, const size_t size, const int numaNode)
 {
 #if UCXX_ENABLE_RMM
   if (bufferType == BufferType::RMM)
@@ -92,7 +95,7 @@ Buffer* allocateBuffer(const BufferType bufferType, const size_t size)
   if (bufferType == BufferType::RMM)
     throw std::runtime_error("RMM support not enabled, please compile with -DUCXX_ENABLE_RMM=1");
 #endif
-    return new HostBuffer(size);
+    return new HostBuffer(size, numaNode);
 }
 
 }  // namespace ucxx
@@ -0,0 +1,42 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <utility>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/completion_queue.h>
+#include <ucxx/log.h>
+
+namespace ucxx {
+
+CompletionQueue::CompletionQueue(const size_t capacity) : _ring(capacity) {}
+
+void CompletionQueue::push(const Completion& completion)
+{
+  ucxx_trace_req(
+    "Pushed completion: context %p, status %d", completion.context.get(), completion.status);
+  _ring.push(completion);
+}
+
+size_t CompletionQueue::poll(Completion* completions, const size_t maxCompletions)
+{
+  size_t polled = 0;
+
+  while (polled < maxCompletions && _ring.pop(completions[polled]))
+    ++polled;
+
+  // The overflow is only popped once the ring is drained, preserving completion order
+  _ring.popOverflow(maxCompletions - polled, [&](Completion&& completion) {
+    completions[polled++] = std::move(completion);
+  });
+
+  return polled;
+}
+
+size_t CompletionQueue::getCapacity() const { return _ring.getCapacity(); }
+
+bool CompletionQueue::isEmpty() const { return _ring.isEmpty(); }
+
+}  // namespace ucxx
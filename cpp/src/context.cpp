@@ -9,8 +9,11 @@
 
 #include <ucxx/context.h>
 #include <ucxx/log.h>
+#include <ucxx/memory_handle.h>
+#include <ucxx/registration_cache.h>
 #include <ucxx/utils/file_descriptor.h>
 #include <ucxx/utils/ucx.h>
+#include <ucxx/worker_pool.h>
 
 namespace ucxx {
 
@@ -28,6 +31,11 @@ Context::Context(const ConfigMap ucxConfig, const uint64_t featureFlags)
   utils::ucsErrorThrow(ucp_init(&params, this->_config.getHandle(), &this->_handle));
   ucxx_trace("Context created: %p", this->_handle);
 
+  ucp_context_attr_t attr{};
+  attr.field_mask = UCP_ATTR_FIELD_REQUEST_SIZE;
+  utils::ucsErrorThrow(ucp_context_query(this->_handle, &attr));
+  this->_requestSize = attr.request_size;
+
   // UCX supports CUDA if TLS is "all", or one of {"cuda",
   // "cuda_copy", "cuda_ipc"} is in the active transports.
   // If the transport list is negated ("^" at start), then it is to be
@@ -87,11 +95,41 @@ std::string Context::getInfo()
 
 uint64_t Context::getFeatureFlags() const { return _featureFlags; }
 
-std::shared_ptr<Worker> Context::createWorker(const bool enableDelayedSubmission)
+size_t Context::getRequestSize() const { return _requestSize; }
+
+std::shared_ptr<Worker> Context::createWorker(const bool enableDelayedSubmission,
+                                              const bool enableFuture)
 {
   auto context = std::dynamic_pointer_cast<Context>(shared_from_this());
-  auto worker  = ucxx::createWorker(context, enableDelayedSubmission);
+  auto worker  = ucxx::createWorker(context, enableDelayedSubmission, enableFuture);
   return worker;
 }
 
+std::shared_ptr<MemoryHandle> Context::createMemoryHandle(const size_t size,
+                                                         void* buffer,
+                                                         const ucs_memory_type_t memoryType)
+{
+  auto context = std::dynamic_pointer_cast<Context>(shared_from_this());
+  return ucxx::createMemoryHandle(context, size, buffer, memoryType);
+}
+
+std::shared_ptr<RegistrationCache> Context::createRegistrationCache(const size_t maxBytes)
+{
+  auto context = std::dynamic_pointer_cast<Context>(shared_from_this());
+  return ucxx::createRegistrationCache(context, maxBytes);
+}
+
+std::shared_ptr<RegistrationCache> Context::createRegistrationCache()
+{
+  return createRegistrationCache(RegistrationCache::defaultMaxBytes);
+}
+
+std::shared_ptr<WorkerPool> Context::createWorkerPool(const size_t numWorkers,
+                                                      const bool enableDelayedSubmission,
+                                                      const WorkerPoolPlacement placement)
+{
+  auto context = std::dynamic_pointer_cast<Context>(shared_from_this());
+  return ucxx::createWorkerPool(context, numWorkers, enableDelayedSubmission, placement);
+}
+
 }  // namespace ucxx
@@ -2,9 +2,10 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <cstdint>
 #include <memory>
-#include <mutex>
 #include <utility>
+#include <vector>
 
 #include <ucp/api/ucp.h>
 
@@ -21,39 +22,80 @@ DelayedSubmission::DelayedSubmission(const bool send,
 {
 }
 
+DelayedSubmissionCollection::DelayedSubmissionCollection(const size_t capacity)
+  : _ring(capacity)
+{
+  _batch.reserve(_ring.getCapacity());
+}
+
+bool DelayedSubmissionCollection::drainRing(const size_t end)
+{
+  const size_t capacity = _ring.getCapacity();
+  DelayedSubmissionCallbackType callback;
+
+  while (_ring.getDequeuePosition() != end && _batch.size() < capacity && _ring.pop(callback))
+    _batch.push_back(std::move(callback));
+
+  return _ring.getDequeuePosition() == end;
+}
+
 void DelayedSubmissionCollection::process()
 {
-  if (_collection.size() > 0) {
-    ucxx_trace_req("Submitting %lu requests", _collection.size());
-
-    // Move _collection to a local copy in order to to hold the lock for as
-    // short as possible
-    decltype(_collection) toProcess;
-    {
-      std::lock_guard<std::mutex> lock(_mutex);
-      toProcess = std::move(_collection);
-    }
+  // Drain only callbacks enqueued before this point, callbacks enqueued meanwhile are left
+  // for the next call so that the worker is progressed in between.
+  const size_t end = _ring.getEnqueuePosition();
 
-    for (auto& callbackPtr : toProcess) {
-      auto& callback = *callbackPtr;
+  // Drain the ring in batches of up to the ring capacity, releasing slots to producers
+  // before the callbacks execute, thus allowing producers to make progress meanwhile.
+  while (true) {
+    bool drained = drainRing(end);
+    if (_batch.empty()) break;
 
+    ucxx_trace_req("Submitting %lu requests", _batch.size());
+
+    for (auto& callback : _batch) {
       ucxx_trace_req("Submitting request: %p", callback.target<void (*)(std::shared_ptr<void>)>());
 
       if (callback) callback();
     }
+    _batch.clear();
+
+    if (drained) break;
+  }
+
+  // Process the overflow only after the ring is empty, preserving each producer's
+  // submission order. Callbacks are moved out first so that they execute without the
+  // overflow lock held.
+  std::vector<DelayedSubmissionCallbackType> toProcess;
+  _ring.popOverflow(SIZE_MAX, [&toProcess](DelayedSubmissionCallbackType&& callback) {
+    toProcess.push_back(std::move(callback));
+  });
+  if (toProcess.empty()) return;
+
+  ucxx_trace_req("Submitting %lu overflow requests", toProcess.size());
+
+  for (auto& callback : toProcess) {
+    ucxx_trace_req("Submitting request: %p", callback.target<void (*)(std::shared_ptr<void>)>());
+
+    if (callback) callback();
   }
 }
 
 void DelayedSubmissionCollection::registerRequest(DelayedSubmissionCallbackType callback)
 {
-  auto r = std::make_shared<DelayedSubmissionCallbackType>(callback);
-
-  {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _collection.push_back(r);
-  }
   ucxx_trace_req("Registered submit request: %p",
                  callback.target<void (*)(std::shared_ptr<void>)>());
+
+  _ring.push(std::move(callback));
+}
+
+size_t DelayedSubmissionCollection::getCapacity() const { return _ring.getCapacity(); }
+
+bool DelayedSubmissionCollection::isEmpty() const { return _ring.isEmpty(); }
+
+void DelayedSubmissionCollection::bindToNumaNode(const int numaNode)
+{
+  _ring.bindToNumaNode(numaNode);
 }
 
 }  // namespace ucxx
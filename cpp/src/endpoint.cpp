@@ -5,6 +5,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -13,9 +14,16 @@
 #include <ucxx/component.h>
 #include <ucxx/endpoint.h>
 #include <ucxx/exception.h>
+#include <ucxx/hostname_resolver.h>
 #include <ucxx/listener.h>
+#include <ucxx/request_am.h>
+#include <ucxx/request_atomic.h>
+#include <ucxx/request_endpoint_close.h>
+#include <ucxx/request_flush.h>
+#include <ucxx/request_mem.h>
 #include <ucxx/request_stream.h>
 #include <ucxx/request_tag.h>
+#include <ucxx/request_tag_any_size.h>
 #include <ucxx/typedefs.h>
 #include <ucxx/utils/sockaddr.h>
 #include <ucxx/utils/ucx.h>
@@ -49,8 +57,10 @@ Endpoint::Endpoint(std::shared_ptr<Component> workerOrListener,
   params->err_handler.cb  = Endpoint::errorCallback;
   params->err_handler.arg = _callbackData.get();
 
-  utils::ucsErrorThrow(ucp_ep_create(worker->getHandle(), params.get(), &_handle));
-  ucxx_trace("Endpoint created: %p", _handle);
+  ucp_ep_h handle = nullptr;
+  utils::ucsErrorThrow(ucp_ep_create(worker->getHandle(), params.get(), &handle));
+  _handle.store(handle);
+  ucxx_trace("Endpoint created: %p", handle);
 }
 
 std::shared_ptr<Endpoint> createEndpointFromHostname(std::shared_ptr<Worker> worker,
@@ -61,15 +71,32 @@ std::shared_ptr<Endpoint> createEndpointFromHostname(std::shared_ptr<Worker> wor
   if (worker == nullptr || worker->getHandle() == nullptr)
     throw ucxx::Error("Worker not initialized");
 
-  auto params = std::unique_ptr<ucp_ep_params_t, EpParamsDeleter>(new ucp_ep_params_t);
+  sockaddr_storage address;
+  socklen_t length;
+  if (worker->getHostnameResolver()->resolveBlocking(ipAddress, address, length) != UCS_OK)
+    throw ucxx::Error(std::string("Invalid IP address or hostname"));
 
-  struct hostent* hostname = gethostbyname(ipAddress.c_str());
-  if (hostname == nullptr) throw ucxx::Error(std::string("Invalid IP address or hostname"));
+  return createEndpointFromSocketAddress(worker, address, length, port, endpointErrorHandling);
+}
+
+std::shared_ptr<Endpoint> createEndpointFromSocketAddress(std::shared_ptr<Worker> worker,
+                                                          const sockaddr_storage& address,
+                                                          socklen_t length,
+                                                          uint16_t port,
+                                                          bool endpointErrorHandling)
+{
+  if (worker == nullptr || worker->getHandle() == nullptr)
+    throw ucxx::Error("Worker not initialized");
 
+  auto params        = std::unique_ptr<ucp_ep_params_t, EpParamsDeleter>(new ucp_ep_params_t);
   params->field_mask = UCP_EP_PARAM_FIELD_FLAGS | UCP_EP_PARAM_FIELD_SOCK_ADDR |
                        UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE | UCP_EP_PARAM_FIELD_ERR_HANDLER;
   params->flags = UCP_EP_PARAMS_FLAGS_CLIENT_SERVER;
-  if (ucxx::utils::sockaddr_set(&params->sockaddr, hostname->h_name, port)) throw std::bad_alloc();
+  if (ucxx::utils::sockaddr_set(&params->sockaddr, &address, length, port)) {
+    // The deleter must not release a socket address that was not set.
+    params->field_mask &= ~UCP_EP_PARAM_FIELD_SOCK_ADDR;
+    throw ucxx::Error(std::string("Unsupported address family"));
+  }
 
   return std::shared_ptr<Endpoint>(new Endpoint(worker, std::move(params), endpointErrorHandling));
 }
@@ -91,6 +118,22 @@ std::shared_ptr<Endpoint> createEndpointFromConnRequest(std::shared_ptr<Listener
     new Endpoint(listener, std::move(params), endpointErrorHandling));
 }
 
+std::shared_ptr<Endpoint> createEndpointFromConnRequest(std::shared_ptr<Worker> worker,
+                                                        ucp_conn_request_h connRequest,
+                                                        bool endpointErrorHandling)
+{
+  if (worker == nullptr || worker->getHandle() == nullptr)
+    throw ucxx::Error("Worker not initialized");
+
+  auto params        = std::unique_ptr<ucp_ep_params_t, EpParamsDeleter>(new ucp_ep_params_t);
+  params->field_mask = UCP_EP_PARAM_FIELD_FLAGS | UCP_EP_PARAM_FIELD_CONN_REQUEST |
+                       UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE | UCP_EP_PARAM_FIELD_ERR_HANDLER;
+  params->flags        = UCP_EP_PARAMS_FLAGS_NO_LOOPBACK;
+  params->conn_request = connRequest;
+
+  return std::shared_ptr<Endpoint>(new Endpoint(worker, std::move(params), endpointErrorHandling));
+}
+
 std::shared_ptr<Endpoint> createEndpointFromWorkerAddress(std::shared_ptr<Worker> worker,
                                                           std::shared_ptr<Address> address,
                                                           bool endpointErrorHandling)
@@ -110,46 +153,81 @@ std::shared_ptr<Endpoint> createEndpointFromWorkerAddress(std::shared_ptr<Worker
 
 Endpoint::~Endpoint()
 {
-  close();
+  close(EndpointCloseMode::Force);
   ucxx_trace("Endpoint destroyed: %p", _originalHandle);
 }
 
-void Endpoint::close()
+void Endpoint::close(const EndpointCloseMode mode)
 {
-  if (_handle == nullptr) return;
+  if (getHandle() == nullptr) return;
+
+  // Close the endpoint, we force close if endpoint error handling is enabled and the
+  // endpoint status is not UCS_OK since it can't flush anymore
+  unsigned closeMode = mode == EndpointCloseMode::Force ? UCP_EP_CLOSE_MODE_FORCE
+                                                        : UCP_EP_CLOSE_MODE_FLUSH;
+  if (_endpointErrorHandling && _callbackData->status != UCS_OK)
+    closeMode = UCP_EP_CLOSE_MODE_FORCE;
 
   size_t canceled = cancelInflightRequests();
-  ucxx_debug("Endpoint %p canceled %lu requests", _handle, canceled);
+  ucxx_debug("Endpoint %p canceled %lu requests", getHandle(), canceled);
 
-  // Close the endpoint
-  unsigned closeMode = UCP_EP_CLOSE_MODE_FORCE;
-  if (_endpointErrorHandling && _callbackData->status != UCS_OK) {
-    // We force close endpoint if endpoint error handling is enabled and
-    // the endpoint status is not UCS_OK
-    closeMode = UCP_EP_CLOSE_MODE_FORCE;
-  }
-  ucs_status_ptr_t status = ucp_ep_close_nb(_handle, closeMode);
+  // The endpoint may have been closed by a concurrent close meanwhile
+  ucp_ep_h handle = setClosed();
+  if (handle == nullptr) return;
+
+  ucs_status_ptr_t status = ucp_ep_close_nb(handle, closeMode);
   if (UCS_PTR_IS_PTR(status)) {
-    auto worker = Endpoint::getWorker(_parent);
-    while (ucp_request_check_status(status) == UCS_INPROGRESS)
-      worker->progress();
+    // The worker must not be progressed concurrently with its progress thread, which
+    // completes the close instead unless this is the progress thread itself.
+    auto worker         = Endpoint::getWorker(_parent);
+    const bool progress = !worker->isProgressThreadRunning() || worker->isOnProgressThread();
+    while (ucp_request_check_status(status) == UCS_INPROGRESS) {
+      if (progress)
+        worker->progress();
+      else
+        std::this_thread::yield();
+    }
     ucp_request_free(status);
   } else if (UCS_PTR_STATUS(status) != UCS_OK) {
     ucxx_error("Error while closing endpoint: %s", ucs_status_string(UCS_PTR_STATUS(status)));
   }
-  ucxx_trace("Endpoint closed: %p", _handle);
+}
+
+std::shared_ptr<Request> Endpoint::closeAsync(
+  const EndpointCloseMode mode,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  auto request =
+    createRequestEndpointClose(endpoint, mode, enablePythonFuture, callbackFunction, callbackData);
+
+  // Close requests are not tracked by the endpoint being closed, the worker keeps them
+  // alive until UCX completes them even if the caller releases them.
+  if (!request->isCompleted()) getWorker(_parent)->registerInflightRequest(request);
+  return request;
+}
+
+ucp_ep_h Endpoint::setClosed()
+{
+  ucp_ep_h handle = _handle.exchange(nullptr);
+  if (handle == nullptr) return nullptr;
+
+  ucxx_trace("Endpoint closed: %p", handle);
+  _originalHandle = handle;
 
   if (_callbackData->closeCallback) {
-    ucxx_debug("Calling user callback for endpoint %p", _handle);
+    ucxx_debug("Calling user callback for endpoint %p", handle);
     _callbackData->closeCallback(_callbackData->closeCallbackArg);
     _callbackData->closeCallback    = nullptr;
     _callbackData->closeCallbackArg = nullptr;
   }
 
-  std::swap(_handle, _originalHandle);
+  return handle;
 }
 
-ucp_ep_h Endpoint::getHandle() { return _handle; }
+ucp_ep_h Endpoint::getHandle() { return _handle.load(); }
 
 bool Endpoint::isAlive() const
 {
@@ -166,7 +244,7 @@ void Endpoint::raiseOnError()
 
   std::string statusString{ucs_status_string(status)};
   std::stringstream errorMsgStream;
-  errorMsgStream << "Endpoint " << std::hex << _handle << " error: " << statusString;
+  errorMsgStream << "Endpoint " << std::hex << getHandle() << " error: " << statusString;
 
   utils::ucsErrorThrow(status, errorMsgStream.str());
 }
@@ -179,7 +257,13 @@ void Endpoint::setCloseCallback(std::function<void(void*)> closeCallback, void*
 
 std::shared_ptr<Request> Endpoint::registerInflightRequest(std::shared_ptr<Request> request)
 {
-  if (!request->isCompleted()) _inflightRequests->insert(request);
+  if (!request->isCompleted()) {
+    _inflightRequests->insert(request);
+
+    // The request may have completed before it was inserted, in which case its removal
+    // was a no-op and must be repeated to release the reference.
+    if (request->isCompleted()) _inflightRequests->remove(request.get());
+  }
 
   /**
    * If the endpoint errored while the request was being submitted, the error
@@ -192,6 +276,15 @@ std::shared_ptr<Request> Endpoint::registerInflightRequest(std::shared_ptr<Reque
   return request;
 }
 
+void Endpoint::registerInflightRequests(const std::vector<std::shared_ptr<Request>>& requests)
+{
+  _inflightRequests->insert(requests);
+
+  // See `registerInflightRequest()`.
+  if (_callbackData->status != UCS_OK)
+    _callbackData->worker->scheduleRequestCancel(_inflightRequests);
+}
+
 void Endpoint::removeInflightRequest(const Request* const request)
 {
   _inflightRequests->remove(request);
@@ -199,6 +292,164 @@ void Endpoint::removeInflightRequest(const Request* const request)
 
 size_t Endpoint::cancelInflightRequests() { return _inflightRequests->cancelAll(); }
 
+size_t Endpoint::getInflightRequestCount() { return _inflightRequests->size(); }
+
+std::shared_ptr<Request> Endpoint::amSend(
+  unsigned id,
+  const std::string& header,
+  void* buffer,
+  size_t length,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(createRequestAmSend(
+    endpoint, id, header, buffer, length, enablePythonFuture, callbackFunction, callbackData));
+}
+
+std::shared_ptr<Request> Endpoint::put(void* buffer,
+                                       size_t length,
+                                       uint64_t remoteAddress,
+                                       std::shared_ptr<RemoteKey> remoteKey,
+                                       const bool enablePythonFuture,
+                                       std::function<void(std::shared_ptr<void>)> callbackFunction,
+                                       std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(createRequestMem(endpoint,
+                                                  true,
+                                                  buffer,
+                                                  length,
+                                                  remoteAddress,
+                                                  remoteKey,
+                                                  enablePythonFuture,
+                                                  callbackFunction,
+                                                  callbackData));
+}
+
+std::shared_ptr<Request> Endpoint::get(void* buffer,
+                                       size_t length,
+                                       uint64_t remoteAddress,
+                                       std::shared_ptr<RemoteKey> remoteKey,
+                                       const bool enablePythonFuture,
+                                       std::function<void(std::shared_ptr<void>)> callbackFunction,
+                                       std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(createRequestMem(endpoint,
+                                                  false,
+                                                  buffer,
+                                                  length,
+                                                  remoteAddress,
+                                                  remoteKey,
+                                                  enablePythonFuture,
+                                                  callbackFunction,
+                                                  callbackData));
+}
+
+std::shared_ptr<Request> Endpoint::atomicAdd(
+  const uint64_t value,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(createRequestAtomic(endpoint,
+                                                     UCP_ATOMIC_OP_ADD,
+                                                     false,
+                                                     value,
+                                                     0,
+                                                     nullptr,
+                                                     remoteAddress,
+                                                     remoteKey,
+                                                     enablePythonFuture,
+                                                     callbackFunction,
+                                                     callbackData));
+}
+
+std::shared_ptr<Request> Endpoint::fetchAdd(
+  const uint64_t value,
+  uint64_t* result,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(createRequestAtomic(endpoint,
+                                                     UCP_ATOMIC_OP_ADD,
+                                                     true,
+                                                     value,
+                                                     0,
+                                                     result,
+                                                     remoteAddress,
+                                                     remoteKey,
+                                                     enablePythonFuture,
+                                                     callbackFunction,
+                                                     callbackData));
+}
+
+std::shared_ptr<Request> Endpoint::compareSwap(
+  const uint64_t compare,
+  const uint64_t value,
+  uint64_t* result,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(createRequestAtomic(endpoint,
+                                                     UCP_ATOMIC_OP_CSWAP,
+                                                     true,
+                                                     value,
+                                                     compare,
+                                                     result,
+                                                     remoteAddress,
+                                                     remoteKey,
+                                                     enablePythonFuture,
+                                                     callbackFunction,
+                                                     callbackData));
+}
+
+std::shared_ptr<Request> Endpoint::swap(
+  const uint64_t value,
+  uint64_t* result,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(createRequestAtomic(endpoint,
+                                                     UCP_ATOMIC_OP_SWAP,
+                                                     true,
+                                                     value,
+                                                     0,
+                                                     result,
+                                                     remoteAddress,
+                                                     remoteKey,
+                                                     enablePythonFuture,
+                                                     callbackFunction,
+                                                     callbackData));
+}
+
+std::shared_ptr<Request> Endpoint::flush(
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(
+    createRequestFlush(endpoint, enablePythonFuture, callbackFunction, callbackData));
+}
+
 std::shared_ptr<Request> Endpoint::streamSend(void* buffer,
                                               size_t length,
                                               const bool enablePythonFuture)
@@ -226,8 +477,16 @@ std::shared_ptr<Request> Endpoint::tagSend(
   std::shared_ptr<void> callbackData)
 {
   auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
-  return registerInflightRequest(createRequestTag(
-    endpoint, true, buffer, length, tag, enablePythonFuture, callbackFunction, callbackData));
+  return registerInflightRequest(createRequestTag(endpoint,
+                                                  true,
+                                                  buffer,
+                                                  length,
+                                                  tag,
+                                                  TagMaskFull,
+                                                  enablePythonFuture,
+                                                  callbackFunction,
+                                                  callbackData,
+                                                  false));
 }
 
 std::shared_ptr<Request> Endpoint::tagRecv(
@@ -239,8 +498,106 @@ std::shared_ptr<Request> Endpoint::tagRecv(
   std::shared_ptr<void> callbackData)
 {
   auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
-  return registerInflightRequest(createRequestTag(
-    endpoint, false, buffer, length, tag, enablePythonFuture, callbackFunction, callbackData));
+  return registerInflightRequest(createRequestTag(endpoint,
+                                                  false,
+                                                  buffer,
+                                                  length,
+                                                  tag,
+                                                  TagMaskFull,
+                                                  enablePythonFuture,
+                                                  callbackFunction,
+                                                  callbackData,
+                                                  false));
+}
+
+std::shared_ptr<RequestTag> Endpoint::tagRecv(
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const TagMask tagMask,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  auto request  = createRequestTag(endpoint,
+                                  false,
+                                  buffer,
+                                  length,
+                                  tag,
+                                  tagMask,
+                                  enablePythonFuture,
+                                  callbackFunction,
+                                  callbackData,
+                                  false);
+  registerInflightRequest(request);
+  return request;
+}
+
+std::shared_ptr<RequestTag> Endpoint::tagRecvUpTo(
+  void* buffer,
+  size_t maxLength,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  auto request  = createRequestTag(endpoint,
+                                  false,
+                                  buffer,
+                                  maxLength,
+                                  tag,
+                                  TagMaskFull,
+                                  enablePythonFuture,
+                                  callbackFunction,
+                                  callbackData,
+                                  true);
+  registerInflightRequest(request);
+  return request;
+}
+
+std::shared_ptr<RequestTagAnySize> Endpoint::tagRecvAnySize(
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData,
+  BufferAllocatorType allocator)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  auto request  = createRequestTagAnySize(
+    endpoint, tag, enablePythonFuture, callbackFunction, callbackData, allocator);
+  registerInflightRequest(request);
+  return request;
+}
+
+std::vector<std::shared_ptr<Request>> Endpoint::tagSendBatch(const std::vector<void*>& buffers,
+                                                             const std::vector<size_t>& lengths,
+                                                             const std::vector<ucp_tag_t>& tags,
+                                                             const bool enablePythonFuture)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  auto requests = createRequestTagBatch(endpoint, true, buffers, lengths, tags, enablePythonFuture);
+
+  // Requests are registered before submission, if they complete immediately their
+  // removal from the inflight requests container is handled by the callback.
+  registerInflightRequests(requests);
+  getWorker(_parent)->registerDelayedSubmissionBatch(requests);
+  return requests;
+}
+
+std::vector<std::shared_ptr<Request>> Endpoint::tagRecvBatch(const std::vector<void*>& buffers,
+                                                             const std::vector<size_t>& lengths,
+                                                             const std::vector<ucp_tag_t>& tags,
+                                                             const bool enablePythonFuture)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  auto requests =
+    createRequestTagBatch(endpoint, false, buffers, lengths, tags, enablePythonFuture);
+
+  registerInflightRequests(requests);
+  getWorker(_parent)->registerDelayedSubmissionBatch(requests);
+  return requests;
 }
 
 std::shared_ptr<RequestTagMulti> Endpoint::tagMultiSend(const std::vector<void*>& buffer,
@@ -253,11 +610,15 @@ std::shared_ptr<RequestTagMulti> Endpoint::tagMultiSend(const std::vector<void*>
   return createRequestTagMultiSend(endpoint, buffer, size, isCUDA, tag, enablePythonFuture);
 }
 
-std::shared_ptr<RequestTagMulti> Endpoint::tagMultiRecv(const ucp_tag_t tag,
-                                                        const bool enablePythonFuture)
+std::shared_ptr<RequestTagMulti> Endpoint::tagMultiRecv(
+  const ucp_tag_t tag,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
 {
   auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
-  return createRequestTagMultiRecv(endpoint, tag, enablePythonFuture);
+  return createRequestTagMultiRecv(
+    endpoint, tag, enablePythonFuture, callbackFunction, callbackData);
 }
 
 std::shared_ptr<Worker> Endpoint::getWorker(std::shared_ptr<Component> workerOrListener)
@@ -0,0 +1,261 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/endpoint_pool.h>
+#include <ucxx/log.h>
+
+namespace ucxx {
+
+EndpointPool::EndpointPool(std::shared_ptr<Worker> worker,
+                           const size_t maxSize,
+                           const std::chrono::milliseconds idleTimeout)
+  : _maxSize(maxSize), _idleTimeout(idleTimeout), _lastSweep(std::chrono::steady_clock::now())
+{
+  if (worker == nullptr || worker->getHandle() == nullptr)
+    throw ucxx::Error("Worker not initialized");
+
+  setParent(worker);
+}
+
+std::shared_ptr<EndpointPool> createEndpointPool(std::shared_ptr<Worker> worker,
+                                                 const size_t maxSize,
+                                                 const std::chrono::milliseconds idleTimeout)
+{
+  return std::shared_ptr<EndpointPool>(new EndpointPool(worker, maxSize, idleTimeout));
+}
+
+void EndpointPool::removeIdle(const std::chrono::steady_clock::time_point now,
+                              std::vector<std::shared_ptr<Endpoint>>& evicted)
+{
+  _lastSweep = now;
+
+  // Entries of each peer are ordered by release time, timed out entries are a prefix.
+  for (auto it = _idle.begin(); it != _idle.end();) {
+    auto& entries = it->second;
+    auto end      = entries.begin();
+    while (end != entries.end() && now - end->releasedAt >= _idleTimeout) {
+      _owners.erase(end->endpoint.get());
+      evicted.push_back(std::move(end->endpoint));
+      ++end;
+    }
+    _size -= end - entries.begin();
+    _evictions += end - entries.begin();
+    entries.erase(entries.begin(), end);
+
+    it = entries.empty() ? _idle.erase(it) : std::next(it);
+  }
+
+  // Endpoints handed out and never released must not be tracked forever.
+  for (auto it = _owners.begin(); it != _owners.end();)
+    it = it->second.endpoint.expired() ? _owners.erase(it) : std::next(it);
+}
+
+void EndpointPool::closeEvicted(const std::vector<std::shared_ptr<Endpoint>>& evicted)
+{
+  if (evicted.empty()) return;
+
+  ucxx_debug("EndpointPool %p closing %lu endpoints", this, evicted.size());
+
+  // Requests of endpoints discarded on release would otherwise never complete, as the
+  // user that posted them gave the endpoint up.
+  for (const auto& endpoint : evicted)
+    endpoint->cancelInflightRequests();
+
+  auto worker = std::dynamic_pointer_cast<Worker>(getParent());
+  worker->closeEndpoints(evicted, EndpointCloseMode::Flush);
+}
+
+std::shared_ptr<Endpoint> EndpointPool::get(
+  const std::string& key,
+  const std::function<std::shared_ptr<Endpoint>()>& create,
+  bool* reused,
+  std::shared_ptr<void>* userData)
+{
+  std::vector<std::shared_ptr<Endpoint>> evicted;
+  std::shared_ptr<Endpoint> endpoint{nullptr};
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - _lastSweep >= _idleTimeout) removeIdle(now, evicted);
+
+    auto it = _idle.find(key);
+    if (it != _idle.end()) {
+      // Prefer the most recently released endpoint, the least likely to have timed out.
+      auto& entries = it->second;
+      while (!entries.empty() && endpoint == nullptr) {
+        auto entry = std::move(entries.back());
+        entries.pop_back();
+        --_size;
+
+        if (now - entry.releasedAt >= _idleTimeout) {
+          ++_evictions;
+        } else if (entry.endpoint->getHandle() != nullptr && entry.endpoint->isAlive()) {
+          endpoint = std::move(entry.endpoint);
+          if (userData != nullptr) *userData = std::move(entry.userData);
+          break;
+        }
+
+        _owners.erase(entry.endpoint.get());
+        evicted.push_back(std::move(entry.endpoint));
+      }
+      if (entries.empty()) _idle.erase(it);
+    }
+  }
+
+  closeEvicted(evicted);
+
+  if (endpoint != nullptr) {
+    ++_hits;
+    if (reused != nullptr) *reused = true;
+    return endpoint;
+  }
+
+  ++_misses;
+  endpoint = create();
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _owners[endpoint.get()] = Owner{endpoint, key};
+  }
+
+  if (reused != nullptr) *reused = false;
+  if (userData != nullptr) *userData = nullptr;
+  return endpoint;
+}
+
+std::shared_ptr<Endpoint> EndpointPool::getFromHostname(std::string ipAddress,
+                                                        uint16_t port,
+                                                        bool endpointErrorHandling,
+                                                        bool* reused,
+                                                        std::shared_ptr<void>* userData)
+{
+  auto key = std::string("host:") + (endpointErrorHandling ? "1:" : "0:") + ipAddress + ":" +
+             std::to_string(port);
+  auto worker = std::dynamic_pointer_cast<Worker>(getParent());
+
+  return get(
+    key,
+    [&]() { return worker->createEndpointFromHostname(ipAddress, port, endpointErrorHandling); },
+    reused,
+    userData);
+}
+
+std::shared_ptr<Endpoint> EndpointPool::getFromWorkerAddress(std::shared_ptr<Address> address,
+                                                             bool endpointErrorHandling,
+                                                             bool* reused,
+                                                             std::shared_ptr<void>* userData)
+{
+  auto key =
+    std::string("address:") + (endpointErrorHandling ? "1:" : "0:") + address->getString();
+  auto worker = std::dynamic_pointer_cast<Worker>(getParent());
+
+  return get(
+    key,
+    [&]() { return worker->createEndpointFromWorkerAddress(address, endpointErrorHandling); },
+    reused,
+    userData);
+}
+
+void EndpointPool::release(std::shared_ptr<Endpoint> endpoint, std::shared_ptr<void> userData)
+{
+  std::vector<std::shared_ptr<Endpoint>> evicted;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _owners.find(endpoint.get());
+    if (it == _owners.end() || it->second.endpoint.lock() != endpoint)
+      throw std::invalid_argument("Endpoint was not obtained from this pool");
+
+    // Requests still in flight would complete on behalf of the next user of the endpoint,
+    // or match messages meant for it, such endpoints are closed instead of kept.
+    auto now = std::chrono::steady_clock::now();
+    if (endpoint->getHandle() == nullptr || !endpoint->isAlive() ||
+        endpoint->getInflightRequestCount() > 0) {
+      _owners.erase(it);
+      evicted.push_back(std::move(endpoint));
+    } else {
+      _idle[it->second.key].push_back(IdleEntry{std::move(endpoint), now, std::move(userData)});
+      ++_size;
+    }
+
+    if (now - _lastSweep >= _idleTimeout) removeIdle(now, evicted);
+
+    // Evict the least recently released endpoints, the oldest entry of some peer.
+    while (_size > _maxSize) {
+      auto oldest = _idle.begin();
+      for (auto peer = _idle.begin(); peer != _idle.end(); ++peer)
+        if (peer->second.front().releasedAt < oldest->second.front().releasedAt) oldest = peer;
+
+      auto& entries = oldest->second;
+      _owners.erase(entries.front().endpoint.get());
+      evicted.push_back(std::move(entries.front().endpoint));
+      entries.erase(entries.begin());
+      if (entries.empty()) _idle.erase(oldest);
+      --_size;
+      ++_evictions;
+    }
+  }
+
+  closeEvicted(evicted);
+}
+
+size_t EndpointPool::evictIdle()
+{
+  std::vector<std::shared_ptr<Endpoint>> evicted;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    removeIdle(std::chrono::steady_clock::now(), evicted);
+  }
+
+  closeEvicted(evicted);
+  return evicted.size();
+}
+
+void EndpointPool::clear()
+{
+  std::vector<std::shared_ptr<Endpoint>> evicted;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& peer : _idle) {
+      for (auto& entry : peer.second) {
+        _owners.erase(entry.endpoint.get());
+        evicted.push_back(std::move(entry.endpoint));
+      }
+    }
+    _evictions += _size;
+    _idle.clear();
+    _size = 0;
+  }
+
+  closeEvicted(evicted);
+}
+
+uint64_t EndpointPool::getHits() const { return _hits; }
+
+uint64_t EndpointPool::getMisses() const { return _misses; }
+
+uint64_t EndpointPool::getEvictions() const { return _evictions; }
+
+size_t EndpointPool::getSize() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _size;
+}
+
+size_t EndpointPool::getMaxSize() const { return _maxSize; }
+
+}  // namespace ucxx
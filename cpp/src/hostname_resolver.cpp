@@ -0,0 +1,217 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <netdb.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/hostname_resolver.h>
+#include <ucxx/log.h>
+
+namespace ucxx {
+
+HostnameResolver::HostnameResolver(const size_t numThreads,
+                                   const std::chrono::milliseconds timeToLive)
+{
+  _state->timeToLive = timeToLive;
+
+  const size_t threadCount = numThreads > 0 ? numThreads : 1;
+  _threads.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; ++i)
+    _threads.emplace_back(run, _state);
+}
+
+HostnameResolver::~HostnameResolver()
+{
+  {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    _state->stop = true;
+  }
+  _state->cv.notify_all();
+
+  for (auto& thread : _threads) {
+    // The last reference may be released by a callback running on a resolver thread,
+    // which can't join itself, it exits on its own once the callback returns.
+    if (thread.get_id() == std::this_thread::get_id())
+      thread.detach();
+    else
+      thread.join();
+  }
+
+  // Lookups in progress completed before their threads exited, the remaining ones were
+  // still queued and are canceled so that no caller waits on them forever.
+  decltype(_state->pending) pending;
+  {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    pending = std::move(_state->pending);
+    _state->pending.clear();
+  }
+
+  const sockaddr_storage address{};
+  for (auto& hostnameCallbacks : pending)
+    for (auto& callback : hostnameCallbacks.second)
+      callback(UCS_ERR_CANCELED, address, 0);
+}
+
+std::shared_ptr<HostnameResolver> HostnameResolver::getDefault()
+{
+  static auto resolver = std::make_shared<HostnameResolver>();
+  return resolver;
+}
+
+ucs_status_t HostnameResolver::getAddressInfo(const std::string& hostname, Entry& entry)
+{
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family   = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+
+  struct addrinfo* result = nullptr;
+  int ret                 = getaddrinfo(hostname.c_str(), nullptr, &hints, &result);
+  if (ret != 0 || result == nullptr) {
+    ucxx_debug("Failed to resolve %s: %s", hostname.c_str(), gai_strerror(ret));
+    return UCS_ERR_INVALID_ADDR;
+  }
+
+  // Prefer IPv4, as listeners commonly bind IPv4 addresses only, while names such as
+  // "localhost" often resolve to an IPv6 address first. Literal IPv6 addresses and
+  // IPv6-only hosts have no IPv4 result and resolve to their first address.
+  struct addrinfo* selected = result;
+  for (auto info = result; info != nullptr; info = info->ai_next) {
+    if (info->ai_family == AF_INET) {
+      selected = info;
+      break;
+    }
+  }
+
+  memcpy(&entry.address, selected->ai_addr, selected->ai_addrlen);
+  entry.length = selected->ai_addrlen;
+  freeaddrinfo(result);
+
+  return UCS_OK;
+}
+
+const HostnameResolver::Entry* HostnameResolver::findCached(State& state,
+                                                             const std::string& hostname)
+{
+  auto it = state.cache.find(hostname);
+  if (it == state.cache.end()) return nullptr;
+
+  if (it->second.expiration <= std::chrono::steady_clock::now()) {
+    state.cache.erase(it);
+    return nullptr;
+  }
+
+  return &it->second;
+}
+
+void HostnameResolver::run(std::shared_ptr<State> state)
+{
+  std::unique_lock<std::mutex> lock(state->mutex);
+
+  while (true) {
+    state->cv.wait(lock, [&state]() { return state->stop || !state->queue.empty(); });
+    if (state->stop) return;
+
+    std::string hostname = std::move(state->queue.front());
+    state->queue.pop();
+
+    lock.unlock();
+    Entry entry;
+    auto status = getAddressInfo(hostname, entry);
+    lock.lock();
+
+    if (status == UCS_OK) {
+      entry.expiration = std::chrono::steady_clock::now() + state->timeToLive;
+      state->cache[hostname] = entry;
+    }
+
+    auto callbacks = std::move(state->pending[hostname]);
+    state->pending.erase(hostname);
+
+    lock.unlock();
+    for (auto& callback : callbacks)
+      callback(status, entry.address, entry.length);
+    callbacks.clear();
+    lock.lock();
+  }
+}
+
+void HostnameResolver::resolve(const std::string& hostname, CallbackType callback)
+{
+  std::unique_lock<std::mutex> lock(_state->mutex);
+
+  if (auto entry = findCached(*_state, hostname)) {
+    auto cached = *entry;
+    lock.unlock();
+
+    ++_state->hits;
+    callback(UCS_OK, cached.address, cached.length);
+    return;
+  }
+
+  ++_state->misses;
+
+  // Only the first lookup of a hostname is queued, others wait on its resolution.
+  auto& callbacks = _state->pending[hostname];
+  callbacks.push_back(std::move(callback));
+  if (callbacks.size() > 1) return;
+
+  _state->queue.push(hostname);
+  lock.unlock();
+  _state->cv.notify_one();
+}
+
+ucs_status_t HostnameResolver::resolveBlocking(const std::string& hostname,
+                                               sockaddr_storage& address,
+                                               socklen_t& length)
+{
+  {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    if (auto entry = findCached(*_state, hostname)) {
+      ++_state->hits;
+      address = entry->address;
+      length  = entry->length;
+      return UCS_OK;
+    }
+  }
+
+  ++_state->misses;
+
+  Entry entry;
+  auto status = getAddressInfo(hostname, entry);
+  if (status != UCS_OK) return status;
+
+  {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    entry.expiration        = std::chrono::steady_clock::now() + _state->timeToLive;
+    _state->cache[hostname] = entry;
+  }
+
+  address = entry.address;
+  length  = entry.length;
+  return UCS_OK;
+}
+
+void HostnameResolver::clearCache()
+{
+  std::lock_guard<std::mutex> lock(_state->mutex);
+  _state->cache.clear();
+}
+
+uint64_t HostnameResolver::getCacheHits() const { return _state->hits; }
+
+uint64_t HostnameResolver::getCacheMisses() const { return _state->misses; }
+
+}  // namespace ucxx
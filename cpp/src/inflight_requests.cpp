@@ -3,6 +3,9 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include <ucxx/inflight_requests.h>
 #include <ucxx/log.h>
@@ -10,77 +13,143 @@
 
 namespace ucxx {
 
+InflightRequests::InflightRequests() { _head._prev = _head._next = &_head; }
+
 InflightRequests::~InflightRequests() { cancelAll(); }
 
-size_t InflightRequests::size() { return _inflightRequests->size(); }
+size_t InflightRequests::size() { return _size.load(); }
 
-void InflightRequests::insert(std::shared_ptr<Request> request)
+std::shared_ptr<Request> InflightRequests::unlink(InflightRequestsHook* hook)
 {
-  std::lock_guard<std::mutex> lock(_mutex);
+  hook->_prev->_next = hook->_next;
+  hook->_next->_prev = hook->_prev;
+  hook->_prev = hook->_next = nullptr;
+  hook->_owner.store(nullptr);
+
+  // Hooks from a previous epoch belong to a list detached by `cancelAll()`, which are not
+  // accounted for in `_size` anymore.
+  if (hook->_epoch == _epoch) --_size;
 
-  _inflightRequests->insert({request.get(), request});
+  return std::move(hook->_request);
+}
+
+void InflightRequests::link(std::shared_ptr<Request> request)
+{
+  auto& hook = request->_inflightRequestsHook;
+
+  if (hook._owner.load() == this) return;
+
+  hook._request      = std::move(request);
+  hook._epoch        = _epoch;
+  hook._prev         = _head._prev;
+  hook._next         = &_head;
+  _head._prev->_next = &hook;
+  _head._prev        = &hook;
+  hook._owner.store(this);
+  ++_size;
 }
 
-void InflightRequests::merge(InflightRequestsMapPtr inflightRequestsMap)
+void InflightRequests::insert(std::shared_ptr<Request> request)
 {
   std::lock_guard<std::mutex> lock(_mutex);
 
-  _inflightRequests->merge(*inflightRequestsMap);
+  link(std::move(request));
 }
 
-void InflightRequests::remove(const Request* const request)
+void InflightRequests::insert(const std::vector<std::shared_ptr<Request>>& requests)
 {
-  do {
-    int result = std::try_lock(_cancelMutex, _mutex);
-
-    /**
-     * `result` can be have one of three values:
-     * -1 (both arguments were locked): Remove request and return.
-     *  0 (failed to lock argument 0):  Failed acquiring `_cancelMutex`, cancel in
-     *                                  progress, nothing to do but return. The method was
-     *                                  called during execution of `cancelAll()` and the
-     *                                  `Request*` callback was invoked.
-     *  1 (failed to lock argument 1):  Only `_cancelMutex` was acquired, another
-     *                                  operation in progress, retry.
-     */
-    if (result == 0) {
-      return;
-    } else if (result == -1) {
-      auto search = _inflightRequests->find(request);
-      if (search != _inflightRequests->end()) _inflightRequests->erase(search);
-      _cancelMutex.unlock();
-      _mutex.unlock();
-      return;
-    }
-  } while (true);
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  for (const auto& request : requests)
+    link(request);
 }
 
-size_t InflightRequests::cancelAll()
+void InflightRequests::merge(InflightRequests& inflightRequests)
 {
-  // Fast path when no requests have been registered or the map has been
-  // previously released.
-  if (_inflightRequests->size() == 0) return 0;
-
-  ucxx_debug("Canceling %lu requests", _inflightRequests->size());
+  if (&inflightRequests == this) return;
 
-  std::scoped_lock lock{_cancelMutex, _mutex};
+  std::scoped_lock lock{_mutex, inflightRequests._mutex};
 
-  size_t total = _inflightRequests->size();
+  auto& other = inflightRequests._head;
+  if (other._next == &other) return;
 
-  for (auto& r : *_inflightRequests) {
-    auto request = r.second;
-    if (request != nullptr) { request->cancel(); }
+  for (auto hook = other._next; hook != &other; hook = hook->_next) {
+    hook->_epoch = _epoch;
+    hook->_owner.store(this);
   }
-  _inflightRequests->clear();
 
-  return total;
+  other._next->_prev = _head._prev;
+  _head._prev->_next = other._next;
+  other._prev->_next = &_head;
+  _head._prev        = other._prev;
+  other._prev        = other._next = &other;
+
+  _size += inflightRequests._size.exchange(0);
 }
 
-InflightRequestsMapPtr InflightRequests::release()
+void InflightRequests::remove(const Request* const request)
 {
-  std::lock_guard<std::mutex> lock(_mutex);
+  auto& hook = request->_inflightRequestsHook;
+
+  /**
+   * Fast path: the request is not tracked by this container. A request can only be moved
+   * into this container by `insert()` before it completes, or by `merge()` from the
+   * container that tracks it, in which case the caller will attempt removal from the
+   * destination container afterwards.
+   */
+  if (hook._owner.load() != this) return;
+
+  // Destroy the reference only after the lock is released.
+  std::shared_ptr<Request> released{nullptr};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Ownership may have changed while acquiring the lock, e.g., by a concurrent `merge()`
+    // or `cancelAll()`.
+    if (hook._owner.load() == this) released = unlink(&hook);
+  }
+}
+
+size_t InflightRequests::cancelAll()
+{
+  // Fast path when no requests have been registered or the list has been previously
+  // merged into another container.
+  if (_size.load() == 0) return 0;
+
+  // Detach the list, requests completing while cancelation is in progress are still
+  // removed from the detached list by `remove()`.
+  InflightRequestsHook detached{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_head._next == &_head) return 0;
+
+    ucxx_debug("Canceling %lu requests", _size.load());
+
+    detached._next        = _head._next;
+    detached._prev        = _head._prev;
+    detached._next->_prev = &detached;
+    detached._prev->_next = &detached;
+    _head._prev           = _head._next = &_head;
+    _size.store(0);
+    ++_epoch;
+  }
 
-  return std::exchange(_inflightRequests, std::make_unique<InflightRequestsMap>());
+  // Cancel requests one at a time, without holding the lock while canceling as the
+  // completion callback will attempt to remove the request.
+  size_t total = 0;
+  while (true) {
+    std::shared_ptr<Request> request{nullptr};
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (detached._next == &detached) break;
+      request = unlink(detached._next);
+    }
+    if (request != nullptr) request->cancel();
+    ++total;
+  }
+
+  return total;
 }
 
 }  // namespace ucxx
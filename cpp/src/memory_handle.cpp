@@ -0,0 +1,83 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/memory_handle.h>
+#include <ucxx/remote_key.h>
+#include <ucxx/utils/ucx.h>
+
+namespace ucxx {
+
+MemoryHandle::MemoryHandle(std::shared_ptr<Context> context,
+                           const size_t size,
+                           void* buffer,
+                           const ucs_memory_type_t memoryType)
+{
+  ucp_mem_map_params_t params = {.field_mask = UCP_MEM_MAP_PARAM_FIELD_ADDRESS |
+                                               UCP_MEM_MAP_PARAM_FIELD_LENGTH |
+                                               UCP_MEM_MAP_PARAM_FIELD_FLAGS |
+                                               UCP_MEM_MAP_PARAM_FIELD_MEMORY_TYPE,
+                                 .address     = buffer,
+                                 .length      = size,
+                                 .flags       = buffer == nullptr ? UCP_MEM_MAP_ALLOCATE : 0u,
+                                 .memory_type = memoryType};
+
+  utils::ucsErrorThrow(ucp_mem_map(context->getHandle(), &params, &_handle));
+
+  // UCX may map a larger region than requested, query the actual mapping.
+  ucp_mem_attr_t attr = {.field_mask = UCP_MEM_ATTR_FIELD_ADDRESS | UCP_MEM_ATTR_FIELD_LENGTH |
+                                       UCP_MEM_ATTR_FIELD_MEM_TYPE};
+  auto status         = ucp_mem_query(_handle, &attr);
+  if (status != UCS_OK) {
+    ucp_mem_unmap(context->getHandle(), _handle);
+    utils::ucsErrorThrow(status);
+  }
+
+  _baseAddress = reinterpret_cast<uint64_t>(attr.address);
+  _size        = attr.length;
+  _memoryType  = attr.mem_type;
+
+  setParent(context);
+
+  ucxx_trace("MemoryHandle created: %p, base address: 0x%lx, size: %lu, type: %d",
+             _handle,
+             _baseAddress,
+             _size,
+             _memoryType);
+}
+
+std::shared_ptr<MemoryHandle> createMemoryHandle(
+  std::shared_ptr<Context> context,
+  const size_t size,
+  void* buffer                       = nullptr,
+  const ucs_memory_type_t memoryType = UCS_MEMORY_TYPE_HOST)
+{
+  return std::shared_ptr<MemoryHandle>(new MemoryHandle(context, size, buffer, memoryType));
+}
+
+MemoryHandle::~MemoryHandle()
+{
+  auto context = std::dynamic_pointer_cast<Context>(getParent());
+  ucp_mem_unmap(context->getHandle(), _handle);
+  ucxx_trace("MemoryHandle destroyed: %p", _handle);
+}
+
+ucp_mem_h MemoryHandle::getHandle() { return _handle; }
+
+size_t MemoryHandle::getSize() const { return _size; }
+
+uint64_t MemoryHandle::getBaseAddress() const { return _baseAddress; }
+
+ucs_memory_type_t MemoryHandle::getMemoryType() const { return _memoryType; }
+
+std::shared_ptr<RemoteKey> MemoryHandle::createRemoteKey()
+{
+  return createRemoteKeyFromMemoryHandle(
+    std::dynamic_pointer_cast<MemoryHandle>(shared_from_this()));
+}
+
+}  // namespace ucxx
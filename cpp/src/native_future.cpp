@@ -0,0 +1,188 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/log.h>
+#include <ucxx/native_future.h>
+
+namespace ucxx {
+
+NativeFuture::NativeFuture(std::shared_ptr<Notifier> notifier) : Future(notifier) {}
+
+std::shared_ptr<Future> createNativeFuture(std::shared_ptr<Notifier> notifier)
+{
+  return std::shared_ptr<Future>(new NativeFuture(notifier));
+}
+
+NativeFuture::~NativeFuture() {}
+
+void NativeFuture::notify(ucs_status_t status)
+{
+  ucxx_trace_req("NativeFuture::notify() this: %p, notifier: %p", this, _notifier.get());
+  _notifier->scheduleFutureNotify(shared_from_this(), status);
+}
+
+void NativeFuture::runCallback(const NativeFutureCallbackType& callback, ucs_status_t status)
+{
+  try {
+    callback(status);
+  } catch (const std::exception& e) {
+    ucxx_error("NativeFuture %p continuation raised an exception: %s", this, e.what());
+  }
+}
+
+void NativeFuture::set(ucs_status_t status)
+{
+  std::vector<std::pair<NativeFutureCallbackId, NativeFutureCallbackType>> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_completed) return;
+
+    ucxx_trace_req("NativeFuture::set() this: %p, status: %s", this, ucs_status_string(status));
+    _status    = status;
+    _completed = true;
+    std::swap(callbacks, _callbacks);
+  }
+  _conditionVariable.notify_all();
+
+  for (const auto& callback : callbacks)
+    runCallback(callback.second, status);
+}
+
+void* NativeFuture::getHandle() { return this; }
+
+void* NativeFuture::release() { return this; }
+
+bool NativeFuture::isCompleted()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _completed;
+}
+
+ucs_status_t NativeFuture::getStatus()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _status;
+}
+
+bool NativeFuture::wait(uint64_t periodNs)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (periodNs == 0) {
+    _conditionVariable.wait(lock, [this] { return _completed; });
+    return true;
+  }
+  return _conditionVariable.wait_for(
+    lock, std::chrono::duration<uint64_t, std::nano>(periodNs), [this] { return _completed; });
+}
+
+NativeFutureCallbackId NativeFuture::then(NativeFutureCallbackType callback)
+{
+  ucs_status_t status;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_completed) {
+      auto id = _nextCallbackId++;
+      _callbacks.emplace_back(id, std::move(callback));
+      return id;
+    }
+    status = _status;
+  }
+  runCallback(callback, status);
+  return 0;
+}
+
+bool NativeFuture::removeContinuation(NativeFutureCallbackId id)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto it = std::find_if(
+    _callbacks.begin(), _callbacks.end(), [id](const auto& c) { return c.first == id; });
+  if (it == _callbacks.end()) return false;
+  _callbacks.erase(it);
+  return true;
+}
+
+bool waitAll(const std::vector<std::shared_ptr<NativeFuture>>& futures, uint64_t periodNs)
+{
+  if (periodNs == 0) {
+    for (const auto& future : futures)
+      future->wait();
+    return true;
+  }
+
+  const auto deadline =
+    std::chrono::steady_clock::now() + std::chrono::duration<uint64_t, std::nano>(periodNs);
+  for (const auto& future : futures) {
+    if (future->isCompleted()) continue;
+
+    auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) return false;
+    auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now);
+    if (!future->wait(remaining.count())) return false;
+  }
+  return true;
+}
+
+int64_t waitAny(const std::vector<std::shared_ptr<NativeFuture>>& futures, uint64_t periodNs)
+{
+  for (size_t i = 0; i < futures.size(); ++i)
+    if (futures[i]->isCompleted()) return i;
+
+  if (futures.empty()) return -1;
+
+  /**
+   * State shared with the continuations registered on each future, allowing the waiting
+   * thread to block on a single condition variable. It must be shared because a
+   * continuation may be executing while it is removed upon return.
+   */
+  struct WaitAnyState {
+    std::mutex _mutex{};
+    std::condition_variable _conditionVariable{};
+    int64_t _index{-1};
+  };
+  auto state = std::make_shared<WaitAnyState>();
+
+  std::vector<NativeFutureCallbackId> ids;
+  ids.reserve(futures.size());
+  for (size_t i = 0; i < futures.size(); ++i) {
+    ids.push_back(futures[i]->then([state, i](ucs_status_t) {
+      {
+        std::lock_guard<std::mutex> lock(state->_mutex);
+        if (state->_index >= 0) return;
+        state->_index = i;
+      }
+      state->_conditionVariable.notify_all();
+    }));
+  }
+
+  int64_t index;
+  {
+    std::unique_lock<std::mutex> lock(state->_mutex);
+    auto completed = [&state] { return state->_index >= 0; };
+    if (periodNs == 0)
+      state->_conditionVariable.wait(lock, completed);
+    else
+      state->_conditionVariable.wait_for(
+        lock, std::chrono::duration<uint64_t, std::nano>(periodNs), completed);
+    index = state->_index;
+  }
+
+  // Don't leave continuations behind on futures that may be waited on again.
+  for (size_t i = 0; i < futures.size(); ++i)
+    if (ids[i] != 0) futures[i]->removeContinuation(ids[i]);
+
+  return index;
+}
+
+}  // namespace ucxx
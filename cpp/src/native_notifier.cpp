@@ -0,0 +1,152 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ucxx/log.h>
+#include <ucxx/native_notifier.h>
+
+namespace ucxx {
+
+NativeNotifier::NativeNotifier()
+{
+  _state->threadState = RequestNotifierThreadState::Running;
+  _notifierThread     = std::thread(run, _state);
+}
+
+std::shared_ptr<Notifier> createNativeNotifier()
+{
+  return std::shared_ptr<Notifier>(new NativeNotifier());
+}
+
+NativeNotifier::~NativeNotifier() { stopRequestNotifierThread(); }
+
+void NativeNotifier::run(std::shared_ptr<State> state)
+{
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      state->cv.wait(lock, [&state] {
+        return state->ready || state->threadState != RequestNotifierThreadState::Running;
+      });
+
+      if (!state->ready) return;
+      state->ready = false;
+    }
+
+    try {
+      notify(*state);
+    } catch (const std::exception& e) {
+      ucxx_error("NativeNotifier failed to notify futures: %s", e.what());
+    }
+  }
+}
+
+void NativeNotifier::notify(State& state)
+{
+  std::lock_guard<std::mutex> runLock(state.runMutex);
+
+  auto& batch = state.batch;
+  {
+    // Swapping preserves the capacity of both containers, avoiding reallocations.
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::swap(batch, state.futureStatus);
+  }
+
+  if (batch.empty()) return;
+
+  ucxx_trace_req("NativeNotifier::notify() notifying %lu", batch.size());
+
+  for (auto& p : batch)
+    p.first->set(p.second);
+
+  // Releasing the futures may release the last reference to the notifier, which is
+  // safe since the state is kept alive by the caller.
+  batch.clear();
+}
+
+void NativeNotifier::scheduleFutureNotify(std::shared_ptr<Future> future, ucs_status_t status)
+{
+  ucxx_trace_req("NativeNotifier::scheduleFutureNotify(): future: %p", future.get());
+  bool scheduled{false};
+  {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    if (_state->threadState == RequestNotifierThreadState::Running) {
+      _state->futureStatus.emplace_back(future, status);
+      _state->ready = true;
+      scheduled     = true;
+    }
+  }
+
+  if (scheduled)
+    _state->cv.notify_all();
+  else
+    // The notifier thread is not running anymore, set the future from the calling thread.
+    future->set(status);
+}
+
+void NativeNotifier::runRequestNotifier()
+{
+  // Hold a reference in case setting a future releases the last one to the notifier.
+  auto state = _state;
+  notify(*state);
+}
+
+RequestNotifierWaitState NativeNotifier::waitRequestNotifier(uint64_t period)
+{
+  ucxx_trace_req("NativeNotifier::waitRequestNotifier()");
+
+  auto condition = [this] {
+    return !_state->futureStatus.empty() ||
+           _state->threadState != RequestNotifierThreadState::Running;
+  };
+
+  std::unique_lock<std::mutex> lock(_state->mutex);
+  if (period > 0) {
+    if (!_state->cv.wait_for(
+          lock, std::chrono::duration<uint64_t, std::nano>(period), condition))
+      return RequestNotifierWaitState::Timeout;
+  } else {
+    _state->cv.wait(lock, condition);
+  }
+
+  return _state->futureStatus.empty() ? RequestNotifierWaitState::Shutdown
+                                      : RequestNotifierWaitState::Ready;
+}
+
+int NativeNotifier::getEventFileDescriptor() { return -1; }
+
+void NativeNotifier::stopRequestNotifierThread()
+{
+  {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    if (_state->threadState != RequestNotifierThreadState::Running) return;
+    _state->threadState = RequestNotifierThreadState::Stopping;
+  }
+  _state->cv.notify_all();
+
+  if (_notifierThread.get_id() == std::this_thread::get_id()) {
+    // Stopped from the notifier thread, possibly by the notifier's destruction when a
+    // future released its last reference. The thread holds its own reference to the state,
+    // it sets the remaining futures and exits once the current batch completes.
+    _notifierThread.detach();
+  } else {
+    if (_notifierThread.joinable()) _notifierThread.join();
+
+    // Set futures that may have been scheduled after the notifier thread drained its last
+    // batch but before it observed the stop request.
+    runRequestNotifier();
+  }
+
+  std::lock_guard<std::mutex> lock(_state->mutex);
+  _state->threadState = RequestNotifierThreadState::NotRunning;
+}
+
+}  // namespace ucxx
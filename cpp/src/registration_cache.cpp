@@ -0,0 +1,169 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/log.h>
+#include <ucxx/registration_cache.h>
+
+namespace ucxx {
+
+RegistrationCache::RegistrationCache(std::shared_ptr<Context> context, const size_t maxBytes)
+  : _maxBytes(maxBytes)
+{
+  setParent(context);
+}
+
+std::shared_ptr<RegistrationCache> createRegistrationCache(std::shared_ptr<Context> context,
+                                                          const size_t maxBytes)
+{
+  return std::shared_ptr<RegistrationCache>(new RegistrationCache(context, maxBytes));
+}
+
+RegistrationCache::Entry* RegistrationCache::find(const uint64_t begin, const uint64_t end) const
+{
+  // Only registrations starting at most `_maxEntryLength` bytes before `begin` may cover
+  // the range, walk back from the last one starting at or before `begin`.
+  auto it = _entries.upper_bound(begin);
+  while (it != _entries.begin()) {
+    --it;
+    if (it->first + _maxEntryLength <= begin) break;
+    if (it->second->end >= end) return it->second.get();
+  }
+  return nullptr;
+}
+
+void RegistrationCache::touch(Entry* entry)
+{
+  // Concurrent lookups only hold `_mutex` shared, the list itself needs its own mutex.
+  std::lock_guard<std::mutex> lock(_recencyMutex);
+  _recency.splice(_recency.begin(), _recency, entry->recency);
+}
+
+RegistrationCache::EntryMap::iterator RegistrationCache::erase(EntryMap::iterator it)
+{
+  _cachedBytes -= it->second->memoryHandle->getSize();
+  _recency.erase(it->second->recency);
+  return _entries.erase(it);
+}
+
+void RegistrationCache::evictLeastRecentlyUsed()
+{
+  if (_recency.empty()) return;
+
+  // Ranges starting at the same address are rare, scanning them is cheap.
+  const Entry* lru = _recency.back();
+  const auto base  = lru->memoryHandle->getBaseAddress();
+  auto range       = _entries.equal_range(base);
+  auto it          = std::find_if(
+    range.first, range.second, [lru](const auto& e) { return e.second.get() == lru; });
+
+  ucxx_trace("RegistrationCache %p evicting 0x%lx-0x%lx", this, base, lru->end);
+  erase(it);
+  ++_evictions;
+}
+
+std::shared_ptr<MemoryHandle> RegistrationCache::get(void* address,
+                                                     const size_t length,
+                                                     const ucs_memory_type_t memoryType)
+{
+  const uint64_t begin = reinterpret_cast<uint64_t>(address);
+  const uint64_t end   = begin + length;
+
+  {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    if (auto entry = find(begin, end)) {
+      touch(entry);
+      ++_hits;
+      return entry->memoryHandle;
+    }
+  }
+
+  // Registering is expensive, it is done without holding the lock.
+  ++_misses;
+  auto context      = std::dynamic_pointer_cast<Context>(getParent());
+  auto memoryHandle = createMemoryHandle(context, length, address, memoryType);
+  const auto size   = memoryHandle->getSize();
+
+  if (size > _maxBytes) return memoryHandle;
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+
+  // The range may have been registered concurrently by another thread.
+  if (auto entry = find(begin, end)) {
+    touch(entry);
+    return entry->memoryHandle;
+  }
+
+  while (_cachedBytes + size > _maxBytes)
+    evictLeastRecentlyUsed();
+  if (_entries.empty()) _maxEntryLength = 0;
+
+  auto entry          = std::make_unique<Entry>();
+  entry->memoryHandle = memoryHandle;
+  entry->end          = memoryHandle->getBaseAddress() + size;
+  auto inserted       = _entries.emplace(memoryHandle->getBaseAddress(), std::move(entry));
+  inserted->second->recency = _recency.insert(_recency.begin(), inserted->second.get());
+  _maxEntryLength = std::max(_maxEntryLength, size);
+  _cachedBytes += size;
+
+  return memoryHandle;
+}
+
+size_t RegistrationCache::invalidate(void* address, const size_t length)
+{
+  const uint64_t begin = reinterpret_cast<uint64_t>(address);
+  const uint64_t end   = begin + length;
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+
+  size_t removed = 0;
+  auto it = _entries.lower_bound(begin > _maxEntryLength ? begin - _maxEntryLength : 0);
+  while (it != _entries.end() && it->first < end) {
+    if (it->second->end > begin) {
+      it = erase(it);
+      ++removed;
+    } else {
+      ++it;
+    }
+  }
+
+  return removed;
+}
+
+void RegistrationCache::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _entries.clear();
+  _recency.clear();
+  _maxEntryLength = 0;
+  _cachedBytes    = 0;
+}
+
+uint64_t RegistrationCache::getHits() const { return _hits; }
+
+uint64_t RegistrationCache::getMisses() const { return _misses; }
+
+uint64_t RegistrationCache::getEvictions() const { return _evictions; }
+
+size_t RegistrationCache::getCachedBytes() const
+{
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _cachedBytes;
+}
+
+size_t RegistrationCache::getMaxBytes() const { return _maxBytes; }
+
+size_t RegistrationCache::getSize() const
+{
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _entries.size();
+}
+
+}  // namespace ucxx
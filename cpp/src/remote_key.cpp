@@ -0,0 +1,109 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/remote_key.h>
+#include <ucxx/utils/ucx.h>
+
+namespace ucxx {
+
+namespace {
+
+// Serialized remote keys are the base address, size and length of the packed remote key
+// followed by the packed remote key itself.
+constexpr size_t serializedHeaderSize = 2 * sizeof(uint64_t) + sizeof(size_t);
+
+}  // namespace
+
+RemoteKey::RemoteKey(std::shared_ptr<MemoryHandle> memoryHandle)
+  : _memoryBaseAddress(memoryHandle->getBaseAddress()), _memorySize(memoryHandle->getSize())
+{
+  auto context = std::dynamic_pointer_cast<Context>(memoryHandle->getParent());
+
+  void* packedRemoteKey{nullptr};
+  size_t packedRemoteKeySize{0};
+  utils::ucsErrorThrow(ucp_rkey_pack(
+    context->getHandle(), memoryHandle->getHandle(), &packedRemoteKey, &packedRemoteKeySize));
+  _packedRemoteKey.assign(reinterpret_cast<char*>(packedRemoteKey), packedRemoteKeySize);
+  ucp_rkey_buffer_release(packedRemoteKey);
+
+  setParent(memoryHandle);
+
+  ucxx_trace("RemoteKey created from memory handle %p, base address: 0x%lx, size: %lu",
+             memoryHandle->getHandle(),
+             _memoryBaseAddress,
+             _memorySize);
+}
+
+RemoteKey::RemoteKey(std::shared_ptr<Endpoint> endpoint, const std::string& serializedRemoteKey)
+{
+  if (serializedRemoteKey.size() < serializedHeaderSize)
+    throw std::runtime_error("Serialized remote key is too short");
+
+  const char* serialized = serializedRemoteKey.data();
+  size_t packedRemoteKeySize{0};
+  std::memcpy(&_memoryBaseAddress, serialized, sizeof(_memoryBaseAddress));
+  std::memcpy(&_memorySize, serialized + sizeof(uint64_t), sizeof(_memorySize));
+  std::memcpy(&packedRemoteKeySize, serialized + 2 * sizeof(uint64_t), sizeof(size_t));
+
+  if (serializedRemoteKey.size() != serializedHeaderSize + packedRemoteKeySize)
+    throw std::runtime_error("Serialized remote key size does not match its contents");
+
+  _packedRemoteKey = serializedRemoteKey.substr(serializedHeaderSize);
+  utils::ucsErrorThrow(
+    ucp_ep_rkey_unpack(endpoint->getHandle(), _packedRemoteKey.data(), &_handle));
+
+  setParent(endpoint);
+
+  ucxx_trace("RemoteKey created from serialized remote key: %p, base address: 0x%lx, size: %lu",
+             _handle,
+             _memoryBaseAddress,
+             _memorySize);
+}
+
+std::shared_ptr<RemoteKey> createRemoteKeyFromMemoryHandle(
+  std::shared_ptr<MemoryHandle> memoryHandle)
+{
+  return std::shared_ptr<RemoteKey>(new RemoteKey(memoryHandle));
+}
+
+std::shared_ptr<RemoteKey> createRemoteKeyFromSerialized(std::shared_ptr<Endpoint> endpoint,
+                                                         const std::string& serializedRemoteKey)
+{
+  return std::shared_ptr<RemoteKey>(new RemoteKey(endpoint, serializedRemoteKey));
+}
+
+RemoteKey::~RemoteKey()
+{
+  if (_handle != nullptr) ucp_rkey_destroy(_handle);
+  ucxx_trace("RemoteKey destroyed: %p", _handle);
+}
+
+ucp_rkey_h RemoteKey::getHandle() { return _handle; }
+
+uint64_t RemoteKey::getBaseAddress() const { return _memoryBaseAddress; }
+
+size_t RemoteKey::getSize() const { return _memorySize; }
+
+std::string RemoteKey::serialize() const
+{
+  const size_t packedRemoteKeySize = _packedRemoteKey.size();
+
+  std::string serialized(serializedHeaderSize, '\0');
+  std::memcpy(serialized.data(), &_memoryBaseAddress, sizeof(_memoryBaseAddress));
+  std::memcpy(serialized.data() + sizeof(uint64_t), &_memorySize, sizeof(_memorySize));
+  std::memcpy(
+    serialized.data() + 2 * sizeof(uint64_t), &packedRemoteKeySize, sizeof(packedRemoteKeySize));
+  serialized.append(_packedRemoteKey);
+
+  return serialized;
+}
+
+}  // namespace ucxx
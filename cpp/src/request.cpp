@@ -17,8 +17,8 @@
 namespace ucxx {
 
 Request::Request(std::shared_ptr<Component> endpointOrWorker,
-                 std::shared_ptr<DelayedSubmission> delayedSubmission,
-                 const std::string operationName,
+                 const DelayedSubmission& delayedSubmission,
+                 const char* operationName,
                  const bool enablePythonFuture)
   : _delayedSubmission(delayedSubmission),
     _operationName(operationName),
@@ -39,43 +39,60 @@ Request::Request(std::shared_ptr<Component> endpointOrWorker,
     ucxx_trace_req("req: %p, _future: %p", _request, _future.get());
   }
 
-  std::stringstream ss;
-
-  if (_endpoint) {
+  if (_endpoint)
     setParent(_endpoint);
-    ss << "ep " << _endpoint->getHandle();
-  } else {
+  else
     setParent(_worker);
-    ss << "worker " << _worker->getHandle();
-  }
 
-  _ownerString = ss.str();
+  ucxx_trace("Request created: %p, %s", this, _operationName);
+}
+
+Request::~Request() { ucxx_trace("Request destroyed: %p, %s", this, _operationName); }
 
-  ucxx_trace("Request created: %p, %s", this, _operationName.c_str());
+RequestPoolAllocator<Request> Request::getAllocator(std::shared_ptr<Worker> worker,
+                                                    void** allocation)
+{
+  if (worker == nullptr) return RequestPoolAllocator<Request>(nullptr);
+  if (!worker->isUserRequestMemoryEnabled())
+    return RequestPoolAllocator<Request>(worker->getRequestPool());
+
+  // UCX requires the UCP request to precede the handle passed in `param.request`, reserve
+  // it ahead of the request keeping the request itself suitably aligned.
+  constexpr size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+  const size_t headroom = (worker->getRequestSize() + alignment - 1) / alignment * alignment;
+  return RequestPoolAllocator<Request>(worker->getRequestPool(), headroom, allocation);
 }
 
-Request::~Request() { ucxx_trace("Request destroyed: %p, %s", this, _operationName.c_str()); }
+void Request::registerSubmission()
+{
+  // A delayed notification request is not populated immediately, instead it is
+  // delayed to allow the worker progress thread to set its status, and more
+  // importantly the Python future later on, so that we don't need the GIL here.
+  _worker->registerDelayedSubmission([this]() { populateDelayedSubmission(); });
+}
+
+void* Request::getHandle() const { return _request; }
 
 void Request::cancel()
 {
   if (_status == UCS_INPROGRESS) {
     if (UCS_PTR_IS_ERR(_request)) {
       ucs_status_t status = UCS_PTR_STATUS(_request);
-      ucxx_trace_req_f(_ownerString.c_str(),
+      ucxx_trace_req_f(getOwnerString().c_str(),
                        _request,
-                       _operationName.c_str(),
+                       _operationName,
                        "unprocessed request during cancelation contains error: %d (%s)",
                        status,
                        ucs_status_string(status));
     } else {
-      ucxx_trace_req_f(_ownerString.c_str(), _request, _operationName.c_str(), "canceling");
+      ucxx_trace_req_f(getOwnerString().c_str(), _request, _operationName, "canceling");
       ucp_request_cancel(_worker->getHandle(), _request);
     }
   } else {
     auto status = _status.load();
-    ucxx_trace_req_f(_ownerString.c_str(),
+    ucxx_trace_req_f(getOwnerString().c_str(),
                      _request,
-                     _operationName.c_str(),
+                     _operationName,
                      "already completed with status: %d (%s)",
                      status,
                      ucs_status_string(status));
@@ -86,6 +103,8 @@ ucs_status_t Request::getStatus() { return _status; }
 
 void* Request::getFuture() { return _future ? _future->getHandle() : nullptr; }
 
+std::shared_ptr<Future> Request::getFutureObject() { return _future; }
+
 void Request::checkError()
 {
   // Only load the atomic variable once
@@ -98,16 +117,22 @@ bool Request::isCompleted() { return _status != UCS_INPROGRESS; }
 
 void Request::callback(void* request, ucs_status_t status)
 {
+  // Completion releases the references held by the parent's inflight requests and the
+  // user callback may release the last one, keep the request, and the UCP request it may
+  // hold, alive until the callback returns.
+  auto self = shared_from_this();
+
   setStatus(status);
 
-  ucxx_trace_req_f(_ownerString.c_str(),
+  ucxx_trace_req_f(getOwnerString().c_str(),
                    request,
-                   _operationName.c_str(),
+                   _operationName,
                    "callback %p",
                    _callback.target<void (*)(void)>());
   if (_callback) _callback(_callbackData);
 
-  ucp_request_free(request);
+  // User-allocated requests are owned by this object and must not be released to UCX.
+  if (_userRequestMemory == nullptr) ucp_request_free(request);
   ucxx_trace("Request completed: %p, handle: %p", this, request);
 }
 
@@ -120,37 +145,37 @@ void Request::process()
     status = UCS_PTR_STATUS(_request);
   } else if (UCS_PTR_IS_PTR(_request)) {
     // Completion will be handled by callback
-    ucxx_trace_req_f(_ownerString.c_str(),
+    ucxx_trace_req_f(getOwnerString().c_str(),
                      _request,
-                     _operationName.c_str(),
+                     _operationName,
                      "completion will be handled by callback");
     ucxx_trace("Request submitted: %p, handle: %p", this, _request);
     return;
   } else {
-    // Operation completed immediately
-    status = UCS_OK;
+    // Operation completed immediately, unless the request already verified a failure
+    if (status == UCS_INPROGRESS) status = UCS_OK;
   }
 
-  ucxx_trace_req_f(_ownerString.c_str(),
+  ucxx_trace_req_f(getOwnerString().c_str(),
                    _request,
-                   _operationName.c_str(),
+                   _operationName,
                    "status %d (%s)",
                    status,
                    ucs_status_string(status));
 
-  ucxx_trace_req_f(_ownerString.c_str(),
+  ucxx_trace_req_f(getOwnerString().c_str(),
                    _request,
-                   _operationName.c_str(),
+                   _operationName,
                    "callback %p",
                    _callback.target<void (*)(void)>());
   if (_callback) _callback(_callbackData);
 
   if (status != UCS_OK) {
     ucxx_error(
-      "error on %s with status %d (%s)", _operationName.c_str(), status, ucs_status_string(status));
+      "error on %s with status %d (%s)", _operationName, status, ucs_status_string(status));
   } else {
     ucxx_trace_req_f(
-      _ownerString.c_str(), _request, _operationName.c_str(), "completed immediately");
+      getOwnerString().c_str(), _request, _operationName, "completed immediately");
   }
 
   setStatus(status);
@@ -169,19 +194,43 @@ void Request::setStatus(ucs_status_t status)
 
   ucs_status_t s = _status;
 
-  ucxx_trace_req_f(_ownerString.c_str(),
+  ucxx_trace_req_f(getOwnerString().c_str(),
                    _request,
-                   _operationName.c_str(),
+                   _operationName,
                    "callback called with status %d (%s)",
                    s,
                    ucs_status_string(s));
 
   if (_enablePythonFuture) {
     auto future = std::static_pointer_cast<ucxx::Future>(_future);
-    future->notify(status);
+    future->notify(s);
   }
+
+  // Requests opt in to the completion queue by registering data without a callback.
+  if (_callback == nullptr && _callbackData != nullptr && _worker->isCompletionQueueEnabled())
+    _worker->pushCompletion({_callbackData, s, s == UCS_OK ? getTransferredLength() : 0});
 }
 
-const std::string& Request::getOwnerString() const { return _ownerString; }
+void Request::setUserRequestMemory(ucp_request_param_t& param)
+{
+  if (_userRequestMemory == nullptr) return;
+
+  param.op_attr_mask |= UCP_OP_ATTR_FIELD_REQUEST;
+  param.request = _userRequestMemory;
+}
+
+size_t Request::getTransferredLength() const { return _delayedSubmission._length; }
+
+std::string Request::getOwnerString() const
+{
+  std::stringstream ss;
+
+  if (_endpoint)
+    ss << "ep " << _endpoint->getHandle();
+  else
+    ss << "worker " << _worker->getHandle();
+
+  return ss.str();
+}
 
 }  // namespace ucxx
@@ -0,0 +1,199 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/request_am.h>
+#include <ucxx/request_pool.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+RequestAm::RequestAm(std::shared_ptr<Endpoint> endpoint,
+                     const unsigned id,
+                     const std::string& header,
+                     void* buffer,
+                     size_t length,
+                     const bool enablePythonFuture,
+                     std::function<void(std::shared_ptr<void>)> callbackFunction,
+                     std::shared_ptr<void> callbackData)
+  : Request(endpoint, DelayedSubmission(true, buffer, length), "amSend", enablePythonFuture),
+    _amId(id),
+    _header(header)
+{
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+}
+
+RequestAm::RequestAm(std::shared_ptr<Worker> worker,
+                     const unsigned id,
+                     std::string header,
+                     void* dataDescriptor,
+                     std::shared_ptr<Buffer> buffer,
+                     AmHandlerType handler,
+                     void* handlerArg)
+  : Request(worker,
+            DelayedSubmission(false, buffer->data(), buffer->getSize()),
+            "amRecvData",
+            false),
+    _amId(id),
+    _header(std::move(header)),
+    _dataDescriptor(dataDescriptor),
+    _buffer(buffer),
+    _handler(handler),
+    _handlerArg(handlerArg)
+{
+}
+
+std::shared_ptr<RequestAm> createRequestAmSend(
+  std::shared_ptr<Endpoint> endpoint,
+  const unsigned id,
+  const std::string& header,
+  void* buffer,
+  size_t length,
+  const bool enablePythonFuture                               = false,
+  std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+  std::shared_ptr<void> callbackData                          = nullptr)
+{
+  auto worker = Endpoint::getWorker(endpoint->getParent());
+
+  auto request = allocateRequest<RequestAm>(worker,
+                                            endpoint,
+                                            id,
+                                            header,
+                                            buffer,
+                                            length,
+                                            enablePythonFuture,
+                                            callbackFunction,
+                                            callbackData);
+  request->registerSubmission();
+  return request;
+}
+
+std::shared_ptr<RequestAm> createRequestAmRecvData(std::shared_ptr<Worker> worker,
+                                                   const unsigned id,
+                                                   std::string header,
+                                                   void* dataDescriptor,
+                                                   std::shared_ptr<Buffer> buffer,
+                                                   AmHandlerType handler,
+                                                   void* handlerArg)
+{
+  auto request = allocateRequest<RequestAm>(worker,
+                                            worker,
+                                            id,
+                                            std::move(header),
+                                            dataDescriptor,
+                                            buffer,
+                                            handler,
+                                            handlerArg);
+
+  // Fetching is always initiated from the worker progress, thus submitted immediately.
+  request->request();
+  request->process();
+  if (request->isCompleted()) request->callHandler();
+
+  return request;
+}
+
+void RequestAm::request()
+{
+  ucp_request_param_t param = {.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |
+                                               UCP_OP_ATTR_FIELD_DATATYPE |
+                                               UCP_OP_ATTR_FIELD_USER_DATA,
+                               .datatype  = ucp_dt_make_contig(1),
+                               .user_data = this};
+
+  setUserRequestMemory(param);
+
+  if (_delayedSubmission._send) {
+    param.cb.send = amSendCallback;
+    _request      = ucp_am_send_nbx(_endpoint->getHandle(),
+                               _amId,
+                               _header.data(),
+                               _header.size(),
+                               _delayedSubmission._buffer,
+                               _delayedSubmission._length,
+                               &param);
+  } else {
+    param.cb.recv_am = amRecvDataCallback;
+    _request         = ucp_am_recv_data_nbx(_worker->getHandle(),
+                                    _dataDescriptor,
+                                    _delayedSubmission._buffer,
+                                    _delayedSubmission._length,
+                                    &param);
+  }
+}
+
+void RequestAm::populateDelayedSubmission()
+{
+  request();
+
+  if (_enablePythonFuture)
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "id %u, header size %lu, buffer %p, size %lu, future %p, future handle %p, "
+                     "populateDelayedSubmission",
+                     _amId,
+                     _header.size(),
+                     _delayedSubmission._buffer,
+                     _delayedSubmission._length,
+                     _future.get(),
+                     _future->getHandle());
+  else
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "id %u, header size %lu, buffer %p, size %lu, populateDelayedSubmission",
+                     _amId,
+                     _header.size(),
+                     _delayedSubmission._buffer,
+                     _delayedSubmission._length);
+
+  process();
+}
+
+void RequestAm::callHandler()
+{
+  AmMessage message{_amId,
+                    _status.load(),
+                    std::move(_header),
+                    _delayedSubmission._buffer,
+                    _delayedSubmission._length,
+                    std::move(_buffer)};
+
+  try {
+    _handler(message, _handlerArg);
+  } catch (const std::exception& e) {
+    ucxx_error("Active Message handler for id %u raised an exception: %s", _amId, e.what());
+  }
+}
+
+void RequestAm::amSendCallback(void* request, ucs_status_t status, void* arg)
+{
+  RequestAm* req = reinterpret_cast<RequestAm*>(arg);
+  ucxx_trace_req_f(req->getOwnerString().c_str(), request, "amSend", "amSendCallback");
+  return req->callback(request, status);
+}
+
+void RequestAm::amRecvDataCallback(void* request, ucs_status_t status, size_t length, void* arg)
+{
+  RequestAm* req = reinterpret_cast<RequestAm*>(arg);
+  ucxx_trace_req_f(req->getOwnerString().c_str(), request, "amRecvData", "amRecvDataCallback");
+
+  // Completing the request releases the reference held by the worker's inflight requests,
+  // the request must be kept alive until the handler returns.
+  auto self = req->shared_from_this();
+  req->callback(request, status);
+  req->callHandler();
+}
+
+}  // namespace ucxx
@@ -0,0 +1,149 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <stdexcept>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/request_atomic.h>
+#include <ucxx/request_pool.h>
+
+namespace ucxx {
+
+static const char* atomicOperationName(const ucp_atomic_op_t opcode, const bool fetch)
+{
+  switch (opcode) {
+    case UCP_ATOMIC_OP_ADD: return fetch ? "fetchAdd" : "atomicAdd";
+    case UCP_ATOMIC_OP_SWAP: return "swap";
+    case UCP_ATOMIC_OP_CSWAP: return "compareSwap";
+    default: throw std::invalid_argument("Unsupported atomic operation");
+  }
+}
+
+RequestAtomic::RequestAtomic(std::shared_ptr<Endpoint> endpoint,
+                             const ucp_atomic_op_t opcode,
+                             const bool fetch,
+                             const uint64_t value,
+                             const uint64_t compare,
+                             uint64_t* result,
+                             uint64_t remoteAddress,
+                             std::shared_ptr<RemoteKey> remoteKey,
+                             const bool enablePythonFuture,
+                             std::function<void(std::shared_ptr<void>)> callbackFunction,
+                             std::shared_ptr<void> callbackData)
+  : Request(endpoint,
+            DelayedSubmission(true, result, sizeof(uint64_t)),
+            atomicOperationName(opcode, fetch),
+            enablePythonFuture),
+    _opcode(opcode),
+    _fetch(fetch),
+    _value(value),
+    _result(result),
+    _remoteAddress(remoteAddress),
+    _remoteKey(remoteKey)
+{
+  if (!fetch && opcode != UCP_ATOMIC_OP_ADD)
+    throw std::invalid_argument("Only the add atomic operation may be performed without a result");
+  if (fetch && result == nullptr)
+    throw std::invalid_argument("A result is required by fetching atomic operations");
+  if (!fetch && result != nullptr)
+    throw std::invalid_argument("A result may only be specified by fetching atomic operations");
+  if (remoteAddress < remoteKey->getBaseAddress() ||
+      remoteAddress + sizeof(uint64_t) > remoteKey->getBaseAddress() + remoteKey->getSize())
+    throw std::out_of_range("Remote value is not within the remote memory of the remote key");
+
+  // The reply buffer of a compare-and-swap holds the value to compare with on submission,
+  // and is replaced with the previous remote value upon completion.
+  if (opcode == UCP_ATOMIC_OP_CSWAP) *_result = compare;
+
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+}
+
+std::shared_ptr<RequestAtomic> createRequestAtomic(
+  std::shared_ptr<Endpoint> endpoint,
+  const ucp_atomic_op_t opcode,
+  const bool fetch,
+  const uint64_t value,
+  const uint64_t compare,
+  uint64_t* result,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture                               = false,
+  std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+  std::shared_ptr<void> callbackData                          = nullptr)
+{
+  auto worker = Endpoint::getWorker(endpoint->getParent());
+
+  auto request = allocateRequest<RequestAtomic>(worker,
+                                                endpoint,
+                                                opcode,
+                                                fetch,
+                                                value,
+                                                compare,
+                                                result,
+                                                remoteAddress,
+                                                remoteKey,
+                                                enablePythonFuture,
+                                                callbackFunction,
+                                                callbackData);
+  request->registerSubmission();
+  return request;
+}
+
+void RequestAtomic::request()
+{
+  ucp_request_param_t param = {.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |
+                                               UCP_OP_ATTR_FIELD_DATATYPE |
+                                               UCP_OP_ATTR_FIELD_USER_DATA,
+                               .datatype  = ucp_dt_make_contig(sizeof(uint64_t)),
+                               .user_data = this};
+  param.cb.send             = atomicCallback;
+
+  if (_fetch) {
+    param.op_attr_mask |= UCP_OP_ATTR_FIELD_REPLY_BUFFER;
+    param.reply_buffer = _result;
+  }
+
+  setUserRequestMemory(param);
+
+  _request = ucp_atomic_op_nbx(
+    _endpoint->getHandle(), _opcode, &_value, 1, _remoteAddress, _remoteKey->getHandle(), &param);
+}
+
+void RequestAtomic::populateDelayedSubmission()
+{
+  request();
+
+  if (_enablePythonFuture)
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "value %lu, remote address 0x%lx, future %p, future handle %p, "
+                     "populateDelayedSubmission",
+                     _value,
+                     _remoteAddress,
+                     _future.get(),
+                     _future->getHandle());
+  else
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "value %lu, remote address 0x%lx, populateDelayedSubmission",
+                     _value,
+                     _remoteAddress);
+
+  process();
+}
+
+void RequestAtomic::atomicCallback(void* request, ucs_status_t status, void* arg)
+{
+  RequestAtomic* req = reinterpret_cast<RequestAtomic*>(arg);
+  ucxx_trace_req_f(req->getOwnerString().c_str(), request, req->_operationName, "atomicCallback");
+  return req->callback(request, status);
+}
+
+}  // namespace ucxx
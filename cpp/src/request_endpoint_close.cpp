@@ -0,0 +1,124 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/request_endpoint_close.h>
+#include <ucxx/request_pool.h>
+
+namespace ucxx {
+
+RequestEndpointClose::RequestEndpointClose(
+  std::shared_ptr<Endpoint> endpoint,
+  const EndpointCloseMode mode,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+  : Request(endpoint, DelayedSubmission(false, nullptr, 0), "endpointClose", enablePythonFuture),
+    _mode(mode)
+{
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+}
+
+std::shared_ptr<RequestEndpointClose> createRequestEndpointClose(
+  std::shared_ptr<Endpoint> endpoint,
+  const EndpointCloseMode mode,
+  const bool enablePythonFuture                               = false,
+  std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+  std::shared_ptr<void> callbackData                          = nullptr)
+{
+  auto worker = Endpoint::getWorker(endpoint->getParent());
+
+  auto request = allocateRequest<RequestEndpointClose>(
+    worker, endpoint, mode, enablePythonFuture, callbackFunction, callbackData);
+  request->registerSubmission();
+  return request;
+}
+
+std::vector<std::shared_ptr<Request>> createRequestEndpointCloseBatch(
+  const std::vector<std::shared_ptr<Endpoint>>& endpoints,
+  const EndpointCloseMode mode,
+  const bool enablePythonFuture = false)
+{
+  std::vector<std::shared_ptr<Request>> requests;
+  if (endpoints.empty()) return requests;
+
+  auto worker = Endpoint::getWorker(endpoints.front()->getParent());
+
+  requests.reserve(endpoints.size());
+  for (const auto& endpoint : endpoints)
+    requests.push_back(
+      allocateRequest<RequestEndpointClose>(worker, endpoint, mode, enablePythonFuture));
+
+  return requests;
+}
+
+void RequestEndpointClose::request()
+{
+  // An endpoint that already errored can't flush, it must be force closed.
+  if (!_endpoint->isAlive()) _mode = EndpointCloseMode::Force;
+
+  // Outstanding operations will never complete once the endpoint is force closed.
+  if (_mode == EndpointCloseMode::Force) {
+    size_t canceled = _endpoint->cancelInflightRequests();
+    ucxx_debug("Endpoint %p canceled %lu requests", _endpoint->getHandle(), canceled);
+  }
+
+  ucp_request_param_t param = {
+    .op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK | UCP_OP_ATTR_FIELD_FLAGS |
+                    UCP_OP_ATTR_FIELD_USER_DATA,
+    .flags     = _mode == EndpointCloseMode::Force ? UCP_EP_CLOSE_FLAG_FORCE : 0u,
+    .user_data = this};
+  param.cb.send = endpointCloseCallback;
+
+  setUserRequestMemory(param);
+
+  // Claim the UCP endpoint, which must not be used after the close is submitted, the
+  // endpoint may have been closed by another request or `Endpoint::close()` meanwhile.
+  ucp_ep_h handle = _endpoint->setClosed();
+  if (handle == nullptr) {
+    _request = UCS_STATUS_PTR(UCS_ERR_NOT_CONNECTED);
+    return;
+  }
+
+  _request = ucp_ep_close_nbx(handle, &param);
+}
+
+void RequestEndpointClose::populateDelayedSubmission()
+{
+  request();
+
+  if (_enablePythonFuture)
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "force %d, future %p, future handle %p, populateDelayedSubmission",
+                     _mode == EndpointCloseMode::Force,
+                     _future.get(),
+                     _future->getHandle());
+  else
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "force %d, populateDelayedSubmission",
+                     _mode == EndpointCloseMode::Force);
+
+  process();
+}
+
+void RequestEndpointClose::endpointCloseCallback(void* request, ucs_status_t status, void* arg)
+{
+  Request* req = reinterpret_cast<Request*>(arg);
+  ucxx_trace_req_f(
+    req->getOwnerString().c_str(), request, "endpointClose", "endpointCloseCallback");
+  return req->callback(request, status);
+}
+
+}  // namespace ucxx
@@ -0,0 +1,111 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/endpoint.h>
+#include <ucxx/exception.h>
+#include <ucxx/hostname_resolver.h>
+#include <ucxx/request_endpoint_create.h>
+#include <ucxx/request_pool.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+RequestEndpointCreate::RequestEndpointCreate(
+  std::shared_ptr<Worker> worker,
+  std::string ipAddress,
+  uint16_t port,
+  bool endpointErrorHandling,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+  : Request(worker, DelayedSubmission(false, nullptr, 0), "endpointCreate", enablePythonFuture),
+    _ipAddress(std::move(ipAddress)),
+    _port(port),
+    _endpointErrorHandling(endpointErrorHandling)
+{
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+}
+
+std::shared_ptr<RequestEndpointCreate> createRequestEndpointCreate(
+  std::shared_ptr<Worker> worker,
+  std::string ipAddress,
+  uint16_t port,
+  bool endpointErrorHandling,
+  const bool enablePythonFuture                               = false,
+  std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+  std::shared_ptr<void> callbackData                          = nullptr)
+{
+  auto request = allocateRequest<RequestEndpointCreate>(worker->getRequestPool(),
+                                                        worker,
+                                                        ipAddress,
+                                                        port,
+                                                        endpointErrorHandling,
+                                                        enablePythonFuture,
+                                                        callbackFunction,
+                                                        callbackData);
+
+  // The resolver and delayed submission callbacks own a reference to the request, thus it
+  // remains alive until the endpoint is created even if the user releases it.
+  worker->getHostnameResolver()->resolve(
+    request->_ipAddress,
+    [request](ucs_status_t status, const sockaddr_storage& address, socklen_t length) {
+      request->_resolveStatus = status;
+      if (status == UCS_OK) {
+        request->_address       = address;
+        request->_addressLength = length;
+      }
+
+      // Endpoints are created by the worker progress thread if delayed submission is
+      // enabled, otherwise by the thread that resolved the hostname.
+      request->_worker->registerDelayedSubmission(
+        [request]() { request->populateDelayedSubmission(); });
+    });
+
+  return request;
+}
+
+void RequestEndpointCreate::populateDelayedSubmission()
+{
+  if (_resolveStatus != UCS_OK) {
+    _request = UCS_STATUS_PTR(_resolveStatus);
+  } else {
+    try {
+      _newEndpoint = createEndpointFromSocketAddress(
+        _worker, _address, _addressLength, _port, _endpointErrorHandling);
+    } catch (const ucxx::Error& e) {
+      ucxx_debug("Failed to create endpoint to %s:%u: %s", _ipAddress.c_str(), _port, e.what());
+      _request = UCS_STATUS_PTR(UCS_ERR_UNREACHABLE);
+    }
+  }
+
+  if (_enablePythonFuture)
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "%s:%u, future %p, future handle %p, populateDelayedSubmission",
+                     _ipAddress.c_str(),
+                     _port,
+                     _future.get(),
+                     _future->getHandle());
+  else
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "%s:%u, populateDelayedSubmission",
+                     _ipAddress.c_str(),
+                     _port);
+
+  process();
+}
+
+std::shared_ptr<Endpoint> RequestEndpointCreate::getEndpoint() { return _newEndpoint; }
+
+}  // namespace ucxx
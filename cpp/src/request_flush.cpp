@@ -0,0 +1,77 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/request_flush.h>
+#include <ucxx/request_pool.h>
+
+namespace ucxx {
+
+RequestFlush::RequestFlush(std::shared_ptr<Endpoint> endpoint,
+                           const bool enablePythonFuture,
+                           std::function<void(std::shared_ptr<void>)> callbackFunction,
+                           std::shared_ptr<void> callbackData)
+  : Request(endpoint, DelayedSubmission(false, nullptr, 0), "flush", enablePythonFuture)
+{
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+}
+
+std::shared_ptr<RequestFlush> createRequestFlush(
+  std::shared_ptr<Endpoint> endpoint,
+  const bool enablePythonFuture                               = false,
+  std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+  std::shared_ptr<void> callbackData                          = nullptr)
+{
+  auto worker = Endpoint::getWorker(endpoint->getParent());
+
+  auto request = allocateRequest<RequestFlush>(
+    worker, endpoint, enablePythonFuture, callbackFunction, callbackData);
+  request->registerSubmission();
+  return request;
+}
+
+void RequestFlush::request()
+{
+  ucp_request_param_t param = {.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |
+                                               UCP_OP_ATTR_FIELD_USER_DATA,
+                               .user_data    = this};
+  param.cb.send             = flushCallback;
+
+  setUserRequestMemory(param);
+
+  _request = ucp_ep_flush_nbx(_endpoint->getHandle(), &param);
+}
+
+void RequestFlush::populateDelayedSubmission()
+{
+  request();
+
+  if (_enablePythonFuture)
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "future %p, future handle %p, populateDelayedSubmission",
+                     _future.get(),
+                     _future->getHandle());
+  else
+    ucxx_trace_req_f(
+      getOwnerString().c_str(), _request, _operationName, "populateDelayedSubmission");
+
+  process();
+}
+
+void RequestFlush::flushCallback(void* request, ucs_status_t status, void* arg)
+{
+  Request* req = reinterpret_cast<Request*>(arg);
+  ucxx_trace_req_f(req->getOwnerString().c_str(), request, "flush", "flushCallback");
+  return req->callback(request, status);
+}
+
+}  // namespace ucxx
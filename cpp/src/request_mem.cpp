@@ -0,0 +1,126 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <stdexcept>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/request_mem.h>
+#include <ucxx/request_pool.h>
+
+namespace ucxx {
+
+RequestMem::RequestMem(std::shared_ptr<Endpoint> endpoint,
+                       const bool put,
+                       void* buffer,
+                       size_t length,
+                       uint64_t remoteAddress,
+                       std::shared_ptr<RemoteKey> remoteKey,
+                       const bool enablePythonFuture,
+                       std::function<void(std::shared_ptr<void>)> callbackFunction,
+                       std::shared_ptr<void> callbackData)
+  : Request(
+      endpoint, DelayedSubmission(put, buffer, length), put ? "put" : "get", enablePythonFuture),
+    _remoteAddress(remoteAddress),
+    _remoteKey(remoteKey)
+{
+  if (remoteAddress < remoteKey->getBaseAddress() ||
+      remoteAddress + length > remoteKey->getBaseAddress() + remoteKey->getSize())
+    throw std::out_of_range("Remote range is not within the remote memory of the remote key");
+
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+}
+
+std::shared_ptr<RequestMem> createRequestMem(
+  std::shared_ptr<Endpoint> endpoint,
+  const bool put,
+  void* buffer,
+  size_t length,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture                               = false,
+  std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
+  std::shared_ptr<void> callbackData                          = nullptr)
+{
+  auto worker = Endpoint::getWorker(endpoint->getParent());
+
+  auto request = allocateRequest<RequestMem>(worker,
+                                             endpoint,
+                                             put,
+                                             buffer,
+                                             length,
+                                             remoteAddress,
+                                             remoteKey,
+                                             enablePythonFuture,
+                                             callbackFunction,
+                                             callbackData);
+  request->registerSubmission();
+  return request;
+}
+
+void RequestMem::request()
+{
+  ucp_request_param_t param = {.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |
+                                               UCP_OP_ATTR_FIELD_DATATYPE |
+                                               UCP_OP_ATTR_FIELD_USER_DATA,
+                               .datatype  = ucp_dt_make_contig(1),
+                               .user_data = this};
+  param.cb.send             = memCallback;
+
+  setUserRequestMemory(param);
+
+  if (_delayedSubmission._send)
+    _request = ucp_put_nbx(_endpoint->getHandle(),
+                           _delayedSubmission._buffer,
+                           _delayedSubmission._length,
+                           _remoteAddress,
+                           _remoteKey->getHandle(),
+                           &param);
+  else
+    _request = ucp_get_nbx(_endpoint->getHandle(),
+                           _delayedSubmission._buffer,
+                           _delayedSubmission._length,
+                           _remoteAddress,
+                           _remoteKey->getHandle(),
+                           &param);
+}
+
+void RequestMem::populateDelayedSubmission()
+{
+  request();
+
+  if (_enablePythonFuture)
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "buffer %p, size %lu, remote address 0x%lx, future %p, future handle %p, "
+                     "populateDelayedSubmission",
+                     _delayedSubmission._buffer,
+                     _delayedSubmission._length,
+                     _remoteAddress,
+                     _future.get(),
+                     _future->getHandle());
+  else
+    ucxx_trace_req_f(getOwnerString().c_str(),
+                     _request,
+                     _operationName,
+                     "buffer %p, size %lu, remote address 0x%lx, populateDelayedSubmission",
+                     _delayedSubmission._buffer,
+                     _delayedSubmission._length,
+                     _remoteAddress);
+
+  process();
+}
+
+void RequestMem::memCallback(void* request, ucs_status_t status, void* arg)
+{
+  RequestMem* req = reinterpret_cast<RequestMem*>(arg);
+  ucxx_trace_req_f(req->getOwnerString().c_str(), request, req->_operationName, "memCallback");
+  return req->callback(request, status);
+}
+
+}  // namespace ucxx
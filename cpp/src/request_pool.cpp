@@ -0,0 +1,79 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <mutex>
+#include <new>
+
+#include <ucxx/log.h>
+#include <ucxx/request_pool.h>
+
+namespace ucxx {
+
+RequestPool::RequestPool(const size_t maxCachedBlocks) : _maxCachedBlocks(maxCachedBlocks) {}
+
+RequestPool::~RequestPool()
+{
+  for (auto& freeList : _freeLists) {
+    while (freeList != nullptr) {
+      auto block = freeList;
+      freeList   = block->_next;
+      ::operator delete(block);
+    }
+  }
+}
+
+size_t RequestPool::getSizeClass(const size_t size)
+{
+  return size == 0 ? 0 : (size - 1) / _sizeClassGranularity;
+}
+
+void* RequestPool::allocate(const size_t size)
+{
+  const auto sizeClass = getSizeClass(size);
+  if (sizeClass >= _numSizeClasses) return ::operator new(size);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto block = _freeLists[sizeClass];
+    if (block != nullptr) {
+      _freeLists[sizeClass] = block->_next;
+      --_freeCounts[sizeClass];
+      return block;
+    }
+  }
+
+  ucxx_trace_data("RequestPool %p allocating new block of %lu bytes", this, size);
+  return ::operator new((sizeClass + 1) * _sizeClassGranularity);
+}
+
+void RequestPool::deallocate(void* ptr, const size_t size) noexcept
+{
+  const auto sizeClass = getSizeClass(size);
+
+  if (sizeClass < _numSizeClasses) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_freeCounts[sizeClass] < _maxCachedBlocks) {
+      auto block            = ::new (ptr) FreeBlock{_freeLists[sizeClass]};
+      _freeLists[sizeClass] = block;
+      ++_freeCounts[sizeClass];
+      return;
+    }
+  }
+
+  ::operator delete(ptr);
+}
+
+size_t RequestPool::getCachedBlocks()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  size_t total = 0;
+  for (const auto count : _freeCounts)
+    total += count;
+  return total;
+}
+
+}  // namespace ucxx
@@ -8,6 +8,7 @@
 #include <ucp/api/ucp.h>
 
 #include <ucxx/delayed_submission.h>
+#include <ucxx/request_pool.h>
 #include <ucxx/request_stream.h>
 
 namespace ucxx {
@@ -18,18 +19,11 @@ RequestStream::RequestStream(std::shared_ptr<Endpoint> endpoint,
                              size_t length,
                              const bool enablePythonFuture)
   : Request(endpoint,
-            std::make_shared<DelayedSubmission>(send, buffer, length),
-            std::string(send ? "streamSend" : "streamRecv"),
+            DelayedSubmission(send, buffer, length),
+            send ? "streamSend" : "streamRecv",
             enablePythonFuture),
     _length(length)
 {
-  auto worker = Endpoint::getWorker(endpoint->getParent());
-
-  // A delayed notification request is not populated immediately, instead it is
-  // delayed to allow the worker progress thread to set its status, and more
-  // importantly the Python future later on, so that we don't need the GIL here.
-  worker->registerDelayedSubmission(
-    std::bind(std::mem_fn(&Request::populateDelayedSubmission), this));
 }
 
 std::shared_ptr<RequestStream> createRequestStream(std::shared_ptr<Endpoint> endpoint,
@@ -38,8 +32,12 @@ std::shared_ptr<RequestStream> createRequestStream(std::shared_ptr<Endpoint> end
                                                    size_t length,
                                                    const bool enablePythonFuture = false)
 {
-  return std::shared_ptr<RequestStream>(
-    new RequestStream(endpoint, send, buffer, length, enablePythonFuture));
+  auto worker = Endpoint::getWorker(endpoint->getParent());
+
+  auto request =
+    allocateRequest<RequestStream>(worker, endpoint, send, buffer, length, enablePythonFuture);
+  request->registerSubmission();
+  return request;
 }
 
 void RequestStream::request()
@@ -50,18 +48,20 @@ void RequestStream::request()
                                .datatype  = ucp_dt_make_contig(1),
                                .user_data = this};
 
-  if (_delayedSubmission->_send) {
+  setUserRequestMemory(param);
+
+  if (_delayedSubmission._send) {
     param.cb.send = streamSendCallback;
     _request      = ucp_stream_send_nbx(
-      _endpoint->getHandle(), _delayedSubmission->_buffer, _delayedSubmission->_length, &param);
+      _endpoint->getHandle(), _delayedSubmission._buffer, _delayedSubmission._length, &param);
   } else {
     param.op_attr_mask |= UCP_OP_ATTR_FIELD_FLAGS;
     param.flags          = UCP_STREAM_RECV_FLAG_WAITALL;
     param.cb.recv_stream = streamRecvCallback;
     _request             = ucp_stream_recv_nbx(_endpoint->getHandle(),
-                                   _delayedSubmission->_buffer,
-                                   _delayedSubmission->_length,
-                                   &_delayedSubmission->_length,
+                                   _delayedSubmission._buffer,
+                                   _delayedSubmission._length,
+                                   &_delayedSubmission._length,
                                    &param);
   }
 }
@@ -71,21 +71,21 @@ void RequestStream::populateDelayedSubmission()
   request();
 
   if (_enablePythonFuture)
-    ucxx_trace_req_f(_ownerString.c_str(),
+    ucxx_trace_req_f(getOwnerString().c_str(),
                      _request,
-                     _operationName.c_str(),
+                     _operationName,
                      "buffer %p, size %lu, future %p, future handle %p, populateDelayedSubmission",
-                     _delayedSubmission->_buffer,
-                     _delayedSubmission->_length,
+                     _delayedSubmission._buffer,
+                     _delayedSubmission._length,
                      _future.get(),
                      _future->getHandle());
   else
-    ucxx_trace_req_f(_ownerString.c_str(),
+    ucxx_trace_req_f(getOwnerString().c_str(),
                      _request,
-                     _operationName.c_str(),
+                     _operationName,
                      "buffer %p, size %lu, populateDelayedSubmission",
-                     _delayedSubmission->_buffer,
-                     _delayedSubmission->_length);
+                     _delayedSubmission._buffer,
+                     _delayedSubmission._length);
   process();
 }
 
@@ -4,11 +4,14 @@
  */
 #include <cstdio>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <ucp/api/ucp.h>
 
 #include <ucxx/delayed_submission.h>
+#include <ucxx/request_pool.h>
 #include <ucxx/request_tag.h>
 
 namespace ucxx {
@@ -19,18 +22,57 @@ std::shared_ptr<RequestTag> createRequestTag(
   void* buffer,
   size_t length,
   ucp_tag_t tag,
+  const TagMask tagMask,
   const bool enablePythonFuture                               = false,
   std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
-  std::shared_ptr<void> callbackData                          = nullptr)
+  std::shared_ptr<void> callbackData                          = nullptr,
+  const bool allowShorterMessage                              = false)
 {
-  return std::shared_ptr<RequestTag>(new RequestTag(endpointOrWorker,
-                                                    send,
-                                                    buffer,
-                                                    length,
-                                                    tag,
-                                                    enablePythonFuture,
-                                                    callbackFunction,
-                                                    callbackData));
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(endpointOrWorker);
+  auto worker   = Endpoint::getWorker(endpoint ? endpoint->getParent() : endpointOrWorker);
+
+  auto request = allocateRequest<RequestTag>(worker,
+                                             endpointOrWorker,
+                                             send,
+                                             buffer,
+                                             length,
+                                             tag,
+                                             tagMask,
+                                             enablePythonFuture,
+                                             callbackFunction,
+                                             callbackData,
+                                             allowShorterMessage);
+  request->registerSubmission();
+  return request;
+}
+
+std::vector<std::shared_ptr<Request>> createRequestTagBatch(
+  std::shared_ptr<Component> endpointOrWorker,
+  bool send,
+  const std::vector<void*>& buffers,
+  const std::vector<size_t>& lengths,
+  const std::vector<ucp_tag_t>& tags,
+  const bool enablePythonFuture = false)
+{
+  if (lengths.size() != buffers.size() || tags.size() != buffers.size())
+    throw std::runtime_error("All input vectors should be of equal size");
+
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(endpointOrWorker);
+  auto worker   = Endpoint::getWorker(endpoint ? endpoint->getParent() : endpointOrWorker);
+
+  std::vector<std::shared_ptr<Request>> requests;
+  requests.reserve(buffers.size());
+  for (size_t i = 0; i < buffers.size(); ++i)
+    requests.push_back(allocateRequest<RequestTag>(worker,
+                                                   endpointOrWorker,
+                                                   send,
+                                                   buffers[i],
+                                                   lengths[i],
+                                                   tags[i],
+                                                   TagMaskFull,
+                                                   enablePythonFuture));
+
+  return requests;
 }
 
 RequestTag::RequestTag(std::shared_ptr<Component> endpointOrWorker,
@@ -38,35 +80,46 @@ RequestTag::RequestTag(std::shared_ptr<Component> endpointOrWorker,
                        void* buffer,
                        size_t length,
                        ucp_tag_t tag,
+                       const TagMask tagMask,
                        const bool enablePythonFuture,
                        std::function<void(std::shared_ptr<void>)> callbackFunction,
-                       std::shared_ptr<void> callbackData)
+                       std::shared_ptr<void> callbackData,
+                       const bool allowShorterMessage)
   : Request(endpointOrWorker,
-            std::make_shared<DelayedSubmission>(send, buffer, length, tag),
-            std::string(send ? "tagSend" : "tagRecv"),
+            DelayedSubmission(send, buffer, length, tag),
+            send ? "tagSend" : "tagRecv",
             enablePythonFuture),
-    _length(length)
+    _length(length),
+    _allowShorterMessage(allowShorterMessage),
+    _tagMask(tagMask)
 {
   if (send && _endpoint == nullptr)
     throw ucxx::Error("An endpoint is required to send tag messages");
   _callback     = callbackFunction;
   _callbackData = callbackData;
+}
+
+ucs_status_t RequestTag::verifyReceivedLength(const size_t length)
+{
+  if (length == _length || (_allowShorterMessage && length < _length)) {
+    _receivedLength = length;
+    return UCS_OK;
+  }
 
-  // A delayed notification request is not populated immediately, instead it is
-  // delayed to allow the worker progress thread to set its status, and more
-  // importantly the Python future later on, so that we don't need the GIL here.
-  _worker->registerDelayedSubmission(
-    std::bind(std::mem_fn(&Request::populateDelayedSubmission), this));
+  const char* fmt = _allowShorterMessage ? "length mismatch: %llu (got) > %llu (expected)"
+                                         : "length mismatch: %llu (got) != %llu (expected)";
+  size_t len      = std::snprintf(nullptr, 0, fmt, length, _length);
+  _status_msg     = std::string(len + 1, '\0');  // +1 for null terminator
+  std::snprintf(_status_msg.data(), _status_msg.size(), fmt, length, _length);
+  return UCS_ERR_MESSAGE_TRUNCATED;
 }
 
 void RequestTag::callback(void* request, ucs_status_t status, const ucp_tag_recv_info_t* info)
 {
-  if (status != UCS_ERR_CANCELED && info->length != _length) {
-    status          = UCS_ERR_MESSAGE_TRUNCATED;
-    const char* fmt = "length mismatch: %llu (got) != %llu (expected)";
-    size_t len      = std::snprintf(nullptr, 0, fmt, info->length, _length);
-    _status_msg     = std::string(len + 1, '\0');  // +1 for null terminator
-    std::snprintf(_status_msg.data(), _status_msg.size(), fmt, info->length, _length);
+  if (status != UCS_ERR_CANCELED) {
+    _senderTag        = info->sender_tag;
+    auto lengthStatus = verifyReceivedLength(info->length);
+    if (lengthStatus != UCS_OK) status = lengthStatus;
   }
 
   _status = status;
@@ -93,29 +146,40 @@ void RequestTag::tagRecvCallback(void* request,
 
 void RequestTag::request()
 {
-  static const ucp_tag_t tagMask = -1;
-
   ucp_request_param_t param = {.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |
                                                UCP_OP_ATTR_FIELD_DATATYPE |
                                                UCP_OP_ATTR_FIELD_USER_DATA,
                                .datatype  = ucp_dt_make_contig(1),
                                .user_data = this};
 
-  if (_delayedSubmission->_send) {
+  setUserRequestMemory(param);
+
+  if (_delayedSubmission._send) {
     param.cb.send = tagSendCallback;
     _request      = ucp_tag_send_nbx(_endpoint->getHandle(),
-                                _delayedSubmission->_buffer,
-                                _delayedSubmission->_length,
-                                _delayedSubmission->_tag,
+                                _delayedSubmission._buffer,
+                                _delayedSubmission._length,
+                                _delayedSubmission._tag,
                                 &param);
   } else {
-    param.cb.recv = tagRecvCallback;
-    _request      = ucp_tag_recv_nbx(_worker->getHandle(),
-                                _delayedSubmission->_buffer,
-                                _delayedSubmission->_length,
-                                _delayedSubmission->_tag,
-                                tagMask,
+    ucp_tag_recv_info_t info;
+    param.op_attr_mask |= UCP_OP_ATTR_FIELD_RECV_INFO;
+    param.cb.recv            = tagRecvCallback;
+    param.recv_info.tag_info = &info;
+    _request                 = ucp_tag_recv_nbx(_worker->getHandle(),
+                                _delayedSubmission._buffer,
+                                _delayedSubmission._length,
+                                _delayedSubmission._tag,
+                                _tagMask,
                                 &param);
+
+    // The callback is not called if the message was received immediately, in which case
+    // UCX fills `info` instead and the length must be verified here.
+    if (_request == nullptr) {
+      _senderTag  = info.sender_tag;
+      auto status = verifyReceivedLength(info.length);
+      if (status != UCS_OK) _status = status;
+    }
   }
 }
 
@@ -125,25 +189,34 @@ void RequestTag::populateDelayedSubmission()
 
   if (_enablePythonFuture)
     ucxx_trace_req_f(
-      _ownerString.c_str(),
+      getOwnerString().c_str(),
       _request,
-      _operationName.c_str(),
+      _operationName,
       "tag 0x%lx, buffer %p, size %lu, future %p, future handle %p, populateDelayedSubmission",
-      _delayedSubmission->_tag,
-      _delayedSubmission->_buffer,
-      _delayedSubmission->_length,
+      _delayedSubmission._tag,
+      _delayedSubmission._buffer,
+      _delayedSubmission._length,
       _future.get(),
       _future->getHandle());
   else
-    ucxx_trace_req_f(_ownerString.c_str(),
+    ucxx_trace_req_f(getOwnerString().c_str(),
                      _request,
-                     _operationName.c_str(),
+                     _operationName,
                      "tag 0x%lx, buffer %p, size %lu, populateDelayedSubmission",
-                     _delayedSubmission->_tag,
-                     _delayedSubmission->_buffer,
-                     _delayedSubmission->_length);
+                     _delayedSubmission._tag,
+                     _delayedSubmission._buffer,
+                     _delayedSubmission._length);
 
   process();
 }
 
+size_t RequestTag::getReceivedLength() const
+{
+  return _delayedSubmission._send ? _length : _receivedLength;
+}
+
+size_t RequestTag::getTransferredLength() const { return getReceivedLength(); }
+
+ucp_tag_t RequestTag::getSenderTag() const { return _senderTag; }
+
 }  // namespace ucxx
@@ -0,0 +1,153 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <mutex>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/buffer.h>
+#include <ucxx/delayed_submission.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/request_tag_any_size.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+std::shared_ptr<RequestTagAnySize> createRequestTagAnySize(
+  std::shared_ptr<Component> endpointOrWorker,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData,
+  BufferAllocatorType allocator)
+{
+  auto endpoint = std::dynamic_pointer_cast<Endpoint>(endpointOrWorker);
+  auto worker   = Endpoint::getWorker(endpoint ? endpoint->getParent() : endpointOrWorker);
+
+  auto request = allocateRequest<RequestTagAnySize>(
+    worker, endpointOrWorker, tag, enablePythonFuture, callbackFunction, callbackData, allocator);
+
+  // Submission is registered once the object is owned by a `std::shared_ptr`, which is
+  // required to register the request with the worker if the message has not arrived yet.
+  request->_worker->registerDelayedSubmission(
+    [request]() { request->populateDelayedSubmission(); });
+
+  return request;
+}
+
+RequestTagAnySize::RequestTagAnySize(std::shared_ptr<Component> endpointOrWorker,
+                                     ucp_tag_t tag,
+                                     const bool enablePythonFuture,
+                                     std::function<void(std::shared_ptr<void>)> callbackFunction,
+                                     std::shared_ptr<void> callbackData,
+                                     BufferAllocatorType allocator)
+  : Request(endpointOrWorker,
+            DelayedSubmission(false, nullptr, 0, tag),
+            "tagRecvAnySize",
+            enablePythonFuture),
+    _allocator(allocator)
+{
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+
+  if (_allocator == nullptr) {
+    auto worker = _worker;
+    _allocator  = [worker](const size_t length) {
+      return std::shared_ptr<Buffer>(
+        allocateBuffer(BufferType::Host, length, worker->getNumaNode()));
+    };
+  }
+}
+
+void RequestTagAnySize::populateDelayedSubmission()
+{
+  ucxx_trace_req_f(getOwnerString().c_str(),
+                   _request,
+                   _operationName,
+                   "tag 0x%lx, registering probe",
+                   _delayedSubmission._tag);
+  _worker->registerTagProbe(std::dynamic_pointer_cast<RequestTagAnySize>(shared_from_this()));
+}
+
+bool RequestTagAnySize::tryRecv()
+{
+  static const ucp_tag_t tagMask = -1;
+
+  {
+    std::lock_guard<std::mutex> lock(_probeMutex);
+    if (_probeState != ProbeState::Pending) return true;
+
+    ucp_tag_recv_info_t info;
+    auto message =
+      ucp_tag_probe_nb(_worker->getHandle(), _delayedSubmission._tag, tagMask, 1, &info);
+    if (message == nullptr) return false;
+
+    // The message was removed from UCX's unexpected messages and must be received now.
+    _buffer                    = _allocator(info.length);
+    _delayedSubmission._buffer = _buffer->data();
+    _delayedSubmission._length = info.length;
+
+    ucp_request_param_t param = {.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |
+                                                 UCP_OP_ATTR_FIELD_DATATYPE |
+                                                 UCP_OP_ATTR_FIELD_USER_DATA,
+                                 .datatype  = ucp_dt_make_contig(1),
+                                 .user_data = this};
+    param.cb.recv = tagRecvCallback;
+
+    setUserRequestMemory(param);
+
+    _request    = ucp_tag_msg_recv_nbx(_worker->getHandle(),
+                                    _delayedSubmission._buffer,
+                                    _delayedSubmission._length,
+                                    message,
+                                    &param);
+    _probeState = ProbeState::Posted;
+  }
+
+  ucxx_trace_req_f(getOwnerString().c_str(),
+                   _request,
+                   _operationName,
+                   "tag 0x%lx, buffer %p, size %lu, tryRecv",
+                   _delayedSubmission._tag,
+                   _delayedSubmission._buffer,
+                   _delayedSubmission._length);
+
+  process();
+  return true;
+}
+
+void RequestTagAnySize::cancel()
+{
+  {
+    std::lock_guard<std::mutex> lock(_probeMutex);
+    if (_probeState == ProbeState::Posted) {
+      Request::cancel();
+      return;
+    }
+    if (_probeState == ProbeState::Canceled) return;
+    _probeState = ProbeState::Canceled;
+  }
+
+  // The message was not probed yet, thus there is no UCP request to cancel.
+  ucxx_trace_req_f(getOwnerString().c_str(), _request, _operationName, "canceling before probe");
+  setStatus(UCS_ERR_CANCELED);
+  if (_callback) _callback(_callbackData);
+}
+
+void RequestTagAnySize::tagRecvCallback(void* request,
+                                        ucs_status_t status,
+                                        const ucp_tag_recv_info_t* info,
+                                        void* arg)
+{
+  RequestTagAnySize* req = reinterpret_cast<RequestTagAnySize*>(arg);
+  ucxx_trace_req_f(req->getOwnerString().c_str(), request, "tagRecvAnySize", "tagRecvCallback");
+  return req->callback(request, status);
+}
+
+std::shared_ptr<Buffer> RequestTagAnySize::getRecvBuffer() { return _buffer; }
+
+size_t RequestTagAnySize::getReceivedLength() const { return _delayedSubmission._length; }
+
+}  // namespace ucxx
@@ -21,8 +21,14 @@ namespace ucxx {
 
 RequestTagMulti::RequestTagMulti(std::shared_ptr<Endpoint> endpoint,
                                  const ucp_tag_t tag,
-                                 const bool enablePythonFuture)
-  : _endpoint(endpoint), _send(false), _tag(tag)
+                                 const bool enablePythonFuture,
+                                 std::function<void(std::shared_ptr<void>)> callbackFunction,
+                                 std::shared_ptr<void> callbackData)
+  : _endpoint(endpoint),
+    _send(false),
+    _tag(tag),
+    _callback(callbackFunction),
+    _callbackData(callbackData)
 {
   ucxx_trace_req("RequestTagMulti::RequestTagMulti [recv]: %p, tag: %lx", this, _tag);
 
@@ -84,13 +90,16 @@ std::shared_ptr<RequestTagMulti> createRequestTagMultiSend(std::shared_ptr<Endpo
     new RequestTagMulti(endpoint, buffer, size, isCUDA, tag, enablePythonFuture));
 }
 
-std::shared_ptr<RequestTagMulti> createRequestTagMultiRecv(std::shared_ptr<Endpoint> endpoint,
-                                                           const ucp_tag_t tag,
-                                                           const bool enablePythonFuture)
+std::shared_ptr<RequestTagMulti> createRequestTagMultiRecv(
+  std::shared_ptr<Endpoint> endpoint,
+  const ucp_tag_t tag,
+  const bool enablePythonFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
 {
   ucxx_trace_req("RequestTagMulti::tagMultiRecv");
-  auto ret =
-    std::shared_ptr<RequestTagMulti>(new RequestTagMulti(endpoint, tag, enablePythonFuture));
+  auto ret = std::shared_ptr<RequestTagMulti>(
+    new RequestTagMulti(endpoint, tag, enablePythonFuture, callbackFunction, callbackData));
   return ret;
 }
 
@@ -114,13 +123,15 @@ void RequestTagMulti::recvFrames()
     headers.push_back(Header(*br->stringBuffer));
   }
 
+  const auto numaNode = Endpoint::getWorker(_endpoint->getParent())->getNumaNode();
+
   for (auto& h : headers) {
     _totalFrames += h.nframes;
     for (size_t i = 0; i < h.nframes; ++i) {
       auto bufferRequest = std::make_shared<BufferRequest>();
       _bufferRequests.push_back(bufferRequest);
       const auto bufferType  = h.isCUDA[i] ? ucxx::BufferType::RMM : ucxx::BufferType::Host;
-      auto buf               = allocateBuffer(bufferType, h.size[i]);
+      auto buf               = allocateBuffer(bufferType, h.size[i], numaNode);
       bufferRequest->request = _endpoint->tagRecv(
         buf->data(),
         buf->getSize(),
@@ -147,25 +158,33 @@ void RequestTagMulti::recvFrames()
 void RequestTagMulti::markCompleted(std::shared_ptr<void> request)
 {
   ucxx_trace_req("RequestTagMulti::markCompleted request: %p, tag: %lx", this, _tag);
-  std::lock_guard<std::mutex> lock(_completedRequestsMutex);
-
-  /* TODO: Move away from std::shared_ptr<void> to avoid casting void* to
-   * BufferRequest*, or remove pointer holding entirely here since it
-   * is not currently used for anything besides counting completed transfers.
-   */
-  _completedRequests.push_back(reinterpret_cast<BufferRequest*>(request.get()));
-
-  if (_completedRequests.size() == _totalFrames) {
-    // TODO: Actually handle errors
-    _status = UCS_OK;
-    if (_future) _future->notify(UCS_OK);
+  bool completed = false;
+  {
+    std::lock_guard<std::mutex> lock(_completedRequestsMutex);
+
+    /* TODO: Move away from std::shared_ptr<void> to avoid casting void* to
+     * BufferRequest*, or remove pointer holding entirely here since it
+     * is not currently used for anything besides counting completed transfers.
+     */
+    _completedRequests.push_back(reinterpret_cast<BufferRequest*>(request.get()));
+
+    if (_completedRequests.size() == _totalFrames) {
+      // TODO: Actually handle errors
+      _status = UCS_OK;
+      if (_future) _future->notify(UCS_OK);
+      completed = true;
+    }
+
+    ucxx_trace_req("RequestTagMulti::markCompleted request: %p, tag: %lx, completed: %lu/%lu",
+                   this,
+                   _tag,
+                   _completedRequests.size(),
+                   _totalFrames);
   }
 
-  ucxx_trace_req("RequestTagMulti::markCompleted request: %p, tag: %lx, completed: %lu/%lu",
-                 this,
-                 _tag,
-                 _completedRequests.size(),
-                 _totalFrames);
+  // Only receive requests register a user-defined callback, called without holding the lock
+  // since it may release the last external reference to this object.
+  if (completed && _callback) _callback(_callbackData);
 }
 
 void RequestTagMulti::recvHeader()
@@ -226,6 +245,7 @@ void RequestTagMulti::callback()
 
       _status = status;
       if (_future) _future->notify(status);
+      if (_callback) _callback(_callbackData);
 
       return;
     }
@@ -0,0 +1,110 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+#include <ucxx/utils/affinity.h>
+
+// Constants from `<numaif.h>`, defined here to avoid a dependency on libnuma.
+#define UCXX_MPOL_PREFERRED 1
+#define UCXX_MPOL_MF_MOVE   (1 << 1)
+
+namespace ucxx {
+
+namespace utils {
+
+void setThreadCpuAffinity(const std::vector<size_t>& cpus)
+{
+  if (cpus.empty()) throw std::invalid_argument("CPU affinity requires at least one CPU");
+
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  for (const auto cpu : cpus) {
+    if (cpu >= CPU_SETSIZE) throw std::invalid_argument("Invalid CPU " + std::to_string(cpu));
+    CPU_SET(cpu, &cpuSet);
+  }
+
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+  if (err != 0)
+    throw ucxx::Error(std::string("pthread_setaffinity_np() failed: ") + strerror(err));
+
+  ucxx_debug("Thread %lu CPU affinity set to %lu CPUs", pthread_self(), cpus.size());
+}
+
+int getCpuNumaNode(const size_t cpu)
+{
+  // The NUMA node is listed in sysfs as a `nodeN` entry of the CPU directory
+  const auto path = std::string("/sys/devices/system/cpu/cpu") + std::to_string(cpu);
+  DIR* dir        = opendir(path.c_str());
+  if (dir == nullptr) return -1;
+
+  int numaNode = -1;
+  while (dirent* entry = readdir(dir)) {
+    if (strncmp(entry->d_name, "node", 4) == 0 && isdigit(entry->d_name[4])) {
+      numaNode = atoi(entry->d_name + 4);
+      break;
+    }
+  }
+  closedir(dir);
+
+  return numaNode;
+}
+
+int getCurrentNumaNode()
+{
+  int cpu = sched_getcpu();
+  if (cpu < 0) return -1;
+  return getCpuNumaNode(cpu);
+}
+
+bool bindMemoryToNumaNode(void* ptr, const size_t size, const int numaNode, const bool move)
+{
+  if (ptr == nullptr || numaNode < 0) return false;
+
+  constexpr size_t bitsPerMask = sizeof(unsigned long) * 8;
+  if (static_cast<size_t>(numaNode) >= bitsPerMask) {
+    ucxx_debug("NUMA node %d not supported for memory binding", numaNode);
+    return false;
+  }
+
+  // Only whole pages can be bound, shrink range to page boundaries
+  const uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+  const uintptr_t begin    = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) & ~(pageSize - 1);
+  const uintptr_t end      = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(pageSize - 1);
+  if (begin >= end) return false;
+
+  unsigned long nodeMask = 1UL << numaNode;
+
+  if (syscall(SYS_mbind,
+              reinterpret_cast<void*>(begin),
+              end - begin,
+              UCXX_MPOL_PREFERRED,
+              &nodeMask,
+              bitsPerMask,
+              move ? UCXX_MPOL_MF_MOVE : 0) != 0) {
+    ucxx_debug("mbind() to NUMA node %d failed: %s", numaNode, strerror(errno));
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace utils
+
+}  // namespace ucxx
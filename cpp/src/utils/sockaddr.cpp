@@ -27,6 +27,26 @@ int sockaddr_set(ucs_sock_addr_t* sockaddr, const char* ip_address, uint16_t por
   return 0;
 }
 
+int sockaddr_set(ucs_sock_addr_t* sockaddr,
+                 const struct sockaddr_storage* address,
+                 socklen_t length,
+                 uint16_t port)
+{
+  if (address->ss_family != AF_INET && address->ss_family != AF_INET6) { return 1; }
+  struct sockaddr_storage* addr =
+    reinterpret_cast<sockaddr_storage*>(malloc(sizeof(struct sockaddr_storage)));
+  if (addr == NULL) { return 1; }
+  memset(addr, 0, sizeof(struct sockaddr_storage));
+  memcpy(addr, address, length);
+  if (addr->ss_family == AF_INET)
+    reinterpret_cast<struct sockaddr_in*>(addr)->sin_port = htons(port);
+  else
+    reinterpret_cast<struct sockaddr_in6*>(addr)->sin6_port = htons(port);
+  sockaddr->addr    = (const struct sockaddr*)addr;
+  sockaddr->addrlen = length;
+  return 0;
+}
+
 void sockaddr_free(ucs_sock_addr_t* sockaddr)
 {
   ::free(const_cast<void*>(reinterpret_cast<const void*>(sockaddr->addr)));
@@ -2,12 +2,16 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <ios>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -15,14 +19,26 @@
 #include <sys/eventfd.h>
 #include <unistd.h>
 
+#include <ucxx/endpoint.h>
+#include <ucxx/endpoint_pool.h>
+#include <ucxx/native_future.h>
+#include <ucxx/native_notifier.h>
+#include <ucxx/request_am.h>
+#include <ucxx/request_endpoint_close.h>
+#include <ucxx/request_endpoint_create.h>
 #include <ucxx/request_tag.h>
+#include <ucxx/request_tag_any_size.h>
+#include <ucxx/utils/affinity.h>
 #include <ucxx/utils/file_descriptor.h>
 #include <ucxx/utils/ucx.h>
 #include <ucxx/worker.h>
 
 namespace ucxx {
 
-Worker::Worker(std::shared_ptr<Context> context, const bool enableDelayedSubmission)
+Worker::Worker(std::shared_ptr<Context> context,
+               const bool enableDelayedSubmission,
+               const bool enableFuture)
+  : _enableFuture(enableFuture)
 {
   ucp_worker_params_t params{};
 
@@ -33,9 +49,13 @@ Worker::Worker(std::shared_ptr<Context> context, const bool enableDelayedSubmiss
   params.thread_mode = UCS_THREAD_MODE_MULTI;
   utils::ucsErrorThrow(ucp_worker_create(context->getHandle(), &params, &_handle));
 
+  _requestSize = context->getRequestSize();
+
   if (enableDelayedSubmission)
     _delayedSubmissionCollection = std::make_shared<DelayedSubmissionCollection>();
 
+  if (_enableFuture) _notifier = createNativeNotifier();
+
   ucxx_trace("Worker created: %p, enableDelayedSubmission: %d, enableFuture: %d",
              this,
              enableDelayedSubmission,
@@ -84,9 +104,10 @@ void Worker::drainWorkerTagRecv()
 }
 
 std::shared_ptr<Worker> createWorker(std::shared_ptr<Context> context,
-                                     const bool enableDelayedSubmission)
+                                     const bool enableDelayedSubmission,
+                                     const bool enableFuture)
 {
-  return std::shared_ptr<Worker>(new Worker(context, enableDelayedSubmission));
+  return std::shared_ptr<Worker>(new Worker(context, enableDelayedSubmission, enableFuture));
 }
 
 Worker::~Worker()
@@ -116,6 +137,8 @@ std::string Worker::getInfo()
 
 bool Worker::isFutureEnabled() const { return _enableFuture; }
 
+bool Worker::isDelayedSubmissionEnabled() const { return _delayedSubmissionCollection != nullptr; }
+
 void Worker::initBlockingProgressMode()
 {
   // In blocking progress mode, we create an epoll file
@@ -151,6 +174,8 @@ bool Worker::arm()
   return true;
 }
 
+int Worker::getEpollFileDescriptor() const { return _epollFileDescriptor; }
+
 bool Worker::progressWorkerEvent()
 {
   int ret;
@@ -160,20 +185,62 @@ bool Worker::progressWorkerEvent()
 
   if (progress()) return true;
 
-  if ((_epollFileDescriptor == -1) || !arm()) return false;
+  if ((_epollFileDescriptor == -1) || !prepareToSleep()) return false;
+
+  if (!arm()) {
+    markAwake();
+    return false;
+  }
 
   do {
     ret = epoll_wait(_epollFileDescriptor, &ev, 1, -1);
   } while ((ret == -1) && (errno == EINTR || errno == EAGAIN));
 
+  markAwake();
   return false;
 }
 
 void Worker::signal() { utils::ucsErrorThrow(ucp_worker_signal(_handle)); }
 
+bool Worker::prepareToSleep()
+{
+  _wakeupState.store(WakeupState::Sleeping);
+
+  // Pairs with the fence in `signalIfSleeping()`: either the producer observes the
+  // sleeping state and signals, or the pending submission is observed here.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (_delayedSubmissionCollection != nullptr && !_delayedSubmissionCollection->isEmpty()) {
+    markAwake();
+    return false;
+  }
+
+  return true;
+}
+
+void Worker::markAwake() { _wakeupState.store(WakeupState::Awake); }
+
+void Worker::signalIfSleeping()
+{
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  auto expected = WakeupState::Sleeping;
+  if (_wakeupState.compare_exchange_strong(expected, WakeupState::Signaled)) {
+    _signalsIssued.fetch_add(1, std::memory_order_relaxed);
+    signal();
+  } else {
+    _signalsSuppressed.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+uint64_t Worker::getSignalsIssued() const { return _signalsIssued.load(); }
+
+uint64_t Worker::getSignalsSuppressed() const { return _signalsSuppressed.load(); }
+
 bool Worker::waitProgress()
 {
-  utils::ucsErrorThrow(ucp_worker_wait(_handle));
+  if (prepareToSleep()) utils::ucsErrorThrow(ucp_worker_wait(_handle));
+  markAwake();
   return progress();
 }
 
@@ -193,8 +260,14 @@ bool Worker::progress()
 {
   bool ret = progressPending();
 
+  // Receives of unknown size can only be posted once their messages have arrived.
+  if (_tagProbesSize > 0 && progressTagProbes()) {
+    progressPending();
+    ret = true;
+  }
+
   // Before canceling requests scheduled for cancelation, attempt to let them complete.
-  if (_inflightRequestsToCancel > 0) ret |= progressPending();
+  if (_inflightRequestsToCancel->size() > 0) ret |= progressPending();
 
   // Requests that were not completed now must be canceled.
   if (cancelInflightRequests() > 0) ret |= progressPending();
@@ -202,21 +275,180 @@ bool Worker::progress()
   return ret;
 }
 
+bool Worker::progressTagProbes()
+{
+  decltype(_tagProbes) probes;
+  {
+    std::lock_guard<std::mutex> lock(_tagProbesMutex);
+    std::swap(probes, _tagProbes);
+  }
+
+  // `_tagProbesSize` is only decremented after unmatched probes are reinserted, so that
+  // new receives do not bypass older ones while the probes are being attempted.
+  size_t matched = 0;
+  decltype(_tagProbes) unmatched;
+  for (auto& probe : probes) {
+    if (probe->tryRecv())
+      ++matched;
+    else
+      unmatched.push_back(std::move(probe));
+  }
+
+  if (!unmatched.empty()) {
+    std::lock_guard<std::mutex> lock(_tagProbesMutex);
+    unmatched.insert(unmatched.end(), _tagProbes.begin(), _tagProbes.end());
+    std::swap(unmatched, _tagProbes);
+  }
+  _tagProbesSize -= matched;
+
+  return matched > 0;
+}
+
+void Worker::registerTagProbe(std::shared_ptr<RequestTagAnySize> request)
+{
+  {
+    std::lock_guard<std::mutex> lock(_tagProbesMutex);
+    // Older receives must be attempted first to preserve matching order.
+    if (_tagProbesSize > 0) {
+      _tagProbes.push_back(request);
+      ++_tagProbesSize;
+      return;
+    }
+  }
+
+  if (request->tryRecv()) return;
+
+  std::lock_guard<std::mutex> lock(_tagProbesMutex);
+  _tagProbes.push_back(request);
+  ++_tagProbesSize;
+}
+
+void Worker::registerAmHandler(unsigned id,
+                               AmHandlerType handler,
+                               void* handlerArg,
+                               BufferAllocatorType allocator)
+{
+  std::lock_guard<std::mutex> lock(_amHandlersMutex);
+
+  auto& slot = _amHandlers[id];
+  if (slot == nullptr) slot = std::make_unique<AmHandlerSlot>(AmHandlerSlot{this, id, nullptr});
+
+  if (handler == nullptr) {
+    ucp_am_handler_param_t param = {.field_mask = UCP_AM_HANDLER_PARAM_FIELD_ID |
+                                                  UCP_AM_HANDLER_PARAM_FIELD_CB,
+                                    .id         = id,
+                                    .cb         = nullptr};
+    utils::ucsErrorThrow(ucp_worker_set_am_recv_handler(_handle, &param));
+    slot->handler = nullptr;
+    ucxx_trace("Worker %p removed Active Message handler %u", _handle, id);
+    return;
+  }
+
+  if (allocator == nullptr) {
+    auto numaNode = getNumaNode();
+    allocator     = [numaNode](const size_t length) {
+      return std::shared_ptr<Buffer>(allocateBuffer(BufferType::Host, length, numaNode));
+    };
+  }
+  slot->handler = std::make_shared<AmHandler>(AmHandler{handler, handlerArg, allocator});
+
+  ucp_am_handler_param_t param = {.field_mask = UCP_AM_HANDLER_PARAM_FIELD_ID |
+                                                UCP_AM_HANDLER_PARAM_FIELD_FLAGS |
+                                                UCP_AM_HANDLER_PARAM_FIELD_CB |
+                                                UCP_AM_HANDLER_PARAM_FIELD_ARG,
+                                  .id         = id,
+                                  .flags      = UCP_AM_FLAG_WHOLE_MSG,
+                                  .cb         = amRecvCallback,
+                                  .arg        = slot.get()};
+  utils::ucsErrorThrow(ucp_worker_set_am_recv_handler(_handle, &param));
+  ucxx_trace("Worker %p registered Active Message handler %u", _handle, id);
+}
+
+ucs_status_t Worker::amRecvCallback(void* arg,
+                                    const void* header,
+                                    size_t headerLength,
+                                    void* data,
+                                    size_t length,
+                                    const ucp_am_recv_param_t* param)
+{
+  auto slot = reinterpret_cast<AmHandlerSlot*>(arg);
+  auto self = slot->worker;
+
+  std::shared_ptr<AmHandler> amHandler;
+  {
+    std::lock_guard<std::mutex> lock(self->_amHandlersMutex);
+    amHandler = slot->handler;
+  }
+
+  std::string amHeader(reinterpret_cast<const char*>(header), headerLength);
+  const bool rndv = param->recv_attr & UCP_AM_RECV_ATTR_FLAG_RNDV;
+
+  if (amHandler == nullptr) {
+    ucxx_debug("Worker %p discarding Active Message %u without a handler", self->_handle, slot->id);
+    if (rndv) ucp_am_data_release(self->_handle, data);
+    return UCS_OK;
+  }
+
+  if (!rndv) {
+    // Eager data is only valid until this callback returns, the handler must copy it.
+    AmMessage message{slot->id, UCS_OK, std::move(amHeader), data, length, nullptr};
+    try {
+      amHandler->handler(message, amHandler->handlerArg);
+    } catch (const std::exception& e) {
+      ucxx_error("Active Message handler for id %u raised an exception: %s", slot->id, e.what());
+    }
+    return UCS_OK;
+  }
+
+  // The worker may be in destruction, in which case it can't own new requests.
+  auto worker = std::dynamic_pointer_cast<Worker>(self->weak_from_this().lock());
+  std::shared_ptr<Buffer> buffer{nullptr};
+  if (worker != nullptr) {
+    try {
+      buffer = amHandler->allocator(length);
+    } catch (const std::exception& e) {
+      ucxx_error("Active Message %u failed to allocate %lu bytes: %s", slot->id, length, e.what());
+    }
+  }
+  if (buffer == nullptr) {
+    ucp_am_data_release(self->_handle, data);
+    return UCS_OK;
+  }
+
+  auto request = createRequestAmRecvData(
+    worker, slot->id, std::move(amHeader), data, buffer, amHandler->handler, amHandler->handlerArg);
+  if (!request->isCompleted()) worker->registerInflightRequest(request);
+
+  return UCS_OK;
+}
+
 void Worker::registerDelayedSubmission(DelayedSubmissionCallbackType callback)
 {
   if (_delayedSubmissionCollection == nullptr) {
     callback();
   } else {
-    _delayedSubmissionCollection->registerRequest(callback);
+    _delayedSubmissionCollection->registerRequest(std::move(callback));
 
     /* Waking the progress event is needed here because the UCX request is
      * not dispatched immediately. Thus we must signal the progress task so
-     * it will ensure the request is dispatched.
+     * it will ensure the request is dispatched, unless it is already awake.
      */
-    signal();
+    signalIfSleeping();
   }
 }
 
+void Worker::registerDelayedSubmissionBatch(std::vector<std::shared_ptr<Request>> requests)
+{
+  if (requests.empty()) return;
+
+  // The batch is shared so that the callback remains small enough to be stored inline.
+  auto batch = std::make_shared<std::vector<std::shared_ptr<Request>>>(std::move(requests));
+  registerDelayedSubmission([batch]() {
+    for (auto& request : *batch)
+      request->populateDelayedSubmission();
+  });
+}
+
 #define THROW_FUTURE_NOT_IMPLEMENTED()                                                      \
   do {                                                                                      \
     throw std::runtime_error(                                                               \
@@ -225,18 +457,54 @@ void Worker::registerDelayedSubmission(DelayedSubmissionCallbackType callback)
       "the Worker to use this method.");                                                    \
   } while (0)
 
-void Worker::populateFuturesPool() { THROW_FUTURE_NOT_IMPLEMENTED(); }
+void Worker::populateFuturesPool()
+{
+  if (!_enableFuture) THROW_FUTURE_NOT_IMPLEMENTED();
+
+  // If the pool goes under half expected size, fill it up again.
+  std::lock_guard<std::mutex> lock(_futuresPoolMutex);
+  if (_futuresPool.size() < 50) {
+    while (_futuresPool.size() < 100)
+      _futuresPool.emplace(createNativeFuture(_notifier));
+  }
+}
 
-std::shared_ptr<Future> Worker::getFuture() { THROW_FUTURE_NOT_IMPLEMENTED(); }
+std::shared_ptr<Future> Worker::getFuture()
+{
+  if (!_enableFuture) THROW_FUTURE_NOT_IMPLEMENTED();
+
+  // Native futures are cheap to create, thus there's no need to warn if the pool is empty.
+  std::lock_guard<std::mutex> lock(_futuresPoolMutex);
+  if (_futuresPool.empty()) return createNativeFuture(_notifier);
+
+  auto future = _futuresPool.front();
+  _futuresPool.pop();
+  return future;
+}
 
 RequestNotifierWaitState Worker::waitRequestNotifier(uint64_t periodNs)
 {
-  THROW_FUTURE_NOT_IMPLEMENTED();
+  if (!_enableFuture) THROW_FUTURE_NOT_IMPLEMENTED();
+  return _notifier->waitRequestNotifier(periodNs);
 }
 
-void Worker::runRequestNotifier() { THROW_FUTURE_NOT_IMPLEMENTED(); }
+void Worker::runRequestNotifier()
+{
+  if (!_enableFuture) THROW_FUTURE_NOT_IMPLEMENTED();
+  _notifier->runRequestNotifier();
+}
 
-void Worker::stopRequestNotifierThread() { THROW_FUTURE_NOT_IMPLEMENTED(); }
+void Worker::stopRequestNotifierThread()
+{
+  if (!_enableFuture) THROW_FUTURE_NOT_IMPLEMENTED();
+  _notifier->stopRequestNotifierThread();
+}
+
+int Worker::getRequestNotifierFileDescriptor()
+{
+  if (!_enableFuture) THROW_FUTURE_NOT_IMPLEMENTED();
+  return _notifier->getEventFileDescriptor();
+}
 
 void Worker::setProgressThreadStartCallback(std::function<void(void*)> callback, void* callbackArg)
 {
@@ -244,7 +512,21 @@ void Worker::setProgressThreadStartCallback(std::function<void(void*)> callback,
   _progressThreadStartCallbackArg = callbackArg;
 }
 
-void Worker::startProgressThread(const bool pollingMode)
+void Worker::setNumaPlacement(const std::vector<size_t>& cpuAffinity)
+{
+  if (cpuAffinity.empty()) {
+    _numaNode = -1;
+    return;
+  }
+
+  const int numaNode = utils::getCpuNumaNode(cpuAffinity.front());
+  _numaNode.store(numaNode);
+  ucxx_debug("Worker %p placed on NUMA node %d", this, numaNode);
+
+  if (_delayedSubmissionCollection) _delayedSubmissionCollection->bindToNumaNode(numaNode);
+}
+
+void Worker::startProgressThread(const bool pollingMode, const std::vector<size_t>& cpuAffinity)
 {
   if (_progressThread) {
     ucxx_warn("Worker progress thread already running");
@@ -262,10 +544,44 @@ void Worker::startProgressThread(const bool pollingMode)
                                                            signalWorkerFunction,
                                                            _progressThreadStartCallback,
                                                            _progressThreadStartCallbackArg,
-                                                           _delayedSubmissionCollection);
+                                                           _delayedSubmissionCollection,
+                                                           cpuAffinity);
+
+  // Only placed once the thread was pinned successfully, construction throws otherwise.
+  setNumaPlacement(cpuAffinity);
+}
+
+void Worker::startAdaptiveProgressThread(const AdaptiveProgressConfig& config,
+                                         const std::vector<size_t>& cpuAffinity)
+{
+  if (_progressThread) {
+    ucxx_warn("Worker progress thread already running");
+    return;
+  }
+
+  initBlockingProgressMode();
+  auto adaptiveProgress = std::make_shared<AdaptiveProgress>(
+    config, std::bind(&Worker::progress, this), std::bind(&Worker::progressWorkerEvent, this));
+  auto progressFunction     = [adaptiveProgress]() { return adaptiveProgress->progress(); };
+  auto signalWorkerFunction = std::bind(&Worker::signal, this);
+
+  _progressThread = std::make_shared<WorkerProgressThread>(false,
+                                                           progressFunction,
+                                                           signalWorkerFunction,
+                                                           _progressThreadStartCallback,
+                                                           _progressThreadStartCallbackArg,
+                                                           _delayedSubmissionCollection,
+                                                           cpuAffinity);
+
+  // Only placed once the thread was pinned successfully, construction throws otherwise.
+  setNumaPlacement(cpuAffinity);
 }
 
-void Worker::stopProgressThreadNoWarn() { _progressThread = nullptr; }
+void Worker::stopProgressThreadNoWarn()
+{
+  _progressThread = nullptr;
+  _numaNode       = -1;
+}
 
 void Worker::stopProgressThread()
 {
@@ -275,46 +591,100 @@ void Worker::stopProgressThread()
     stopProgressThreadNoWarn();
 }
 
-size_t Worker::cancelInflightRequests()
+bool Worker::isProgressThreadRunning() const { return _progressThread != nullptr; }
+
+bool Worker::isOnProgressThread() const
 {
-  auto inflightRequestsToCancel = std::make_shared<InflightRequests>();
-  {
-    std::lock_guard<std::mutex> lock(_inflightRequestsMutex);
-    std::swap(_inflightRequestsToCancel, inflightRequestsToCancel);
-  }
-  return inflightRequestsToCancel->cancelAll();
+  auto progressThread = _progressThread;
+  return progressThread != nullptr && progressThread->getId() == std::this_thread::get_id();
+}
+
+int Worker::getNumaNode() const { return _numaNode.load(); }
+
+std::shared_ptr<RequestPool> Worker::getRequestPool() const { return _requestPool; }
+
+void Worker::setHostnameResolver(std::shared_ptr<HostnameResolver> resolver)
+{
+  _hostnameResolver = resolver;
+}
+
+std::shared_ptr<HostnameResolver> Worker::getHostnameResolver() const
+{
+  return _hostnameResolver ? _hostnameResolver : HostnameResolver::getDefault();
+}
+
+void Worker::setUserRequestMemory(const bool enable) { _enableUserRequestMemory = enable; }
+
+bool Worker::isUserRequestMemoryEnabled() const { return _enableUserRequestMemory; }
+
+size_t Worker::getRequestSize() const { return _requestSize; }
+
+void Worker::enableCompletionQueue(const size_t capacity)
+{
+  if (_completionQueue.load(std::memory_order_acquire) != nullptr) return;
+
+  // The progress thread may read the queue concurrently, it is published atomically and
+  // only the first of concurrent callers gets to own it.
+  auto queue                = std::make_unique<CompletionQueue>(capacity);
+  CompletionQueue* expected = nullptr;
+  if (_completionQueue.compare_exchange_strong(expected, queue.get(), std::memory_order_acq_rel))
+    _completionQueueOwner = std::move(queue);
 }
 
+bool Worker::isCompletionQueueEnabled() const
+{
+  return _completionQueue.load(std::memory_order_acquire) != nullptr;
+}
+
+void Worker::pushCompletion(const Completion& completion)
+{
+  if (auto queue = _completionQueue.load(std::memory_order_acquire)) queue->push(completion);
+}
+
+size_t Worker::pollCompletions(Completion* completions, const size_t maxCompletions)
+{
+  auto queue = _completionQueue.load(std::memory_order_acquire);
+  if (queue == nullptr) throw std::runtime_error("Completion queue is not enabled");
+  return queue->poll(completions, maxCompletions);
+}
+
+size_t Worker::cancelInflightRequests() { return _inflightRequestsToCancel->cancelAll(); }
+
+size_t Worker::cancelAllInflightRequests()
+{
+  size_t canceled = _inflightRequests->cancelAll();
+  return canceled + cancelInflightRequests();
+}
+
+size_t Worker::getInflightRequestCount() { return _inflightRequests->size(); }
+
 void Worker::scheduleRequestCancel(std::shared_ptr<InflightRequests> inflightRequests)
 {
-  {
-    std::lock_guard<std::mutex> lock(_inflightRequestsMutex);
-    ucxx_debug("Scheduling cancelation of %lu requests", inflightRequests->size());
-    _inflightRequestsToCancel->merge(inflightRequests->release());
-  }
+  ucxx_debug("Scheduling cancelation of %lu requests", inflightRequests->size());
+  _inflightRequestsToCancel->merge(*inflightRequests);
 }
 
 void Worker::registerInflightRequest(std::shared_ptr<Request> request)
 {
-  {
-    std::lock_guard<std::mutex> lock(_inflightRequestsMutex);
-    _inflightRequests->insert(request);
-  }
+  _inflightRequests->insert(request);
+
+  // The request may have completed before it was inserted, in which case its removal
+  // was a no-op and must be repeated to release the reference.
+  if (request->isCompleted()) _inflightRequests->remove(request.get());
 }
 
 void Worker::removeInflightRequest(const Request* const request)
 {
-  {
-    std::lock_guard<std::mutex> lock(_inflightRequestsMutex);
-    _inflightRequests->remove(request);
-  }
+  _inflightRequests->remove(request);
+  _inflightRequestsToCancel->remove(request);
 }
 
-bool Worker::tagProbe(ucp_tag_t tag)
+bool Worker::tagProbe(ucp_tag_t tag, const TagMask tagMask, ucp_tag_t* senderTag)
 {
   ucp_tag_recv_info_t info;
-  ucp_tag_message_h tag_message = ucp_tag_probe_nb(_handle, tag, -1, 0, &info);
+  ucp_tag_message_h tag_message = ucp_tag_probe_nb(_handle, tag, tagMask, 0, &info);
 
+  if (tag_message != NULL && senderTag != nullptr) *senderTag = info.sender_tag;
   return tag_message != NULL;
 }
 
@@ -327,12 +697,112 @@ std::shared_ptr<Request> Worker::tagRecv(
   std::shared_ptr<void> callbackData)
 {
   auto worker  = std::dynamic_pointer_cast<Worker>(shared_from_this());
-  auto request = createRequestTag(
-    worker, false, buffer, length, tag, enableFuture, callbackFunction, callbackData);
+  auto request = createRequestTag(worker,
+                                  false,
+                                  buffer,
+                                  length,
+                                  tag,
+                                  TagMaskFull,
+                                  enableFuture,
+                                  callbackFunction,
+                                  callbackData,
+                                  false);
   registerInflightRequest(request);
   return request;
 }
 
+std::shared_ptr<RequestTag> Worker::tagRecv(
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const TagMask tagMask,
+  const bool enableFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto worker  = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  auto request = createRequestTag(worker,
+                                  false,
+                                  buffer,
+                                  length,
+                                  tag,
+                                  tagMask,
+                                  enableFuture,
+                                  callbackFunction,
+                                  callbackData,
+                                  false);
+  registerInflightRequest(request);
+  return request;
+}
+
+std::shared_ptr<RequestTag> Worker::tagRecvUpTo(
+  void* buffer,
+  size_t maxLength,
+  ucp_tag_t tag,
+  const bool enableFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto worker  = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  auto request = createRequestTag(worker,
+                                  false,
+                                  buffer,
+                                  maxLength,
+                                  tag,
+                                  TagMaskFull,
+                                  enableFuture,
+                                  callbackFunction,
+                                  callbackData,
+                                  true);
+  registerInflightRequest(request);
+  return request;
+}
+
+std::shared_ptr<RequestTagAnySize> Worker::tagRecvAnySize(
+  ucp_tag_t tag,
+  const bool enableFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData,
+  BufferAllocatorType allocator)
+{
+  auto worker  = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  auto request =
+    createRequestTagAnySize(worker, tag, enableFuture, callbackFunction, callbackData, allocator);
+  registerInflightRequest(request);
+  return request;
+}
+
+std::vector<std::shared_ptr<Request>> Worker::tagRecvBatch(const std::vector<void*>& buffers,
+                                                           const std::vector<size_t>& lengths,
+                                                           const std::vector<ucp_tag_t>& tags,
+                                                           const bool enableFuture)
+{
+  auto worker   = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  auto requests = createRequestTagBatch(worker, false, buffers, lengths, tags, enableFuture);
+
+  _inflightRequests->insert(requests);
+  registerDelayedSubmissionBatch(requests);
+  return requests;
+}
+
+std::vector<std::shared_ptr<Request>> Worker::closeEndpoints(
+  const std::vector<std::shared_ptr<Endpoint>>& endpoints,
+  const EndpointCloseMode mode,
+  const bool enableFuture)
+{
+  for (const auto& endpoint : endpoints)
+    if (Endpoint::getWorker(endpoint->getParent()).get() != this)
+      throw ucxx::Error("All endpoints must have been created from this worker");
+
+  auto requests = createRequestEndpointCloseBatch(endpoints, mode, enableFuture);
+
+  // Close requests are not tracked by their endpoints, the worker keeps them alive until
+  // UCX completes them even if the caller releases them.
+  _inflightRequests->insert(requests);
+  registerDelayedSubmissionBatch(requests);
+  return requests;
+}
+
 std::shared_ptr<Address> Worker::getAddress()
 {
   auto worker  = std::dynamic_pointer_cast<Worker>(shared_from_this());
@@ -349,6 +819,19 @@ std::shared_ptr<Endpoint> Worker::createEndpointFromHostname(std::string ipAddre
   return endpoint;
 }
 
+std::shared_ptr<RequestEndpointCreate> Worker::createEndpointFromHostnameAsync(
+  std::string ipAddress,
+  uint16_t port,
+  bool endpointErrorHandling,
+  const bool enableFuture,
+  std::function<void(std::shared_ptr<void>)> callbackFunction,
+  std::shared_ptr<void> callbackData)
+{
+  auto worker = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  return createRequestEndpointCreate(
+    worker, ipAddress, port, endpointErrorHandling, enableFuture, callbackFunction, callbackData);
+}
+
 std::shared_ptr<Endpoint> Worker::createEndpointFromWorkerAddress(std::shared_ptr<Address> address,
                                                                   bool endpointErrorHandling)
 {
@@ -357,6 +840,21 @@ std::shared_ptr<Endpoint> Worker::createEndpointFromWorkerAddress(std::shared_pt
   return endpoint;
 }
 
+std::shared_ptr<Endpoint> Worker::createEndpointFromConnRequest(ucp_conn_request_h connRequest,
+                                                                bool endpointErrorHandling)
+{
+  auto worker   = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  auto endpoint = ucxx::createEndpointFromConnRequest(worker, connRequest, endpointErrorHandling);
+  return endpoint;
+}
+
+std::shared_ptr<EndpointPool> Worker::createEndpointPool(
+  const size_t maxSize, const std::chrono::milliseconds idleTimeout)
+{
+  auto worker = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  return ucxx::createEndpointPool(worker, maxSize, idleTimeout);
+}
+
 std::shared_ptr<Listener> Worker::createListener(uint16_t port,
                                                  ucp_listener_conn_callback_t callback,
                                                  void* callbackArgs)
@@ -0,0 +1,270 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <netinet/in.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <ucxx/address.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/listener.h>
+#include <ucxx/log.h>
+#include <ucxx/utils/sockaddr.h>
+#include <ucxx/utils/ucx.h>
+#include <ucxx/worker_pool.h>
+
+namespace ucxx {
+
+WorkerPool::WorkerPool(std::shared_ptr<Context> context,
+                       const size_t numWorkers,
+                       const bool enableDelayedSubmission,
+                       const WorkerPoolPlacement placement)
+  : _endpoints(numWorkers), _placement(placement)
+{
+  if (numWorkers == 0) throw std::invalid_argument("WorkerPool requires at least one worker");
+
+  _workers.reserve(numWorkers);
+  for (size_t i = 0; i < numWorkers; ++i)
+    _workers.push_back(context->createWorker(enableDelayedSubmission));
+
+  ucxx_trace("WorkerPool created: %p, numWorkers: %lu, enableDelayedSubmission: %d",
+             this,
+             numWorkers,
+             enableDelayedSubmission);
+
+  setParent(context);
+}
+
+std::shared_ptr<WorkerPool> createWorkerPool(std::shared_ptr<Context> context,
+                                             const size_t numWorkers,
+                                             const bool enableDelayedSubmission,
+                                             const WorkerPoolPlacement placement)
+{
+  return std::shared_ptr<WorkerPool>(
+    new WorkerPool(context, numWorkers, enableDelayedSubmission, placement));
+}
+
+WorkerPool::~WorkerPool()
+{
+  shutdown();
+
+  ucxx_trace("WorkerPool destroyed: %p", this);
+}
+
+size_t WorkerPool::size() const { return _workers.size(); }
+
+std::shared_ptr<Worker> WorkerPool::getWorker(const size_t index) const
+{
+  return _workers.at(index);
+}
+
+const std::vector<std::shared_ptr<Worker>>& WorkerPool::getWorkers() const { return _workers; }
+
+WorkerPoolPlacement WorkerPool::getPlacement() const { return _placement; }
+
+void WorkerPool::pruneEndpoints(std::vector<std::weak_ptr<Endpoint>>& endpoints)
+{
+  endpoints.erase(std::remove_if(endpoints.begin(),
+                                 endpoints.end(),
+                                 [](const std::weak_ptr<Endpoint>& ep) { return ep.expired(); }),
+                  endpoints.end());
+}
+
+size_t WorkerPool::getEndpointCount(const size_t index)
+{
+  std::lock_guard<std::mutex> lock(_endpointsMutex);
+  auto& endpoints = _endpoints.at(index);
+  pruneEndpoints(endpoints);
+  return endpoints.size();
+}
+
+size_t WorkerPool::getInflightRequestCount(const size_t index)
+{
+  size_t count = _workers.at(index)->getInflightRequestCount();
+
+  // Count and prune destroyed endpoints in a single pass, so that endpoints accepted and
+  // released under connection churn are not walked again by subsequent selections.
+  std::lock_guard<std::mutex> lock(_endpointsMutex);
+  auto& endpoints = _endpoints[index];
+  endpoints.erase(std::remove_if(endpoints.begin(),
+                                 endpoints.end(),
+                                 [&count](const std::weak_ptr<Endpoint>& ep) {
+                                   auto endpoint = ep.lock();
+                                   if (endpoint == nullptr) return true;
+                                   count += endpoint->getInflightRequestCount();
+                                   return false;
+                                 }),
+                  endpoints.end());
+  return count;
+}
+
+size_t WorkerPool::selectWorkerIndex(const std::string& peerKey)
+{
+  switch (_placement) {
+    case WorkerPoolPlacement::LeastInflight: {
+      size_t selected = 0, selectedCount = getInflightRequestCount(0);
+      for (size_t i = 1; i < _workers.size() && selectedCount > 0; ++i) {
+        auto count = getInflightRequestCount(i);
+        if (count < selectedCount) {
+          selected      = i;
+          selectedCount = count;
+        }
+      }
+      // Break ties between idle workers in round-robin order, otherwise all connections
+      // accepted while idle would land on the first worker.
+      if (selectedCount == 0) {
+        size_t start = _nextWorker++;
+        for (size_t i = 0; i < _workers.size(); ++i) {
+          auto candidate = (start + i) % _workers.size();
+          if (getInflightRequestCount(candidate) == 0) return candidate;
+        }
+      }
+      return selected;
+    }
+    case WorkerPoolPlacement::LeastLoaded: {
+      size_t selected = 0, selectedCount = getEndpointCount(0);
+      for (size_t i = 1; i < _workers.size() && selectedCount > 0; ++i) {
+        auto count = getEndpointCount(i);
+        if (count < selectedCount) {
+          selected      = i;
+          selectedCount = count;
+        }
+      }
+      return selected;
+    }
+    case WorkerPoolPlacement::PeerHash:
+      if (!peerKey.empty()) return std::hash<std::string>{}(peerKey) % _workers.size();
+      // No peer to hash, fallback to round-robin
+      [[fallthrough]];
+    case WorkerPoolPlacement::RoundRobin:
+    default: return _nextWorker++ % _workers.size();
+  }
+}
+
+std::shared_ptr<Worker> WorkerPool::selectWorker(const std::string& peerKey)
+{
+  return _workers[selectWorkerIndex(peerKey)];
+}
+
+void WorkerPool::registerEndpoint(const size_t workerIndex, std::shared_ptr<Endpoint> endpoint)
+{
+  std::lock_guard<std::mutex> lock(_endpointsMutex);
+  auto& endpoints = _endpoints[workerIndex];
+
+  // Prune only when the vector would reallocate, amortizing the cost over insertions.
+  if (endpoints.size() == endpoints.capacity()) pruneEndpoints(endpoints);
+  endpoints.push_back(endpoint);
+}
+
+void WorkerPool::setProgressThreadStartCallback(std::function<void(void*)> callback,
+                                                void* callbackArg)
+{
+  for (auto& worker : _workers)
+    worker->setProgressThreadStartCallback(callback, callbackArg);
+}
+
+void WorkerPool::startProgressThreads(const bool pollingMode,
+                                      const std::vector<std::vector<size_t>>& cpuAffinities)
+{
+  for (size_t i = 0; i < _workers.size(); ++i)
+    _workers[i]->startProgressThread(
+      pollingMode, i < cpuAffinities.size() ? cpuAffinities[i] : std::vector<size_t>{});
+}
+
+void WorkerPool::stopProgressThreads()
+{
+  for (auto& worker : _workers)
+    worker->stopProgressThread();
+}
+
+size_t WorkerPool::cancelInflightRequests()
+{
+  size_t canceled = 0;
+  for (size_t i = 0; i < _workers.size(); ++i) {
+    // Cancel outside of the lock, completion callbacks may create or release endpoints.
+    std::vector<std::shared_ptr<Endpoint>> endpoints;
+    {
+      std::lock_guard<std::mutex> lock(_endpointsMutex);
+      for (const auto& ep : _endpoints[i])
+        if (auto endpoint = ep.lock()) endpoints.push_back(std::move(endpoint));
+    }
+
+    for (auto& endpoint : endpoints)
+      canceled += endpoint->cancelInflightRequests();
+    canceled += _workers[i]->cancelAllInflightRequests();
+  }
+  return canceled;
+}
+
+void WorkerPool::shutdown()
+{
+  // Stop progress threads first, so that requests are canceled by this thread only.
+  for (auto& worker : _workers)
+    if (worker->isProgressThreadRunning()) worker->stopProgressThread();
+
+  size_t canceled = cancelInflightRequests();
+  ucxx_debug("WorkerPool %p shutdown, canceled %lu requests", this, canceled);
+
+  // Deliver completions of canceled requests that UCX does not complete immediately.
+  for (auto& worker : _workers)
+    worker->progress();
+}
+
+std::shared_ptr<Endpoint> WorkerPool::createEndpointFromHostname(std::string ipAddress,
+                                                                 uint16_t port,
+                                                                 bool endpointErrorHandling)
+{
+  auto index    = selectWorkerIndex(ipAddress + ":" + std::to_string(port));
+  auto endpoint =
+    _workers[index]->createEndpointFromHostname(ipAddress, port, endpointErrorHandling);
+  registerEndpoint(index, endpoint);
+  return endpoint;
+}
+
+std::shared_ptr<Endpoint> WorkerPool::createEndpointFromWorkerAddress(
+  std::shared_ptr<Address> address, bool endpointErrorHandling)
+{
+  auto index    = selectWorkerIndex(address->getString());
+  auto endpoint = _workers[index]->createEndpointFromWorkerAddress(address, endpointErrorHandling);
+  registerEndpoint(index, endpoint);
+  return endpoint;
+}
+
+std::shared_ptr<Endpoint> WorkerPool::createEndpointFromConnRequest(
+  ucp_conn_request_h connRequest, bool endpointErrorHandling)
+{
+  std::string peerKey{};
+  if (_placement == WorkerPoolPlacement::PeerHash) {
+    ucp_conn_request_attr_t attr{};
+    attr.field_mask = UCP_CONN_REQUEST_ATTR_FIELD_CLIENT_ADDR;
+    utils::ucsErrorThrow(ucp_conn_request_query(connRequest, &attr));
+
+    char ipString[INET6_ADDRSTRLEN];
+    char portString[INET6_ADDRSTRLEN];
+    utils::sockaddr_get_ip_port_str(
+      &attr.client_address, ipString, portString, INET6_ADDRSTRLEN);
+    peerKey = ipString;
+  }
+
+  auto index = selectWorkerIndex(peerKey);
+  auto endpoint =
+    _workers[index]->createEndpointFromConnRequest(connRequest, endpointErrorHandling);
+  registerEndpoint(index, endpoint);
+  return endpoint;
+}
+
+std::shared_ptr<Listener> WorkerPool::createListener(uint16_t port,
+                                                     ucp_listener_conn_callback_t callback,
+                                                     void* callbackArgs)
+{
+  return selectWorker()->createListener(port, callback, callbackArgs);
+}
+
+}  // namespace ucxx
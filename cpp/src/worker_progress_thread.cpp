@@ -2,9 +2,14 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <exception>
+#include <future>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <ucxx/log.h>
+#include <ucxx/utils/affinity.h>
 #include <ucxx/worker_progress_thread.h>
 
 namespace ucxx {
@@ -14,8 +19,18 @@ void WorkerProgressThread::progressUntilSync(
   const bool& stop,
   ProgressThreadStartCallback startCallback,
   ProgressThreadStartCallbackArg startCallbackArg,
-  std::shared_ptr<DelayedSubmissionCollection> delayedSubmissionCollection)
+  std::shared_ptr<DelayedSubmissionCollection> delayedSubmissionCollection,
+  std::vector<size_t> cpuAffinity,
+  std::promise<void> pinned)
 {
+  try {
+    if (!cpuAffinity.empty()) utils::setThreadCpuAffinity(cpuAffinity);
+    pinned.set_value();
+  } catch (...) {
+    pinned.set_exception(std::current_exception());
+    return;
+  }
+
   if (startCallback) startCallback(startCallbackArg);
 
   while (!stop) {
@@ -31,18 +46,33 @@ WorkerProgressThread::WorkerProgressThread(
   std::function<void(void)> signalWorkerFunction,
   ProgressThreadStartCallback startCallback,
   ProgressThreadStartCallbackArg startCallbackArg,
-  std::shared_ptr<DelayedSubmissionCollection> delayedSubmissionCollection)
+  std::shared_ptr<DelayedSubmissionCollection> delayedSubmissionCollection,
+  const std::vector<size_t>& cpuAffinity)
   : _pollingMode(pollingMode),
     _signalWorkerFunction(signalWorkerFunction),
     _startCallback(startCallback),
-    _startCallbackArg(startCallbackArg)
+    _startCallbackArg(startCallbackArg),
+    _cpuAffinity(cpuAffinity)
 {
+  std::promise<void> pinned;
+  auto pinnedFuture = pinned.get_future();
+
   _thread = std::thread(WorkerProgressThread::progressUntilSync,
                         progressFunction,
                         std::ref(_stop),
                         _startCallback,
                         _startCallbackArg,
-                        delayedSubmissionCollection);
+                        delayedSubmissionCollection,
+                        _cpuAffinity,
+                        std::move(pinned));
+
+  // Wait for the thread to be pinned, rethrowing any errors in the caller's thread
+  try {
+    pinnedFuture.get();
+  } catch (...) {
+    _thread.join();
+    throw;
+  }
 }
 
 WorkerProgressThread::~WorkerProgressThread()
@@ -59,4 +89,8 @@ WorkerProgressThread::~WorkerProgressThread()
 
 bool WorkerProgressThread::pollingMode() const { return _pollingMode; }
 
+const std::vector<size_t>& WorkerProgressThread::getCpuAffinity() const { return _cpuAffinity; }
+
+std::thread::id WorkerProgressThread::getId() const { return _thread.get_id(); }
+
 }  // namespace ucxx
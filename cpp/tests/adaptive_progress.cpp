@@ -0,0 +1,133 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/adaptive_progress.h>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+class AdaptiveProgressTest : public ::testing::Test {
+ protected:
+  bool _activity{false};
+  size_t _progressCalls{0};
+  size_t _blockingCalls{0};
+
+  std::unique_ptr<ucxx::AdaptiveProgress> create(const ucxx::AdaptiveProgressConfig& config)
+  {
+    return std::make_unique<ucxx::AdaptiveProgress>(
+      config,
+      [this]() {
+        ++_progressCalls;
+        return _activity;
+      },
+      [this]() {
+        ++_blockingCalls;
+        return false;
+      });
+  }
+};
+
+TEST_F(AdaptiveProgressTest, BlockWithoutSpinBudget)
+{
+  ucxx::AdaptiveProgressConfig config{};
+  config.minSpinDuration = 0ns;
+  config.maxSpinDuration = 0ns;
+  auto adaptiveProgress  = create(config);
+
+  for (size_t i = 0; i < 10; ++i)
+    ASSERT_FALSE(adaptiveProgress->progress());
+
+  ASSERT_EQ(_progressCalls, 10);
+  ASSERT_EQ(_blockingCalls, 10);
+}
+
+TEST_F(AdaptiveProgressTest, SpinWithinBudget)
+{
+  ucxx::AdaptiveProgressConfig config{};
+  config.maxSpinDuration = 1h;
+  auto adaptiveProgress  = create(config);
+
+  for (size_t i = 0; i < 100; ++i)
+    ASSERT_FALSE(adaptiveProgress->progress());
+
+  ASSERT_EQ(_progressCalls, 100);
+  ASSERT_EQ(_blockingCalls, 0);
+}
+
+TEST_F(AdaptiveProgressTest, SpinIterationLimit)
+{
+  ucxx::AdaptiveProgressConfig config{};
+  config.maxSpinDuration   = 1h;
+  config.maxSpinIterations = 4;
+  auto adaptiveProgress    = create(config);
+
+  for (size_t i = 0; i < 3; ++i)
+    adaptiveProgress->progress();
+  ASSERT_EQ(_blockingCalls, 0);
+
+  // Fourth iteration exhausts the spin window
+  adaptiveProgress->progress();
+  ASSERT_EQ(_blockingCalls, 1);
+
+  // A new spin window starts after blocking
+  adaptiveProgress->progress();
+  ASSERT_EQ(_blockingCalls, 1);
+}
+
+TEST_F(AdaptiveProgressTest, ActivityResetsSpinWindow)
+{
+  ucxx::AdaptiveProgressConfig config{};
+  config.maxSpinDuration   = 1h;
+  config.maxSpinIterations = 2;
+  auto adaptiveProgress    = create(config);
+
+  for (size_t i = 0; i < 10; ++i) {
+    adaptiveProgress->progress();
+    _activity = true;
+    ASSERT_TRUE(adaptiveProgress->progress());
+    _activity = false;
+  }
+
+  ASSERT_EQ(_blockingCalls, 0);
+}
+
+TEST_F(AdaptiveProgressTest, BudgetAdaptsToInterArrivalTime)
+{
+  ucxx::AdaptiveProgressConfig config{};
+  config.minSpinDuration        = 1us;
+  config.maxSpinDuration        = 1s;
+  config.interArrivalMultiplier = 2.0;
+  config.smoothingFactor        = 1.0;
+  auto adaptiveProgress         = create(config);
+
+  ASSERT_EQ(adaptiveProgress->getSpinBudget(), config.maxSpinDuration);
+
+  // Frequent activity: budget follows the inter-arrival time
+  _activity = true;
+  adaptiveProgress->progress();
+  std::this_thread::sleep_for(10ms);
+  adaptiveProgress->progress();
+
+  ASSERT_GE(adaptiveProgress->getInterArrivalTime(), 10ms);
+  ASSERT_GE(adaptiveProgress->getSpinBudget(), 20ms);
+  ASSERT_LT(adaptiveProgress->getSpinBudget(), config.maxSpinDuration);
+
+  // Sparse activity: spinning would not catch it, budget drops to minimum
+  config.maxSpinDuration = 5ms;
+  adaptiveProgress       = create(config);
+  adaptiveProgress->progress();
+  std::this_thread::sleep_for(10ms);
+  adaptiveProgress->progress();
+
+  ASSERT_EQ(adaptiveProgress->getSpinBudget(), config.minSpinDuration);
+}
+
+}  // namespace
@@ -0,0 +1,138 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/completion_queue.h>
+
+using ::testing::ContainerEq;
+
+namespace {
+
+std::shared_ptr<void> nonOwningContext(size_t i)
+{
+  return std::shared_ptr<void>(std::shared_ptr<void>{}, reinterpret_cast<void*>(i));
+}
+
+ucxx::Completion makeCompletion(size_t i)
+{
+  return ucxx::Completion{nonOwningContext(i), UCS_OK, i};
+}
+
+TEST(CompletionQueueTest, CapacityPowerOfTwo)
+{
+  ASSERT_EQ(ucxx::CompletionQueue(1).getCapacity(), 1);
+  ASSERT_EQ(ucxx::CompletionQueue(3).getCapacity(), 4);
+  ASSERT_EQ(ucxx::CompletionQueue().getCapacity(), ucxx::CompletionQueue::defaultCapacity);
+}
+
+TEST(CompletionQueueTest, PollEmpty)
+{
+  ucxx::CompletionQueue queue{};
+  std::vector<ucxx::Completion> completions(8);
+
+  ASSERT_TRUE(queue.isEmpty());
+  ASSERT_EQ(queue.poll(completions.data(), completions.size()), 0);
+}
+
+TEST(CompletionQueueTest, OrderWithOverflow)
+{
+  // Push more completions than the ring can hold to exercise the overflow path, polling
+  // in batches smaller than the ring.
+  const size_t capacity = 8;
+  const size_t total    = capacity * 4 + 3;
+
+  ucxx::CompletionQueue queue{capacity};
+  for (size_t i = 0; i < total; ++i)
+    queue.push(makeCompletion(i));
+
+  std::vector<size_t> polled;
+  std::vector<ucxx::Completion> completions(5);
+  while (size_t n = queue.poll(completions.data(), completions.size())) {
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(completions[i].status, UCS_OK);
+      polled.push_back(completions[i].length);
+    }
+  }
+  ASSERT_TRUE(queue.isEmpty());
+
+  std::vector<size_t> expected(total);
+  std::iota(expected.begin(), expected.end(), 0);
+  ASSERT_THAT(polled, ContainerEq(expected));
+
+  // Ring must be usable again after the overflow was polled
+  queue.push(makeCompletion(total));
+  ASSERT_EQ(queue.poll(completions.data(), completions.size()), 1);
+  ASSERT_EQ(completions[0].context.get(), reinterpret_cast<void*>(total));
+}
+
+TEST(CompletionQueueTest, ContextKeptAlive)
+{
+  ucxx::CompletionQueue queue{};
+  std::vector<ucxx::Completion> completions(1);
+
+  auto context = std::make_shared<size_t>(42);
+  std::weak_ptr<size_t> weakContext = context;
+  queue.push(ucxx::Completion{context, UCS_OK, 0});
+  context.reset();
+
+  // The queued completion keeps the context alive until released by the application
+  ASSERT_FALSE(weakContext.expired());
+  ASSERT_EQ(queue.poll(completions.data(), completions.size()), 1);
+  ASSERT_EQ(*std::static_pointer_cast<size_t>(completions[0].context), 42);
+  completions.clear();
+  ASSERT_TRUE(weakContext.expired());
+}
+
+TEST(CompletionQueueTest, MultipleProducers)
+{
+  const size_t numThreads           = 4;
+  const size_t completionsPerThread = 10000;
+  const size_t capacity             = 64;
+  const size_t totalCompletions     = numThreads * completionsPerThread;
+  std::atomic<size_t> numFinished   = 0;
+
+  ucxx::CompletionQueue queue{capacity};
+
+  std::vector<std::thread> producers;
+  for (size_t t = 0; t < numThreads; ++t) {
+    producers.emplace_back([&, t]() {
+      for (size_t i = 0; i < completionsPerThread; ++i)
+        queue.push(ucxx::Completion{nonOwningContext(t), UCS_OK, i});
+      ++numFinished;
+    });
+  }
+
+  // Last polled index of each producer, must be strictly increasing
+  std::vector<long> lastPolled(numThreads, -1);
+  std::vector<ucxx::Completion> completions(capacity / 2);
+  size_t numPolled = 0;
+  bool ordered     = true;
+
+  while (numFinished < numThreads || numPolled < totalCompletions) {
+    size_t n = queue.poll(completions.data(), completions.size());
+    for (size_t i = 0; i < n; ++i) {
+      auto t = reinterpret_cast<uintptr_t>(completions[i].context.get());
+      if (static_cast<long>(completions[i].length) <= lastPolled[t]) ordered = false;
+      lastPolled[t] = completions[i].length;
+    }
+    numPolled += n;
+  }
+
+  for (auto& p : producers)
+    p.join();
+
+  ASSERT_EQ(numPolled, totalCompletions);
+  ASSERT_TRUE(ordered);
+}
+
+}  // namespace
@@ -0,0 +1,175 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+#include "include/utils.h"
+
+namespace {
+
+class CoroutineTest : public ::testing::TestWithParam<ProgressMode> {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+
+  void SetUp()
+  {
+    _worker = _context->createWorker();
+    if (GetParam() == ProgressMode::Blocking) _worker->initBlockingProgressMode();
+    _ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  }
+};
+
+ucxx::coroutine::Task sendValues(std::shared_ptr<ucxx::Endpoint> ep,
+                                 std::vector<int>& send,
+                                 ucp_tag_t tag)
+{
+  for (auto& value : send)
+    co_await ucxx::coroutine::tagSend(ep, &value, sizeof(int), tag);
+}
+
+ucxx::coroutine::Task recvValues(std::shared_ptr<ucxx::Endpoint> ep,
+                                 std::vector<int>& recv,
+                                 ucp_tag_t tag)
+{
+  for (auto& value : recv) {
+    auto request = co_await ucxx::coroutine::tagRecv(ep, &value, sizeof(int), tag);
+    EXPECT_TRUE(request->isCompleted());
+  }
+}
+
+ucxx::coroutine::Task pingPong(std::shared_ptr<ucxx::Endpoint> ep, int& result, ucp_tag_t tag)
+{
+  std::vector<int> ping{static_cast<int>(tag)};
+  int pong = -1;
+
+  // Await a nested task, the scheduler resumes this task once it completes.
+  co_await sendValues(ep, ping, tag);
+  co_await ucxx::coroutine::tagRecv(ep, &pong, sizeof(int), tag);
+  result = pong;
+}
+
+ucxx::coroutine::Task failingTask()
+{
+  co_await std::suspend_never{};
+  throw std::runtime_error("task failed");
+}
+
+TEST(CoroutineScheduler, ProgressThreadRunning)
+{
+  auto context = ucxx::createContext({}, ucxx::Context::defaultFeatureFlags);
+  auto worker  = context->createWorker();
+
+  worker->startProgressThread(false);
+  EXPECT_THROW(ucxx::coroutine::Scheduler scheduler(worker), std::runtime_error);
+  worker->stopProgressThread();
+}
+
+TEST(CoroutineScheduler, DelayedSubmission)
+{
+  auto context = ucxx::createContext({}, ucxx::Context::defaultFeatureFlags);
+  auto worker  = context->createWorker(true);
+
+  EXPECT_THROW(ucxx::coroutine::Scheduler scheduler(worker), std::runtime_error);
+}
+
+TEST(CoroutineScheduler, Exception)
+{
+  auto context = ucxx::createContext({}, ucxx::Context::defaultFeatureFlags);
+  auto worker  = context->createWorker();
+  ucxx::coroutine::Scheduler scheduler(worker);
+
+  scheduler.spawn(failingTask());
+  EXPECT_THROW(scheduler.run(), std::runtime_error);
+  ASSERT_EQ(scheduler.getTaskCount(), 0u);
+}
+
+TEST_P(CoroutineTest, TagSendRecv)
+{
+  std::vector<int> send{1, 2, 3, 4}, recv(send.size(), 0);
+  ucxx::coroutine::Scheduler scheduler(_worker);
+
+  scheduler.spawn(recvValues(_ep, recv, 0));
+  scheduler.spawn(sendValues(_ep, send, 0));
+  ASSERT_EQ(scheduler.getTaskCount(), 2u);
+  scheduler.run();
+
+  ASSERT_EQ(scheduler.getTaskCount(), 0u);
+  ASSERT_EQ(recv, send);
+}
+
+TEST_P(CoroutineTest, WorkerTagRecv)
+{
+  std::vector<int> send{42}, recv{0};
+  ucxx::coroutine::Scheduler scheduler(_worker);
+
+  auto task = [](std::shared_ptr<ucxx::Worker> worker,
+                 std::vector<int>& recv) -> ucxx::coroutine::Task {
+    co_await ucxx::coroutine::tagRecv(worker, recv.data(), sizeof(int), 0);
+  };
+  scheduler.spawn(task(_worker, recv));
+  scheduler.spawn(sendValues(_ep, send, 0));
+  scheduler.run();
+
+  ASSERT_EQ(recv, send);
+}
+
+TEST_P(CoroutineTest, TagMultiRecv)
+{
+  std::vector<int> send{1, 2, 3, 4};
+  std::vector<int> recv;
+  ucxx::coroutine::Scheduler scheduler(_worker);
+
+  auto sendRequest = _ep->tagMultiSend(std::vector<void*>{send.data()},
+                                       std::vector<size_t>{send.size() * sizeof(int)},
+                                       std::vector<int>{false},
+                                       0,
+                                       false);
+
+  auto task = [](std::shared_ptr<ucxx::Endpoint> ep,
+                 std::vector<int>& recv) -> ucxx::coroutine::Task {
+    auto request = co_await ucxx::coroutine::tagMultiRecv(ep, 0);
+    for (const auto& br : request->_bufferRequests) {
+      if (br->buffer == nullptr) continue;
+      auto data = reinterpret_cast<int*>(br->buffer->data());
+      recv.assign(data, data + br->buffer->getSize() / sizeof(int));
+    }
+  };
+  scheduler.spawn(task(_ep, recv));
+  scheduler.run();
+
+  while (!sendRequest->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(recv, send);
+}
+
+TEST_P(CoroutineTest, ConcurrentTasks)
+{
+  const size_t numTasks = 1000;
+  std::vector<int> results(numTasks, -1);
+  std::vector<int> expected(numTasks);
+  ucxx::coroutine::Scheduler scheduler(_worker);
+
+  for (size_t i = 0; i < numTasks; ++i) {
+    expected[i] = i;
+    scheduler.spawn(pingPong(_ep, results[i], i));
+  }
+  scheduler.run();
+
+  ASSERT_EQ(results, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(ProgressModes,
+                         CoroutineTest,
+                         ::testing::Values(ProgressMode::Polling, ProgressMode::Blocking));
+
+}  // namespace
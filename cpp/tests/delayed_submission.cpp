@@ -0,0 +1,120 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/delayed_submission.h>
+
+using ::testing::ContainerEq;
+
+namespace {
+
+TEST(DelayedSubmissionCollectionTest, CapacityPowerOfTwo)
+{
+  ASSERT_EQ(ucxx::DelayedSubmissionCollection(1).getCapacity(), 1);
+  ASSERT_EQ(ucxx::DelayedSubmissionCollection(3).getCapacity(), 4);
+  ASSERT_EQ(ucxx::DelayedSubmissionCollection(1024).getCapacity(), 1024);
+  ASSERT_EQ(ucxx::DelayedSubmissionCollection().getCapacity(),
+            ucxx::DelayedSubmissionCollection::defaultCapacity);
+}
+
+TEST(DelayedSubmissionCollectionTest, ProcessEmpty)
+{
+  ucxx::DelayedSubmissionCollection collection{};
+  collection.process();
+}
+
+TEST(DelayedSubmissionCollectionTest, OrderWithOverflow)
+{
+  // Register more requests than the ring can hold to exercise the overflow path
+  const size_t capacity = 8;
+  const size_t total    = capacity * 4 + 3;
+
+  ucxx::DelayedSubmissionCollection collection{capacity};
+  std::vector<size_t> processed;
+
+  for (size_t i = 0; i < total; ++i)
+    collection.registerRequest([&processed, i]() { processed.push_back(i); });
+
+  ASSERT_TRUE(processed.empty());
+  collection.process();
+
+  std::vector<size_t> expected(total);
+  std::iota(expected.begin(), expected.end(), 0);
+  ASSERT_THAT(processed, ContainerEq(expected));
+
+  // Ring must be usable again after the overflow was processed
+  processed.clear();
+  collection.registerRequest([&processed, total]() { processed.push_back(total); });
+  collection.process();
+  ASSERT_THAT(processed, ContainerEq(std::vector<size_t>{total}));
+}
+
+TEST(DelayedSubmissionCollectionTest, RegisterDuringProcess)
+{
+  ucxx::DelayedSubmissionCollection collection{};
+  size_t processed = 0;
+
+  // A callback that keeps registering itself must not prevent `process()` from returning
+  std::function<void()> resubmit = [&]() {
+    ++processed;
+    collection.registerRequest(resubmit);
+  };
+  collection.registerRequest(resubmit);
+
+  collection.process();
+  ASSERT_EQ(processed, 1);
+  ASSERT_FALSE(collection.isEmpty());
+
+  collection.process();
+  ASSERT_EQ(processed, 2);
+}
+
+TEST(DelayedSubmissionCollectionTest, MultipleProducers)
+{
+  const size_t numThreads         = 4;
+  const size_t requestsPerThread  = 10000;
+  const size_t capacity           = 64;
+  const size_t totalRequests      = numThreads * requestsPerThread;
+  std::atomic<size_t> numFinished = 0;
+
+  ucxx::DelayedSubmissionCollection collection{capacity};
+
+  // Last processed index of each producer, must be strictly increasing
+  std::vector<long> lastProcessed(numThreads, -1);
+  size_t numProcessed = 0;
+  bool ordered        = true;
+
+  std::vector<std::thread> producers;
+  for (size_t t = 0; t < numThreads; ++t) {
+    producers.emplace_back([&, t]() {
+      for (size_t i = 0; i < requestsPerThread; ++i) {
+        collection.registerRequest([&lastProcessed, &numProcessed, &ordered, t, i]() {
+          if (static_cast<long>(i) <= lastProcessed[t]) ordered = false;
+          lastProcessed[t] = i;
+          ++numProcessed;
+        });
+      }
+      ++numFinished;
+    });
+  }
+
+  while (numFinished < numThreads || numProcessed < totalRequests)
+    collection.process();
+
+  for (auto& p : producers)
+    p.join();
+
+  ASSERT_EQ(numProcessed, totalRequests);
+  ASSERT_TRUE(ordered);
+}
+
+}  // namespace
@@ -56,4 +56,123 @@ TEST_F(EndpointTest, IsAlive)
   ASSERT_FALSE(ep->isAlive());
 }
 
+TEST_F(EndpointTest, CancelInflightRequests)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  _worker->progress();
+
+  const size_t numRequests = 10;
+  std::vector<int> buf(numRequests);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (size_t i = 0; i < numRequests; ++i)
+    requests.push_back(ep->tagRecv(&buf[i], sizeof(int), i));
+
+  // Complete one request, it must not be canceled
+  std::vector<int> sendBuf{123};
+  auto sendReq = ep->tagSend(sendBuf.data(), sizeof(int), 0);
+  while (!sendReq->isCompleted() || !requests[0]->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(requests[0]->getStatus(), UCS_OK);
+
+  ASSERT_EQ(ep->cancelInflightRequests(), numRequests - 1);
+  for (size_t i = 1; i < numRequests; ++i) {
+    while (!requests[i]->isCompleted())
+      _worker->progress();
+    ASSERT_EQ(requests[i]->getStatus(), UCS_ERR_CANCELED);
+  }
+
+  // All requests have been removed from the endpoint
+  ASSERT_EQ(ep->cancelInflightRequests(), 0u);
+}
+
+TEST_F(EndpointTest, CloseAsync)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  _worker->progress();
+
+  bool closeCallbackCalled = false;
+  ep->setCloseCallback([](void* arg) { *reinterpret_cast<bool*>(arg) = true; },
+                       &closeCallbackCalled);
+
+  auto request = ep->closeAsync(ucxx::EndpointCloseMode::Flush);
+  while (!request->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(request->getStatus(), UCS_OK);
+  ASSERT_TRUE(closeCallbackCalled);
+  ASSERT_EQ(ep->getHandle(), nullptr);
+
+  // Closing again must not touch the released UCP endpoint
+  auto secondRequest = ep->closeAsync(ucxx::EndpointCloseMode::Force);
+  while (!secondRequest->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(secondRequest->getStatus(), UCS_ERR_NOT_CONNECTED);
+}
+
+TEST_F(EndpointTest, CloseAsyncForceCancelsInflightRequests)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  _worker->progress();
+
+  std::vector<int> buf(1);
+  auto recvRequest = ep->tagRecv(buf.data(), sizeof(int), 0);
+
+  auto request = ep->closeAsync(ucxx::EndpointCloseMode::Force);
+  while (!request->isCompleted() || !recvRequest->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(request->getStatus(), UCS_OK);
+  ASSERT_EQ(recvRequest->getStatus(), UCS_ERR_CANCELED);
+}
+
+TEST_F(EndpointTest, CloseWithProgressThread)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  _worker->startProgressThread(true);
+
+  bool closeCallbackCalled = false;
+  ep->setCloseCallback([](void* arg) { *reinterpret_cast<bool*>(arg) = true; },
+                       &closeCallbackCalled);
+
+  // The progress thread completes the close while the caller waits
+  ep->close(ucxx::EndpointCloseMode::Flush);
+  ASSERT_TRUE(closeCallbackCalled);
+  ASSERT_EQ(ep->getHandle(), nullptr);
+
+  _worker->stopProgressThread();
+}
+
+TEST_F(EndpointTest, DestroyWithUnresponsivePeer)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_remoteWorker->getAddress());
+  _worker->progress();
+
+  // The remote worker is never progressed, destruction force closes instead of flushing
+  ep = nullptr;
+}
+
+TEST_F(EndpointTest, CloseEndpoints)
+{
+  const size_t numEndpoints = 16;
+  std::vector<std::shared_ptr<ucxx::Endpoint>> endpoints;
+  for (size_t i = 0; i < numEndpoints; ++i)
+    endpoints.push_back(_worker->createEndpointFromWorkerAddress(_worker->getAddress()));
+  _worker->progress();
+
+  auto requests = _worker->closeEndpoints(endpoints, ucxx::EndpointCloseMode::Force);
+  ASSERT_EQ(requests.size(), numEndpoints);
+  for (auto& request : requests) {
+    while (!request->isCompleted())
+      _worker->progress();
+    ASSERT_EQ(request->getStatus(), UCS_OK);
+  }
+  for (auto& endpoint : endpoints)
+    ASSERT_EQ(endpoint->getHandle(), nullptr);
+
+  // Endpoints must belong to the worker closing them
+  auto remoteEp = _remoteWorker->createEndpointFromWorkerAddress(_worker->getAddress());
+  EXPECT_THROW(_worker->closeEndpoints({remoteEp}), ucxx::Error);
+  auto remoteRequests = _remoteWorker->closeEndpoints({remoteEp}, ucxx::EndpointCloseMode::Force);
+  while (!remoteRequests[0]->isCompleted())
+    _remoteWorker->progress();
+}
+
 }  // namespace
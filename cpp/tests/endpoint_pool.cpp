@@ -0,0 +1,184 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+class EndpointPoolTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Context> _remoteContext{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Worker> _remoteWorker{nullptr};
+
+  virtual void SetUp()
+  {
+    _worker       = _context->createWorker();
+    _remoteWorker = _remoteContext->createWorker();
+  }
+};
+
+TEST_F(EndpointPoolTest, Reuse)
+{
+  auto pool    = _worker->createEndpointPool();
+  auto address = _worker->getAddress();
+
+  bool reused = true;
+  auto ep     = pool->getFromWorkerAddress(address, true, &reused);
+  _worker->progress();
+  ASSERT_FALSE(reused);
+  ASSERT_EQ(pool->getMisses(), 1u);
+
+  pool->release(ep);
+  ASSERT_EQ(pool->getSize(), 1u);
+
+  auto reusedEp = pool->getFromWorkerAddress(address, true, &reused);
+  ASSERT_TRUE(reused);
+  ASSERT_EQ(reusedEp, ep);
+  ASSERT_EQ(pool->getHits(), 1u);
+  ASSERT_EQ(pool->getSize(), 0u);
+
+  // Endpoints are keyed by error handling as well
+  auto otherEp = pool->getFromWorkerAddress(address, false, &reused);
+  ASSERT_FALSE(reused);
+  ASSERT_NE(otherEp, ep);
+}
+
+TEST_F(EndpointPoolTest, MaxSize)
+{
+  const size_t maxSize = 2;
+  auto pool            = _worker->createEndpointPool(maxSize);
+  auto address         = _worker->getAddress();
+
+  std::vector<std::shared_ptr<ucxx::Endpoint>> endpoints;
+  for (size_t i = 0; i < maxSize + 2; ++i)
+    endpoints.push_back(pool->getFromWorkerAddress(address));
+  _worker->progress();
+
+  for (auto& ep : endpoints)
+    pool->release(ep);
+  ASSERT_EQ(pool->getSize(), maxSize);
+  ASSERT_EQ(pool->getEvictions(), 2u);
+
+  // The least recently released endpoints were evicted and closed
+  while (endpoints[0]->getHandle() != nullptr || endpoints[1]->getHandle() != nullptr)
+    _worker->progress();
+  ASSERT_NE(endpoints[2]->getHandle(), nullptr);
+  ASSERT_NE(endpoints[3]->getHandle(), nullptr);
+}
+
+TEST_F(EndpointPoolTest, IdleTimeout)
+{
+  auto pool    = _worker->createEndpointPool(16, std::chrono::milliseconds(10));
+  auto address = _worker->getAddress();
+
+  auto ep = pool->getFromWorkerAddress(address);
+  _worker->progress();
+  pool->release(ep);
+  ASSERT_EQ(pool->getSize(), 1u);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  ASSERT_EQ(pool->evictIdle(), 1u);
+  ASSERT_EQ(pool->getSize(), 0u);
+  ASSERT_EQ(pool->getEvictions(), 1u);
+
+  bool reused = true;
+  pool->getFromWorkerAddress(address, true, &reused);
+  ASSERT_FALSE(reused);
+}
+
+TEST_F(EndpointPoolTest, ReleaseClosed)
+{
+  auto pool    = _worker->createEndpointPool();
+  auto address = _worker->getAddress();
+
+  auto ep = pool->getFromWorkerAddress(address);
+  _worker->progress();
+  ep->close();
+
+  // Closed endpoints are discarded instead of kept for reuse
+  pool->release(ep);
+  ASSERT_EQ(pool->getSize(), 0u);
+}
+
+TEST_F(EndpointPoolTest, ReleaseInflight)
+{
+  auto pool    = _worker->createEndpointPool();
+  auto address = _worker->getAddress();
+
+  auto ep = pool->getFromWorkerAddress(address);
+  _worker->progress();
+
+  std::vector<int> buffer(1);
+  auto request = ep->tagRecv(buffer.data(), buffer.size() * sizeof(int), 0);
+
+  // Endpoints with inflight requests are discarded, canceling their requests
+  pool->release(ep);
+  ASSERT_EQ(pool->getSize(), 0u);
+  while (!request->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(request->getStatus(), UCS_ERR_CANCELED);
+}
+
+TEST_F(EndpointPoolTest, UserData)
+{
+  auto pool    = _worker->createEndpointPool();
+  auto address = _worker->getAddress();
+
+  std::shared_ptr<void> userData{nullptr};
+  auto ep = pool->getFromWorkerAddress(address, true, nullptr, &userData);
+  _worker->progress();
+  ASSERT_EQ(userData, nullptr);
+
+  auto data = std::make_shared<int>(42);
+  pool->release(ep, data);
+
+  bool reused   = false;
+  auto reusedEp = pool->getFromWorkerAddress(address, true, &reused, &userData);
+  ASSERT_TRUE(reused);
+  ASSERT_EQ(userData, data);
+
+  // Data of endpoints leaving the pool is destroyed
+  std::weak_ptr<int> weakData = data;
+  pool->release(reusedEp, std::move(data));
+  userData = nullptr;
+  pool->clear();
+  ASSERT_TRUE(weakData.expired());
+}
+
+TEST_F(EndpointPoolTest, ReleaseForeign)
+{
+  auto pool = _worker->createEndpointPool();
+  auto ep   = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  EXPECT_THROW(pool->release(ep), std::invalid_argument);
+}
+
+TEST_F(EndpointPoolTest, Clear)
+{
+  auto pool    = _worker->createEndpointPool();
+  auto address = _worker->getAddress();
+
+  auto ep = pool->getFromWorkerAddress(address);
+  _worker->progress();
+  pool->release(ep);
+
+  pool->clear();
+  ASSERT_EQ(pool->getSize(), 0u);
+  while (ep->getHandle() != nullptr)
+    _worker->progress();
+}
+
+}  // namespace
@@ -0,0 +1,235 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+#include "include/utils.h"
+
+namespace {
+
+class NativeFutureTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Notifier> _notifier{ucxx::createNativeNotifier()};
+
+  std::shared_ptr<ucxx::NativeFuture> createFuture()
+  {
+    return std::dynamic_pointer_cast<ucxx::NativeFuture>(ucxx::createNativeFuture(_notifier));
+  }
+};
+
+class NativeFutureWorkerTest : public ::testing::TestWithParam<bool> {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+
+  void SetUp()
+  {
+    _worker = _context->createWorker(GetParam(), true);
+    _worker->startProgressThread(false);
+    _ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  }
+
+  void TearDown() { _worker->stopProgressThread(); }
+};
+
+TEST_F(NativeFutureTest, WaitTimeout)
+{
+  auto future = createFuture();
+
+  ASSERT_FALSE(future->isCompleted());
+  ASSERT_FALSE(future->wait(1000000));
+  ASSERT_EQ(future->getStatus(), UCS_INPROGRESS);
+}
+
+TEST_F(NativeFutureTest, NotifyFromThread)
+{
+  auto future = createFuture();
+
+  std::thread notifyThread([future]() { future->notify(UCS_ERR_CANCELED); });
+
+  ASSERT_TRUE(future->wait());
+  ASSERT_TRUE(future->isCompleted());
+  ASSERT_EQ(future->getStatus(), UCS_ERR_CANCELED);
+
+  notifyThread.join();
+}
+
+TEST_F(NativeFutureTest, SetOnlyOnce)
+{
+  auto future = createFuture();
+
+  future->set(UCS_OK);
+  future->set(UCS_ERR_CANCELED);
+
+  ASSERT_EQ(future->getStatus(), UCS_OK);
+}
+
+TEST_F(NativeFutureTest, Continuations)
+{
+  auto future = createFuture();
+  std::vector<ucs_status_t> statuses;
+
+  future->then([&statuses](ucs_status_t status) { statuses.push_back(status); });
+  future->then([](ucs_status_t status) { throw std::runtime_error("ignored"); });
+  ASSERT_TRUE(statuses.empty());
+
+  future->set(UCS_OK);
+  ASSERT_EQ(statuses.size(), 1u);
+
+  // Continuations registered after the future was set execute immediately
+  ASSERT_EQ(future->then([&statuses](ucs_status_t status) { statuses.push_back(status); }), 0u);
+  ASSERT_EQ(statuses.size(), 2u);
+  ASSERT_EQ(statuses[0], UCS_OK);
+  ASSERT_EQ(statuses[1], UCS_OK);
+
+  // Exceptions are also contained when executing immediately
+  EXPECT_NO_THROW(future->then([](ucs_status_t status) { throw std::runtime_error("ignored"); }));
+}
+
+TEST_F(NativeFutureTest, RemoveContinuation)
+{
+  auto future = createFuture();
+  size_t calls{0};
+
+  auto removed = future->then([&calls](ucs_status_t) { ++calls; });
+  auto kept    = future->then([&calls](ucs_status_t) { ++calls; });
+  ASSERT_NE(removed, 0u);
+  ASSERT_NE(kept, removed);
+
+  ASSERT_TRUE(future->removeContinuation(removed));
+  ASSERT_FALSE(future->removeContinuation(removed));
+
+  future->set(UCS_OK);
+  ASSERT_EQ(calls, 1u);
+  ASSERT_FALSE(future->removeContinuation(kept));
+}
+
+TEST_F(NativeFutureTest, WaitAll)
+{
+  std::vector<std::shared_ptr<ucxx::NativeFuture>> futures{createFuture(), createFuture()};
+
+  futures[0]->notify(UCS_OK);
+  ASSERT_FALSE(ucxx::waitAll(futures, 1000000));
+
+  futures[1]->notify(UCS_OK);
+  ASSERT_TRUE(ucxx::waitAll(futures));
+}
+
+TEST_F(NativeFutureTest, WaitAny)
+{
+  std::vector<std::shared_ptr<ucxx::NativeFuture>> futures{createFuture(), createFuture()};
+
+  ASSERT_EQ(ucxx::waitAny({}), -1);
+  ASSERT_EQ(ucxx::waitAny(futures, 1000000), -1);
+
+  futures[1]->notify(UCS_OK);
+  ASSERT_EQ(ucxx::waitAny(futures), 1);
+}
+
+TEST_F(NativeFutureTest, WaitAnyRepeated)
+{
+  auto future = createFuture();
+  std::vector<std::shared_ptr<ucxx::NativeFuture>> futures{future, createFuture()};
+
+  // Timed out waits must not leave their continuations registered
+  for (size_t i = 0; i < 100; ++i)
+    ASSERT_EQ(ucxx::waitAny(futures, 1000), -1);
+
+  // Only the continuation registered here remains, identifiers are never reused
+  auto id = future->then([](ucs_status_t) {});
+  for (ucxx::NativeFutureCallbackId other = 1; other < id; ++other)
+    ASSERT_FALSE(future->removeContinuation(other));
+  ASSERT_TRUE(future->removeContinuation(id));
+}
+
+TEST_F(NativeFutureTest, NotifyAfterStop)
+{
+  auto future = createFuture();
+
+  _notifier->stopRequestNotifierThread();
+
+  // With the notifier thread stopped the future is set immediately by the caller
+  future->notify(UCS_OK);
+  ASSERT_TRUE(future->isCompleted());
+}
+
+TEST(NativeFutureNotifier, DestroyedFromNotifierThread)
+{
+  auto notifier = ucxx::createNativeNotifier();
+  std::weak_ptr<ucxx::Notifier> weakNotifier = notifier;
+  auto future = ucxx::createNativeFuture(notifier);
+  notifier.reset();
+
+  // The future holds the last reference to the notifier, releasing the batch of notified
+  // futures on the notifier thread destroys the notifier on its own thread.
+  future->notify(UCS_OK);
+  future.reset();
+
+  while (!weakNotifier.expired())
+    std::this_thread::yield();
+}
+
+TEST(NativeFutureWorker, FutureNotEnabled)
+{
+  auto context = ucxx::createContext({}, ucxx::Context::defaultFeatureFlags);
+  auto worker  = context->createWorker();
+
+  ASSERT_FALSE(worker->isFutureEnabled());
+  EXPECT_THROW(worker->getFuture(), std::runtime_error);
+  EXPECT_THROW(worker->runRequestNotifier(), std::runtime_error);
+}
+
+TEST_P(NativeFutureWorkerTest, TagSendRecv)
+{
+  const size_t numMessages = 16;
+  std::vector<int> send(numMessages);
+  std::vector<int> recv(numMessages, 0);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  std::vector<std::shared_ptr<ucxx::NativeFuture>> futures;
+
+  ASSERT_TRUE(_worker->isFutureEnabled());
+
+  for (size_t i = 0; i < numMessages; ++i) {
+    send[i] = i;
+    requests.push_back(_ep->tagRecv(&recv[i], sizeof(int), i, true));
+    requests.push_back(_ep->tagSend(&send[i], sizeof(int), i, true));
+  }
+
+  std::atomic<size_t> continuations{0};
+  for (const auto& request : requests) {
+    auto future = std::dynamic_pointer_cast<ucxx::NativeFuture>(request->getFutureObject());
+    ASSERT_NE(future, nullptr);
+    future->then([&continuations](ucs_status_t) { ++continuations; });
+    futures.push_back(future);
+  }
+
+  ASSERT_GE(ucxx::waitAny(futures), 0);
+  ASSERT_TRUE(ucxx::waitAll(futures));
+
+  for (const auto& future : futures)
+    ASSERT_EQ(future->getStatus(), UCS_OK);
+  for (const auto& request : requests)
+    ASSERT_TRUE(request->isCompleted());
+
+  // Continuations execute after waiters are awoken
+  while (continuations.load() < requests.size())
+    std::this_thread::yield();
+  ASSERT_EQ(recv, send);
+}
+
+INSTANTIATE_TEST_SUITE_P(DelayedSubmission,
+                         NativeFutureWorkerTest,
+                         ::testing::Values(false, true));
+
+}  // namespace
@@ -0,0 +1,136 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <sys/socket.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+TEST(HostnameResolverTest, ResolveBlocking)
+{
+  ucxx::HostnameResolver resolver(1);
+  sockaddr_storage address;
+  socklen_t length;
+
+  ASSERT_EQ(resolver.resolveBlocking("127.0.0.1", address, length), UCS_OK);
+  ASSERT_EQ(address.ss_family, AF_INET);
+  ASSERT_EQ(length, sizeof(sockaddr_in));
+  ASSERT_EQ(resolver.getCacheMisses(), 1u);
+
+  ASSERT_EQ(resolver.resolveBlocking("127.0.0.1", address, length), UCS_OK);
+  ASSERT_EQ(resolver.getCacheHits(), 1u);
+
+  ASSERT_EQ(resolver.resolveBlocking("::1", address, length), UCS_OK);
+  ASSERT_EQ(address.ss_family, AF_INET6);
+  ASSERT_EQ(length, sizeof(sockaddr_in6));
+}
+
+TEST(HostnameResolverTest, ResolveInvalid)
+{
+  ucxx::HostnameResolver resolver(1);
+  sockaddr_storage address;
+  socklen_t length;
+
+  ASSERT_EQ(resolver.resolveBlocking("invalid.hostname.invalid", address, length),
+            UCS_ERR_INVALID_ADDR);
+
+  std::promise<ucs_status_t> promise;
+  resolver.resolve("invalid.hostname.invalid",
+                   [&promise](ucs_status_t status, const sockaddr_storage&, socklen_t) {
+                     promise.set_value(status);
+                   });
+  ASSERT_EQ(promise.get_future().get(), UCS_ERR_INVALID_ADDR);
+}
+
+TEST(HostnameResolverTest, ResolveAsync)
+{
+  ucxx::HostnameResolver resolver(2);
+  const size_t numLookups = 16;
+
+  std::vector<std::promise<ucs_status_t>> promises(numLookups);
+  for (auto& promise : promises)
+    resolver.resolve("localhost",
+                     [&promise](ucs_status_t status, const sockaddr_storage&, socklen_t) {
+                       promise.set_value(status);
+                     });
+
+  for (auto& promise : promises)
+    ASSERT_EQ(promise.get_future().get(), UCS_OK);
+  ASSERT_EQ(resolver.getCacheHits() + resolver.getCacheMisses(), numLookups);
+
+  // Once resolved, lookups are served from the cache by the calling thread
+  auto hits   = resolver.getCacheHits();
+  auto caller = std::this_thread::get_id();
+  std::thread::id callbackThread;
+  resolver.resolve("localhost",
+                   [&callbackThread](ucs_status_t, const sockaddr_storage&, socklen_t) {
+                     callbackThread = std::this_thread::get_id();
+                   });
+  ASSERT_EQ(callbackThread, caller);
+  ASSERT_EQ(resolver.getCacheHits(), hits + 1);
+}
+
+TEST(HostnameResolverTest, PreferIPv4)
+{
+  ucxx::HostnameResolver resolver(1);
+  sockaddr_storage address;
+  socklen_t length;
+
+  ASSERT_EQ(resolver.resolveBlocking("localhost", address, length), UCS_OK);
+  ASSERT_EQ(address.ss_family, AF_INET);
+}
+
+TEST(HostnameResolverTest, CancelPendingOnDestruction)
+{
+  const size_t numLookups = 16;
+  std::vector<std::promise<ucs_status_t>> promises(numLookups);
+
+  {
+    ucxx::HostnameResolver resolver(1);
+    for (size_t i = 0; i < numLookups; ++i)
+      resolver.resolve("host" + std::to_string(i) + ".invalid",
+                       [&promise = promises[i]](
+                         ucs_status_t status, const sockaddr_storage&, socklen_t) {
+                         promise.set_value(status);
+                       });
+  }
+
+  // Every callback is called before the destructor returns, lookups that did not start
+  // are canceled.
+  for (auto& promise : promises) {
+    auto future = promise.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    auto status = future.get();
+    ASSERT_TRUE(status == UCS_ERR_INVALID_ADDR || status == UCS_ERR_CANCELED);
+  }
+}
+
+TEST(HostnameResolverTest, TimeToLive)
+{
+  ucxx::HostnameResolver resolver(1, std::chrono::milliseconds(1));
+  sockaddr_storage address;
+  socklen_t length;
+
+  ASSERT_EQ(resolver.resolveBlocking("127.0.0.1", address, length), UCS_OK);
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  ASSERT_EQ(resolver.resolveBlocking("127.0.0.1", address, length), UCS_OK);
+  ASSERT_EQ(resolver.getCacheHits(), 0u);
+  ASSERT_EQ(resolver.getCacheMisses(), 2u);
+
+  resolver.clearCache();
+  ASSERT_EQ(resolver.resolveBlocking("127.0.0.1", address, length), UCS_OK);
+  ASSERT_EQ(resolver.getCacheMisses(), 3u);
+}
+
+}  // namespace
@@ -18,6 +18,7 @@ enum class ProgressMode {
   Wait,
   ThreadPolling,
   ThreadBlocking,
+  ThreadAdaptive,
 };
 
 void createCudaContextCallback(void* callbackArg);
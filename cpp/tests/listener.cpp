@@ -154,6 +154,40 @@ TEST_F(ListenerTest, EndpointSendRecv)
   std::vector<int> buf{0};
 }
 
+TEST_F(ListenerTest, EndpointFromHostnameAsync)
+{
+  auto listenerContainer = createListenerContainer();
+  auto listener          = createListener(listenerContainer);
+  _worker->progress();
+
+  auto request = _worker->createEndpointFromHostnameAsync("127.0.0.1", listener->getPort());
+  while (!request->isCompleted() || listenerContainer->endpoint == nullptr)
+    _worker->progress();
+  request->checkError();
+
+  auto ep = request->getEndpoint();
+  ASSERT_NE(ep, nullptr);
+
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  std::vector<int> client_buf{123};
+  std::vector<int> server_buf{0};
+  requests.push_back(ep->tagSend(client_buf.data(), client_buf.size() * sizeof(int), 0));
+  requests.push_back(
+    listenerContainer->endpoint->tagRecv(&server_buf.front(), server_buf.size() * sizeof(int), 0));
+  ::waitRequests(_worker, requests, ::getProgressFunction(_worker, ProgressMode::Polling));
+  ASSERT_EQ(server_buf[0], client_buf[0]);
+}
+
+TEST_F(ListenerTest, EndpointFromHostnameAsyncInvalid)
+{
+  auto request = _worker->createEndpointFromHostnameAsync("invalid.hostname.invalid", 12345);
+  while (!request->isCompleted())
+    _worker->progress();
+
+  ASSERT_EQ(request->getStatus(), UCS_ERR_INVALID_ADDR);
+  ASSERT_EQ(request->getEndpoint(), nullptr);
+}
+
 TEST_F(ListenerTest, IsAlive)
 {
   auto listenerContainer = createListenerContainer();
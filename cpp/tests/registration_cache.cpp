@@ -0,0 +1,140 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+class RegistrationCacheTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+};
+
+TEST_F(RegistrationCacheTest, HitMiss)
+{
+  auto cache = _context->createRegistrationCache();
+  std::vector<char> buffer(65536);
+
+  auto memoryHandle = cache->get(buffer.data(), buffer.size());
+  ASSERT_EQ(cache->getMisses(), 1u);
+  ASSERT_EQ(cache->getHits(), 0u);
+  ASSERT_EQ(cache->getSize(), 1u);
+
+  // The same range and any range within it are served by the cached registration
+  ASSERT_EQ(cache->get(buffer.data(), buffer.size()), memoryHandle);
+  ASSERT_EQ(cache->get(buffer.data() + 1024, 4096), memoryHandle);
+  ASSERT_EQ(cache->getMisses(), 1u);
+  ASSERT_EQ(cache->getHits(), 2u);
+  ASSERT_EQ(cache->getCachedBytes(), memoryHandle->getSize());
+}
+
+TEST_F(RegistrationCacheTest, Evict)
+{
+  const size_t size = 65536;
+  std::vector<std::vector<char>> buffers(3, std::vector<char>(size));
+
+  // Registrations may be page-aligned, leave room for two of them but not three
+  auto cache = _context->createRegistrationCache(2 * size + size / 2);
+
+  cache->get(buffers[0].data(), size);
+  cache->get(buffers[1].data(), size);
+  // Make the first buffer the most recently used, evicting the second one instead
+  cache->get(buffers[0].data(), size);
+  cache->get(buffers[2].data(), size);
+
+  ASSERT_EQ(cache->getEvictions(), 1u);
+  ASSERT_LE(cache->getCachedBytes(), cache->getMaxBytes());
+
+  cache->get(buffers[0].data(), size);
+  ASSERT_EQ(cache->getHits(), 2u);
+  cache->get(buffers[1].data(), size);
+  ASSERT_EQ(cache->getMisses(), 4u);
+}
+
+TEST_F(RegistrationCacheTest, EvictAfterInvalidate)
+{
+  const size_t size = 65536;
+  std::vector<std::vector<char>> buffers(3, std::vector<char>(size));
+
+  auto cache = _context->createRegistrationCache(2 * size + size / 2);
+  ASSERT_EQ(_context->createRegistrationCache()->getMaxBytes(),
+            ucxx::RegistrationCache::defaultMaxBytes);
+
+  // Invalidating the least recently used registration leaves the next one to be evicted
+  cache->get(buffers[0].data(), size);
+  cache->get(buffers[1].data(), size);
+  ASSERT_EQ(cache->invalidate(buffers[0].data(), size), 1u);
+  cache->get(buffers[2].data(), size);
+  ASSERT_EQ(cache->getEvictions(), 0u);
+
+  cache->get(buffers[0].data(), size);
+  ASSERT_EQ(cache->getEvictions(), 1u);
+  ASSERT_EQ(cache->getSize(), 2u);
+
+  // The second buffer was evicted, the third one is still cached
+  cache->get(buffers[2].data(), size);
+  ASSERT_EQ(cache->getHits(), 1u);
+}
+
+TEST_F(RegistrationCacheTest, Oversize)
+{
+  std::vector<char> buffer(65536);
+  auto cache = _context->createRegistrationCache(1024);
+
+  auto memoryHandle = cache->get(buffer.data(), buffer.size());
+  ASSERT_NE(memoryHandle, nullptr);
+  ASSERT_EQ(cache->getSize(), 0u);
+  ASSERT_EQ(cache->getCachedBytes(), 0u);
+}
+
+TEST_F(RegistrationCacheTest, Invalidate)
+{
+  std::vector<char> buffer(65536);
+  auto cache = _context->createRegistrationCache();
+
+  auto memoryHandle = cache->get(buffer.data(), buffer.size());
+  ASSERT_EQ(cache->invalidate(buffer.data() + 1024, 1), 1u);
+  ASSERT_EQ(cache->getSize(), 0u);
+  ASSERT_EQ(cache->getCachedBytes(), 0u);
+
+  // Handles previously returned remain valid
+  ASSERT_NE(memoryHandle->getHandle(), nullptr);
+
+  cache->get(buffer.data(), buffer.size());
+  ASSERT_EQ(cache->getMisses(), 2u);
+
+  cache->clear();
+  ASSERT_EQ(cache->getSize(), 0u);
+}
+
+TEST_F(RegistrationCacheTest, ConcurrentLookups)
+{
+  const size_t numThreads = 4;
+  const size_t numLookups = 1000;
+  std::vector<char> buffer(65536);
+  auto cache = _context->createRegistrationCache();
+  cache->get(buffer.data(), buffer.size());
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < numThreads; ++t)
+    threads.emplace_back([&]() {
+      for (size_t i = 0; i < numLookups; ++i)
+        cache->get(buffer.data() + i % 1024, 1024);
+    });
+  for (auto& t : threads)
+    t.join();
+
+  ASSERT_EQ(cache->getHits(), numThreads * numLookups);
+  ASSERT_EQ(cache->getMisses(), 1u);
+  ASSERT_EQ(cache->getSize(), 1u);
+}
+
+}  // namespace
@@ -4,7 +4,11 @@
  */
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -60,11 +64,13 @@ class RequestTest
     if (_progressMode == ProgressMode::Blocking) {
       _worker->initBlockingProgressMode();
     } else if (_progressMode == ProgressMode::ThreadPolling ||
-               _progressMode == ProgressMode::ThreadBlocking) {
+               _progressMode == ProgressMode::ThreadBlocking ||
+               _progressMode == ProgressMode::ThreadAdaptive) {
       _worker->setProgressThreadStartCallback(::createCudaContextCallback, nullptr);
 
       if (_progressMode == ProgressMode::ThreadPolling) _worker->startProgressThread(true);
       if (_progressMode == ProgressMode::ThreadBlocking) _worker->startProgressThread(false);
+      if (_progressMode == ProgressMode::ThreadAdaptive) _worker->startAdaptiveProgressThread();
     }
 
     _progressWorker = getProgressFunction(_worker, _progressMode);
@@ -134,6 +140,77 @@ class RequestTest
   }
 };
 
+TEST_P(RequestTest, ProgressAm)
+{
+  const size_t numMessages = 4;
+
+  allocate(numMessages, false);
+
+  struct Received {
+    std::mutex mutex{};
+    std::vector<std::string> headers{};
+    std::vector<std::shared_ptr<ucxx::Buffer>> buffers{};
+  } received;
+
+  // Eager data is only valid within the handler and must be copied, rendezvous data is
+  // fetched into a buffer from the allocator that the handler takes ownership of.
+  auto bufferType = _bufferType;
+  auto allocator  = [bufferType](const size_t length) {
+    return std::shared_ptr<ucxx::Buffer>(ucxx::allocateBuffer(bufferType, length));
+  };
+  auto handler = [](const ucxx::AmMessage& message, void* arg) {
+    auto received = reinterpret_cast<Received*>(arg);
+    ASSERT_EQ(message.status, UCS_OK);
+
+    auto buffer = message.buffer;
+    if (buffer == nullptr) {
+      buffer = std::make_shared<ucxx::HostBuffer>(message.length);
+      std::copy_n(reinterpret_cast<char*>(message.data),
+                  message.length,
+                  reinterpret_cast<char*>(buffer->data()));
+    }
+
+    std::lock_guard<std::mutex> lock(received->mutex);
+    received->headers.push_back(message.header);
+    received->buffers.push_back(buffer);
+  };
+  _worker->registerAmHandler(0, handler, &received, allocator);
+
+  // Submit and wait for transfers to complete
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (size_t i = 0; i < numMessages; ++i)
+    requests.push_back(_ep->amSend(0, std::to_string(i), _sendPtr[i], _messageSize));
+  waitRequests(_worker, requests, _progressWorker);
+
+  auto numReceived = [&received]() {
+    std::lock_guard<std::mutex> lock(received.mutex);
+    return received.buffers.size();
+  };
+  while (numReceived() < numMessages) {
+    if (_progressWorker)
+      _progressWorker();
+    else
+      std::this_thread::yield();
+  }
+
+  // Rendezvous data may complete out of order, messages are identified by their headers
+  _recvPtr.resize(_numBuffers);
+  for (size_t i = 0; i < numMessages; ++i) {
+    auto buffer = received.buffers[i];
+    ASSERT_EQ(buffer->getSize(), _messageSize);
+    _recvPtr[std::stoul(received.headers[i])] = buffer->data();
+  }
+
+  copyResults();
+
+  // Assert data correctness
+  for (size_t i = 0; i < numMessages; ++i)
+    ASSERT_THAT(_recv[i], ContainerEq(_send[i]));
+
+  // Remove the handler before its argument goes out of scope
+  _worker->registerAmHandler(0, nullptr);
+}
+
 TEST_P(RequestTest, ProgressStream)
 {
   allocate();
@@ -166,6 +243,171 @@ TEST_P(RequestTest, ProgressTag)
   ASSERT_THAT(_recv[0], ContainerEq(_send[0]));
 }
 
+TEST_P(RequestTest, ProgressTagBatch)
+{
+  const size_t numBatch = 8;
+
+  allocate(numBatch);
+
+  std::vector<size_t> batchSize(numBatch, _messageSize);
+  std::vector<ucp_tag_t> batchTag(numBatch);
+  std::iota(batchTag.begin(), batchTag.end(), 0);
+
+  // Submit and wait for transfers to complete
+  auto requests     = _ep->tagSendBatch(_sendPtr, batchSize, batchTag);
+  auto recvRequests = _ep->tagRecvBatch(_recvPtr, batchSize, batchTag);
+  ASSERT_EQ(requests.size(), numBatch);
+  ASSERT_EQ(recvRequests.size(), numBatch);
+  requests.insert(requests.end(), recvRequests.begin(), recvRequests.end());
+  waitRequests(_worker, requests, _progressWorker);
+
+  copyResults();
+
+  // Assert data correctness
+  for (size_t i = 0; i < numBatch; ++i)
+    ASSERT_THAT(_recv[i], ContainerEq(_send[i]));
+}
+
+TEST_P(RequestTest, ProgressTagBatchMismatchedSizes)
+{
+  allocate(2);
+
+  std::vector<size_t> batchSize(2, _messageSize);
+  std::vector<ucp_tag_t> batchTag(1, 0);
+
+  EXPECT_THROW(_ep->tagSendBatch(_sendPtr, batchSize, batchTag), std::runtime_error);
+  EXPECT_THROW(_worker->tagRecvBatch(_recvPtr, batchSize, batchTag), std::runtime_error);
+}
+
+TEST_P(RequestTest, ProgressTagMasked)
+{
+  const size_t numMessages = 4;
+  const ucxx::TagMask upperMask{0xffffffff00000000};
+  const ucp_tag_t peerTag = 1ull << 32;
+
+  allocate(numMessages);
+
+  // Each receive matches any message whose upper 32 bits identify the peer
+  std::vector<std::shared_ptr<ucxx::RequestTag>> recvRequests;
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (size_t i = 0; i < numMessages; ++i) {
+    recvRequests.push_back(_ep->tagRecv(_recvPtr[i], _messageSize, peerTag, upperMask));
+    requests.push_back(recvRequests.back());
+  }
+
+  // Submit and wait for transfers to complete
+  for (size_t i = 0; i < numMessages; ++i)
+    requests.push_back(_ep->tagSend(_sendPtr[i], _messageSize, peerTag | i));
+  waitRequests(_worker, requests, _progressWorker);
+
+  copyResults();
+
+  // Assert data correctness, messages with the same tag mask are matched in order
+  for (size_t i = 0; i < numMessages; ++i) {
+    ASSERT_EQ(recvRequests[i]->getSenderTag(), peerTag | i);
+    ASSERT_THAT(_recv[i], ContainerEq(_send[i]));
+  }
+}
+
+TEST_P(RequestTest, ProgressTagRecvUpTo)
+{
+  allocate();
+
+  // Receive into a buffer larger than the message
+  auto recvBuffer = std::unique_ptr<ucxx::Buffer>(
+    ucxx::allocateBuffer(_bufferType, _messageSize + sizeof(int)));
+  _recvPtr[0] = recvBuffer->data();
+
+  // Submit and wait for transfers to complete
+  auto recvRequest = _ep->tagRecvUpTo(_recvPtr[0], recvBuffer->getSize(), 0);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(_ep->tagSend(_sendPtr[0], _messageSize, 0));
+  requests.push_back(recvRequest);
+  waitRequests(_worker, requests, _progressWorker);
+
+  ASSERT_EQ(recvRequest->getReceivedLength(), _messageSize);
+
+  copyResults();
+
+  // Assert data correctness
+  ASSERT_THAT(_recv[0], ContainerEq(_send[0]));
+}
+
+TEST_P(RequestTest, ProgressTagRecvUpToTruncated)
+{
+  if (_messageLength == 0) GTEST_SKIP() << "An empty message cannot be truncated";
+
+  allocate();
+
+  // Submit and wait for transfers to complete, the message is larger than the receive buffer
+  auto sendRequest = _ep->tagSend(_sendPtr[0], _messageSize, 0);
+  auto recvRequest = _ep->tagRecvUpTo(_recvPtr[0], _messageSize - sizeof(int), 0);
+  waitRequests(_worker, {sendRequest}, _progressWorker);
+  while (!recvRequest->isCompleted())
+    if (_progressWorker) _progressWorker();
+
+  ASSERT_EQ(recvRequest->getStatus(), UCS_ERR_MESSAGE_TRUNCATED);
+  EXPECT_THROW(recvRequest->checkError(), ucxx::MessageTruncatedError);
+}
+
+TEST_P(RequestTest, ProgressTagRecvAnySize)
+{
+  if (_progressMode == ProgressMode::Wait) {
+    GTEST_SKIP() << "Interrupting UCP worker progress operation in wait mode is not possible";
+  }
+
+  const size_t numMessages = 4;
+
+  allocate(numMessages, false);
+
+  auto bufferType = _bufferType;
+  auto allocator  = [bufferType](const size_t length) {
+    return std::shared_ptr<ucxx::Buffer>(ucxx::allocateBuffer(bufferType, length));
+  };
+
+  // Receives are posted before the messages are sent and must match in order
+  std::vector<std::shared_ptr<ucxx::RequestTagAnySize>> recvRequests;
+  for (size_t i = 0; i < numMessages; ++i)
+    recvRequests.push_back(_ep->tagRecvAnySize(0, false, nullptr, nullptr, allocator));
+
+  // Submit and wait for transfers to complete
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (size_t i = 0; i < numMessages; ++i)
+    requests.push_back(_ep->tagSend(_sendPtr[i], _messageSize, 0));
+  requests.insert(requests.end(), recvRequests.begin(), recvRequests.end());
+  waitRequests(_worker, requests, _progressWorker);
+
+  _recvPtr.resize(_numBuffers);
+  for (size_t i = 0; i < numMessages; ++i) {
+    auto buffer = recvRequests[i]->getRecvBuffer();
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_EQ(buffer->getType(), _bufferType);
+    ASSERT_EQ(buffer->getSize(), _messageSize);
+    ASSERT_EQ(recvRequests[i]->getReceivedLength(), _messageSize);
+    _recvPtr[i] = buffer->data();
+  }
+
+  copyResults();
+
+  // Assert data correctness
+  for (size_t i = 0; i < numMessages; ++i)
+    ASSERT_THAT(_recv[i], ContainerEq(_send[i]));
+}
+
+TEST_P(RequestTest, ProgressTagRecvAnySizeCancel)
+{
+  auto recvRequest = _worker->tagRecvAnySize(0);
+
+  // Progress without blocking, the message is never sent
+  if (_progressWorker) _worker->progress();
+  ASSERT_FALSE(recvRequest->isCompleted());
+
+  recvRequest->cancel();
+  ASSERT_TRUE(recvRequest->isCompleted());
+  ASSERT_EQ(recvRequest->getStatus(), UCS_ERR_CANCELED);
+  ASSERT_EQ(recvRequest->getRecvBuffer(), nullptr);
+}
+
 TEST_P(RequestTest, ProgressTagMulti)
 {
   if (_progressMode == ProgressMode::Wait) {
@@ -220,14 +462,17 @@ INSTANTIATE_TEST_SUITE_P(ProgressModes,
                                         ProgressMode::Blocking,
                                         // ProgressMode::Wait,  // Hangs on Stream
                                         ProgressMode::ThreadPolling,
-                                        ProgressMode::ThreadBlocking),
+                                        ProgressMode::ThreadBlocking,
+                                        ProgressMode::ThreadAdaptive),
                                  Values(1, 1024, 1048576)));
 
 INSTANTIATE_TEST_SUITE_P(DelayedSubmission,
                          RequestTest,
                          Combine(Values(ucxx::BufferType::Host),
                                  Values(true),
-                                 Values(ProgressMode::ThreadPolling, ProgressMode::ThreadBlocking),
+                                 Values(ProgressMode::ThreadPolling,
+                                        ProgressMode::ThreadBlocking,
+                                        ProgressMode::ThreadAdaptive),
                                  Values(1, 1024, 1048576)));
 
 #if UCXX_ENABLE_RMM
@@ -239,14 +484,17 @@ INSTANTIATE_TEST_SUITE_P(RMMProgressModes,
                                         ProgressMode::Blocking,
                                         // ProgressMode::Wait,  // Hangs on Stream
                                         ProgressMode::ThreadPolling,
-                                        ProgressMode::ThreadBlocking),
+                                        ProgressMode::ThreadBlocking,
+                                        ProgressMode::ThreadAdaptive),
                                  Values(1, 1024, 1048576)));
 
 INSTANTIATE_TEST_SUITE_P(RMMDelayedSubmission,
                          RequestTest,
                          Combine(Values(ucxx::BufferType::RMM),
                                  Values(true),
-                                 Values(ProgressMode::ThreadPolling, ProgressMode::ThreadBlocking),
+                                 Values(ProgressMode::ThreadPolling,
+                                        ProgressMode::ThreadBlocking,
+                                        ProgressMode::ThreadAdaptive),
                                  Values(1, 1024, 1048576)));
 #endif
 
@@ -0,0 +1,255 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+#include <ucxx/request_pool.h>
+
+#include "include/utils.h"
+
+namespace {
+
+// Allocations are only counted on the thread that enabled counting, thus allocations
+// performed by other tests or threads are unaffected.
+thread_local bool countAllocations{false};
+std::atomic<size_t> allocationCount{0};
+
+}  // namespace
+
+void* operator new(size_t size)
+{
+  if (countAllocations) ++allocationCount;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+class AllocationCounter {
+ public:
+  AllocationCounter()
+  {
+    allocationCount  = 0;
+    countAllocations = true;
+  }
+
+  ~AllocationCounter() { countAllocations = false; }
+
+  size_t get() const { return allocationCount.load(); }
+};
+
+class RequestPoolTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::RequestPool> _pool{std::make_shared<ucxx::RequestPool>(4)};
+};
+
+TEST_F(RequestPoolTest, ReuseBlocks)
+{
+  void* ptr = _pool->allocate(100);
+  _pool->deallocate(ptr, 100);
+  ASSERT_EQ(_pool->getCachedBlocks(), 1u);
+
+  // Allocations of the same size class reuse the cached block
+  ASSERT_EQ(_pool->allocate(120), ptr);
+  ASSERT_EQ(_pool->getCachedBlocks(), 0u);
+  _pool->deallocate(ptr, 120);
+}
+
+TEST_F(RequestPoolTest, MaxCachedBlocks)
+{
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < 8; ++i)
+    blocks.push_back(_pool->allocate(64));
+  for (auto block : blocks)
+    _pool->deallocate(block, 64);
+
+  ASSERT_EQ(_pool->getCachedBlocks(), 4u);
+}
+
+TEST_F(RequestPoolTest, LargeAllocationsNotCached)
+{
+  void* ptr = _pool->allocate(1 << 20);
+  _pool->deallocate(ptr, 1 << 20);
+
+  ASSERT_EQ(_pool->getCachedBlocks(), 0u);
+}
+
+TEST_F(RequestPoolTest, AllocatorHeadroom)
+{
+  constexpr size_t headroom = 2 * __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+  void* allocation          = nullptr;
+  ucxx::RequestPoolAllocator<int> allocator(_pool, headroom, &allocation);
+
+  // The headroom precedes the allocation within the same pooled block
+  int* ptr = allocator.allocate(1);
+  ASSERT_EQ(allocation, ptr);
+  allocator.deallocate(ptr, 1);
+  ASSERT_EQ(_pool->getCachedBlocks(), 1u);
+
+  void* block = _pool->allocate(headroom + sizeof(int));
+  ASSERT_EQ(static_cast<char*>(block) + headroom, static_cast<void*>(ptr));
+  _pool->deallocate(block, headroom + sizeof(int));
+}
+
+class RequestAllocationTest : public ::testing::TestWithParam<bool> {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  std::function<void()> _progressWorker;
+
+  void SetUp()
+  {
+    // Delayed submissions are only processed by the worker progress thread
+    const bool enableDelayedSubmission = GetParam();
+    _worker = _context->createWorker(enableDelayedSubmission);
+    if (enableDelayedSubmission) {
+      _worker->startProgressThread(true);
+      _progressWorker = []() {};
+    } else {
+      _progressWorker = getProgressFunction(_worker, ProgressMode::Polling);
+    }
+    _ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  }
+
+  void TearDown()
+  {
+    if (_worker->isProgressThreadRunning()) _worker->stopProgressThread();
+  }
+
+  std::shared_ptr<ucxx::Request> submittedTagRecv(std::vector<int>& recv)
+  {
+    auto request = _ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0);
+    while (request->getHandle() == nullptr)
+      _progressWorker();
+    return request;
+  }
+
+  void transfer(std::vector<int>& send, std::vector<int>& recv)
+  {
+    auto sendReq = _ep->tagSend(send.data(), send.size() * sizeof(int), 0);
+    auto recvReq = _ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0);
+    while (!sendReq->isCompleted() || !recvReq->isCompleted())
+      _progressWorker();
+  }
+};
+
+TEST_P(RequestAllocationTest, TagTransferSteadyState)
+{
+  std::vector<int> send{123};
+  std::vector<int> recv(1);
+
+  // Warm up the request pool and UCX internal resources
+  for (size_t i = 0; i < 10; ++i)
+    transfer(send, recv);
+
+  size_t allocations = 0;
+  {
+    AllocationCounter counter;
+    for (size_t i = 0; i < 100; ++i)
+      transfer(send, recv);
+    allocations = counter.get();
+  }
+
+  ASSERT_EQ(allocations, 0u);
+  ASSERT_EQ(recv[0], send[0]);
+  ASSERT_GT(_worker->getRequestPool()->getCachedBlocks(), 0u);
+}
+
+TEST_P(RequestAllocationTest, TagTransferUserRequestMemory)
+{
+  _worker->setUserRequestMemory(true);
+  ASSERT_TRUE(_worker->isUserRequestMemoryEnabled());
+
+  // Small messages may complete immediately, large messages complete via callback
+  for (const size_t length : {1, 1 << 20}) {
+    std::vector<int> send(length, 123);
+    std::vector<int> recv(length);
+
+    for (size_t i = 0; i < 10; ++i)
+      transfer(send, recv);
+
+    ASSERT_EQ(recv, send);
+  }
+}
+
+TEST_P(RequestAllocationTest, TagTransferSteadyStateUserRequestMemory)
+{
+  _worker->setUserRequestMemory(true);
+
+  std::vector<int> send{123};
+  std::vector<int> recv(1);
+
+  for (size_t i = 0; i < 10; ++i)
+    transfer(send, recv);
+
+  // UCP requests live in the same pooled block as their `ucxx::Request`
+  size_t allocations = 0;
+  {
+    AllocationCounter counter;
+    for (size_t i = 0; i < 100; ++i)
+      transfer(send, recv);
+    allocations = counter.get();
+  }
+
+  ASSERT_EQ(allocations, 0u);
+  ASSERT_EQ(recv[0], send[0]);
+}
+
+TEST_P(RequestAllocationTest, CancelUserRequestMemory)
+{
+  _worker->setUserRequestMemory(true);
+
+  std::vector<int> recv(1);
+  auto recvReq = submittedTagRecv(recv);
+
+  ASSERT_EQ(_ep->cancelInflightRequests(), 1u);
+  while (!recvReq->isCompleted())
+    _progressWorker();
+
+  ASSERT_EQ(recvReq->getStatus(), UCS_ERR_CANCELED);
+}
+
+TEST_P(RequestAllocationTest, UserRequestMemoryHandleInBlock)
+{
+  _worker->setUserRequestMemory(true);
+
+  // A receive posted before its message arrives does not complete immediately
+  std::vector<int> send{123};
+  std::vector<int> recv(1);
+  auto recvReq = submittedTagRecv(recv);
+
+  // The UCP request handle is the allocation immediately following the headroom of the
+  // pooled block, with UCX's request occupying the headroom, thus UCX allocated nothing.
+  auto handle  = reinterpret_cast<uintptr_t>(recvReq->getHandle());
+  auto request = reinterpret_cast<uintptr_t>(recvReq.get());
+  ASSERT_LE(handle, request);
+  ASSERT_LT(request - handle, 64u);
+
+  auto sendReq = _ep->tagSend(send.data(), send.size() * sizeof(int), 0);
+  while (!sendReq->isCompleted() || !recvReq->isCompleted())
+    _progressWorker();
+  ASSERT_EQ(recvReq->getStatus(), UCS_OK);
+  ASSERT_EQ(recv[0], send[0]);
+}
+
+INSTANTIATE_TEST_SUITE_P(DelayedSubmission,
+                         RequestAllocationTest,
+                         ::testing::Values(false, true));
+
+}  // namespace
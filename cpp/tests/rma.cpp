@@ -0,0 +1,181 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+#include "include/utils.h"
+
+namespace {
+
+using ::testing::ContainerEq;
+
+class RmaTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  std::function<void()> _progressWorker;
+
+  void SetUp()
+  {
+    _worker         = _context->createWorker();
+    _progressWorker = getProgressFunction(_worker, ProgressMode::Polling);
+    _ep             = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  }
+};
+
+TEST_F(RmaTest, MemoryHandleAllocate)
+{
+  const size_t size = 1024;
+  auto memoryHandle = _context->createMemoryHandle(size, nullptr);
+
+  ASSERT_NE(memoryHandle->getHandle(), nullptr);
+  ASSERT_NE(memoryHandle->getBaseAddress(), 0u);
+  ASSERT_GE(memoryHandle->getSize(), size);
+  ASSERT_EQ(memoryHandle->getMemoryType(), UCS_MEMORY_TYPE_HOST);
+}
+
+TEST_F(RmaTest, MemoryHandleMapBuffer)
+{
+  std::vector<int> buffer(1024);
+  const size_t size = buffer.size() * sizeof(int);
+  auto memoryHandle = _context->createMemoryHandle(size, buffer.data());
+
+  auto address = reinterpret_cast<uint64_t>(buffer.data());
+  ASSERT_LE(memoryHandle->getBaseAddress(), address);
+  ASSERT_GE(memoryHandle->getBaseAddress() + memoryHandle->getSize(), address + size);
+}
+
+TEST_F(RmaTest, RemoteKeySerialize)
+{
+  auto memoryHandle = _context->createMemoryHandle(1024, nullptr);
+  auto localKey     = memoryHandle->createRemoteKey();
+  ASSERT_EQ(localKey->getHandle(), nullptr);
+
+  auto remoteKey = ucxx::createRemoteKeyFromSerialized(_ep, localKey->serialize());
+  ASSERT_NE(remoteKey->getHandle(), nullptr);
+  ASSERT_EQ(remoteKey->getBaseAddress(), memoryHandle->getBaseAddress());
+  ASSERT_EQ(remoteKey->getSize(), memoryHandle->getSize());
+  ASSERT_EQ(remoteKey->serialize(), localKey->serialize());
+}
+
+TEST_F(RmaTest, RemoteKeyMalformed)
+{
+  auto memoryHandle = _context->createMemoryHandle(1024, nullptr);
+  auto serialized   = memoryHandle->createRemoteKey()->serialize();
+
+  EXPECT_THROW(ucxx::createRemoteKeyFromSerialized(_ep, serialized.substr(0, 4)),
+               std::runtime_error);
+  EXPECT_THROW(ucxx::createRemoteKeyFromSerialized(_ep, serialized + "0"), std::runtime_error);
+}
+
+TEST_F(RmaTest, PutGet)
+{
+  const size_t length = 1024;
+  std::vector<int> remote(length, 0), send(length), recv(length, 0);
+  std::iota(send.begin(), send.end(), 0);
+  const size_t size = length * sizeof(int);
+
+  // The remote memory is mapped by the same process, accessed through the endpoint to self
+  auto memoryHandle = _context->createMemoryHandle(size, remote.data());
+  auto remoteKey =
+    ucxx::createRemoteKeyFromSerialized(_ep, memoryHandle->createRemoteKey()->serialize());
+  auto remoteAddress = reinterpret_cast<uint64_t>(remote.data());
+
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(_ep->put(send.data(), size, remoteAddress, remoteKey));
+  requests.push_back(_ep->flush());
+  waitRequests(_worker, requests, _progressWorker);
+  ASSERT_THAT(remote, ContainerEq(send));
+
+  requests.clear();
+  requests.push_back(_ep->get(recv.data(), size, remoteAddress, remoteKey));
+  waitRequests(_worker, requests, _progressWorker);
+  ASSERT_THAT(recv, ContainerEq(send));
+}
+
+TEST_F(RmaTest, PutOutOfRange)
+{
+  std::vector<int> buffer(1024);
+  auto memoryHandle = _context->createMemoryHandle(1024, nullptr);
+  auto remoteKey =
+    ucxx::createRemoteKeyFromSerialized(_ep, memoryHandle->createRemoteKey()->serialize());
+
+  EXPECT_THROW(_ep->put(buffer.data(),
+                        buffer.size() * sizeof(int),
+                        remoteKey->getBaseAddress() + remoteKey->getSize(),
+                        remoteKey),
+               std::out_of_range);
+}
+
+TEST_F(RmaTest, Atomic)
+{
+  uint64_t remote   = 0;
+  auto memoryHandle = _context->createMemoryHandle(sizeof(remote), &remote);
+  auto remoteKey =
+    ucxx::createRemoteKeyFromSerialized(_ep, memoryHandle->createRemoteKey()->serialize());
+  auto remoteAddress = reinterpret_cast<uint64_t>(&remote);
+
+  auto run = [this](std::shared_ptr<ucxx::Request> request) {
+    std::vector<std::shared_ptr<ucxx::Request>> requests{request};
+    waitRequests(_worker, requests, _progressWorker);
+  };
+
+  uint64_t result = 0;
+  run(_ep->atomicAdd(5, remoteAddress, remoteKey));
+  run(_ep->flush());
+  run(_ep->fetchAdd(3, &result, remoteAddress, remoteKey));
+  ASSERT_EQ(result, 5u);
+  ASSERT_EQ(remote, 8u);
+
+  run(_ep->compareSwap(7, 42, &result, remoteAddress, remoteKey));
+  ASSERT_EQ(result, 8u);
+  ASSERT_EQ(remote, 8u);
+
+  run(_ep->compareSwap(8, 42, &result, remoteAddress, remoteKey));
+  ASSERT_EQ(result, 8u);
+  ASSERT_EQ(remote, 42u);
+
+  run(_ep->swap(1, &result, remoteAddress, remoteKey));
+  ASSERT_EQ(result, 42u);
+  ASSERT_EQ(remote, 1u);
+}
+
+TEST_F(RmaTest, AtomicOutOfRange)
+{
+  uint64_t result   = 0;
+  auto memoryHandle = _context->createMemoryHandle(1024, nullptr);
+  auto remoteKey =
+    ucxx::createRemoteKeyFromSerialized(_ep, memoryHandle->createRemoteKey()->serialize());
+
+  EXPECT_THROW(
+    _ep->fetchAdd(1, &result, remoteKey->getBaseAddress() + remoteKey->getSize(), remoteKey),
+    std::out_of_range);
+}
+
+TEST_F(RmaTest, AtomicFetchWithoutResult)
+{
+  uint64_t remote   = 0;
+  auto memoryHandle = _context->createMemoryHandle(sizeof(remote), &remote);
+  auto remoteKey =
+    ucxx::createRemoteKeyFromSerialized(_ep, memoryHandle->createRemoteKey()->serialize());
+  auto remoteAddress = reinterpret_cast<uint64_t>(&remote);
+
+  EXPECT_THROW(_ep->fetchAdd(1, nullptr, remoteAddress, remoteKey), std::invalid_argument);
+  EXPECT_THROW(_ep->compareSwap(0, 1, nullptr, remoteAddress, remoteKey), std::invalid_argument);
+  EXPECT_THROW(_ep->swap(1, nullptr, remoteAddress, remoteKey), std::invalid_argument);
+}
+
+}  // namespace
@@ -2,13 +2,18 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <atomic>
 #include <memory>
+#include <stdexcept>
+#include <thread>
 #include <tuple>
 #include <vector>
 
 #include <gtest/gtest.h>
+#include <sched.h>
 
 #include <ucxx/api.h>
+#include <ucxx/utils/affinity.h>
 
 #include "include/utils.h"
 
@@ -45,6 +50,8 @@ class WorkerProgressTest : public WorkerTest,
       _worker->startProgressThread(true);
     else if (_progressMode == ProgressMode::ThreadBlocking)
       _worker->startProgressThread(false);
+    else if (_progressMode == ProgressMode::ThreadAdaptive)
+      _worker->startAdaptiveProgressThread();
 
     _progressWorker = getProgressFunction(_worker, _progressMode);
   }
@@ -72,6 +79,181 @@ TEST_F(WorkerTest, TagProbe)
   ASSERT_TRUE(_worker->tagProbe(0));
 }
 
+TEST_F(WorkerTest, TagProbeMasked)
+{
+  auto progressWorker = getProgressFunction(_worker, ProgressMode::Polling);
+  auto ep             = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  const ucxx::TagMask upperMask{0xffffffff00000000};
+  const ucp_tag_t tag = (1ull << 32) | 7;
+
+  std::vector<int> buf{123};
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(ep->tagSend(buf.data(), buf.size() * sizeof(int), tag));
+  waitRequests(_worker, requests, progressWorker);
+
+  for (size_t i = 0; i < 10 && !_worker->tagProbe(tag); ++i)
+    progressWorker();
+
+  ucp_tag_t senderTag = 0;
+  ASSERT_FALSE(_worker->tagProbe(1ull << 32));
+  ASSERT_FALSE(_worker->tagProbe(2ull << 32, upperMask));
+  ASSERT_TRUE(_worker->tagProbe(1ull << 32, upperMask, &senderTag));
+  ASSERT_EQ(senderTag, tag);
+}
+
+TEST_F(WorkerTest, CompletionQueue)
+{
+  auto progressWorker = getProgressFunction(_worker, ProgressMode::Polling);
+
+  ASSERT_FALSE(_worker->isCompletionQueueEnabled());
+  std::vector<ucxx::Completion> completions(4);
+  EXPECT_THROW(_worker->pollCompletions(completions.data(), completions.size()),
+               std::runtime_error);
+
+  _worker->enableCompletionQueue(2);
+  ASSERT_TRUE(_worker->isCompletionQueueEnabled());
+
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  const size_t numMessages = 3;
+  std::vector<int> send(numMessages), recv(numMessages, 0);
+  std::vector<std::shared_ptr<size_t>> contexts;
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (size_t i = 0; i < numMessages; ++i) {
+    send[i] = i;
+    contexts.push_back(std::make_shared<size_t>(i));
+    requests.push_back(ep->tagRecv(&recv[i], sizeof(int), i, false, nullptr, contexts.back()));
+    // Requests without callback data, or with a callback function, are not queued
+    requests.push_back(ep->tagSend(&send[i], sizeof(int), i));
+  }
+  auto callbackData = std::make_shared<size_t>(numMessages);
+  requests.push_back(
+    ep->tagSend(&send[0], sizeof(int), 0, false, [](std::shared_ptr<void>) {}, callbackData));
+  requests.push_back(ep->tagRecv(&recv[0], sizeof(int), 0));
+  waitRequests(_worker, requests, progressWorker);
+
+  std::vector<bool> completed(numMessages, false);
+  size_t numPolled = 0;
+  while (size_t n = _worker->pollCompletions(completions.data(), completions.size())) {
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(completions[i].status, UCS_OK);
+      ASSERT_EQ(completions[i].length, sizeof(int));
+      auto index = *std::static_pointer_cast<size_t>(completions[i].context);
+      ASSERT_LT(index, numMessages);
+      completed[index] = true;
+    }
+    numPolled += n;
+  }
+
+  ASSERT_EQ(numPolled, numMessages);
+  ASSERT_EQ(completed, std::vector<bool>(numMessages, true));
+  ASSERT_EQ(recv, send);
+}
+
+TEST_F(WorkerTest, CompletionQueueShortMessage)
+{
+  auto progressWorker = getProgressFunction(_worker, ProgressMode::Polling);
+
+  _worker->enableCompletionQueue(2);
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  // The completion reports the length received, not the size of the buffer posted
+  std::vector<int> send{1, 2}, recv(8, 0);
+  auto context = std::make_shared<size_t>(0);
+  std::vector<std::shared_ptr<ucxx::Request>> requests{
+    ep->tagRecvUpTo(recv.data(), recv.size() * sizeof(int), 0, false, nullptr, context),
+    ep->tagSend(send.data(), send.size() * sizeof(int), 0)};
+  waitRequests(_worker, requests, progressWorker);
+
+  std::vector<ucxx::Completion> completions(2);
+  ASSERT_EQ(_worker->pollCompletions(completions.data(), completions.size()), 1u);
+  ASSERT_EQ(completions[0].context, context.get());
+  ASSERT_EQ(completions[0].status, UCS_OK);
+  ASSERT_EQ(completions[0].length, send.size() * sizeof(int));
+  ASSERT_EQ(std::vector<int>(recv.begin(), recv.begin() + send.size()), send);
+}
+
+TEST_F(WorkerTest, ProgressThreadCpuAffinity)
+{
+  std::atomic<int> progressThreadCpu{-1};
+  _worker->setProgressThreadStartCallback(
+    [](void* arg) { reinterpret_cast<std::atomic<int>*>(arg)->store(sched_getcpu()); },
+    &progressThreadCpu);
+
+  // Pin to a CPU the process is allowed to run on, CPU 0 may be excluded by cpusets
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+  int cpu = -1;
+  for (int i = CPU_SETSIZE - 1; i >= 0 && cpu == -1; --i)
+    if (CPU_ISSET(i, &allowed)) cpu = i;
+  ASSERT_NE(cpu, -1);
+
+  _worker->startProgressThread(true, {static_cast<size_t>(cpu)});
+
+  // The start callback runs after the thread has been pinned
+  while (progressThreadCpu.load() == -1)
+    std::this_thread::yield();
+  ASSERT_EQ(progressThreadCpu.load(), cpu);
+  ASSERT_EQ(_worker->getNumaNode(), ucxx::utils::getCpuNumaNode(cpu));
+
+  _worker->stopProgressThread();
+  ASSERT_EQ(_worker->getNumaNode(), -1);
+}
+
+TEST_F(WorkerTest, ProgressThreadInvalidCpuAffinity)
+{
+  EXPECT_THROW(_worker->startProgressThread(true, {CPU_SETSIZE}), std::invalid_argument);
+  ASSERT_FALSE(_worker->isProgressThreadRunning());
+  ASSERT_EQ(_worker->getNumaNode(), -1);
+}
+
+TEST_F(WorkerTest, CoalesceWakeupsPolling)
+{
+  const size_t numSubmissions = 1000;
+  std::atomic<size_t> processed{0};
+
+  _worker = _context->createWorker(true);
+  _worker->startProgressThread(true);
+
+  for (size_t i = 0; i < numSubmissions; ++i)
+    _worker->registerDelayedSubmission([&processed]() { ++processed; });
+
+  while (processed.load() < numSubmissions)
+    std::this_thread::yield();
+
+  // A polling progress thread never sleeps, thus it never needs to be signaled
+  ASSERT_EQ(_worker->getSignalsIssued(), 0);
+  ASSERT_EQ(_worker->getSignalsSuppressed(), numSubmissions);
+
+  _worker->stopProgressThread();
+}
+
+TEST_F(WorkerTest, CoalesceWakeupsBlocking)
+{
+  const size_t numBursts      = 10;
+  const size_t numSubmissions = 100;
+  std::atomic<size_t> processed{0};
+
+  _worker = _context->createWorker(true);
+  _worker->startProgressThread(false);
+
+  for (size_t b = 1; b <= numBursts; ++b) {
+    for (size_t i = 0; i < numSubmissions; ++i)
+      _worker->registerDelayedSubmission([&processed]() { ++processed; });
+
+    // Each burst must be processed, waking the progress thread if it was sleeping
+    while (processed.load() < b * numSubmissions)
+      std::this_thread::yield();
+  }
+
+  // Every submission either issued or suppressed a signal, and no wakeup was lost
+  ASSERT_EQ(_worker->getSignalsIssued() + _worker->getSignalsSuppressed(),
+            numBursts * numSubmissions);
+
+  _worker->stopProgressThread();
+}
+
 TEST_P(WorkerProgressTest, ProgressStream)
 {
   auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
@@ -151,11 +333,14 @@ INSTANTIATE_TEST_SUITE_P(ProgressModes,
                                         ProgressMode::Blocking,
                                         ProgressMode::Wait,
                                         ProgressMode::ThreadPolling,
-                                        ProgressMode::ThreadBlocking)));
+                                        ProgressMode::ThreadBlocking,
+                                        ProgressMode::ThreadAdaptive)));
 
-INSTANTIATE_TEST_SUITE_P(
-  DelayedSubmission,
-  WorkerProgressTest,
-  Combine(Values(true), Values(ProgressMode::ThreadPolling, ProgressMode::ThreadBlocking)));
+INSTANTIATE_TEST_SUITE_P(DelayedSubmission,
+                         WorkerProgressTest,
+                         Combine(Values(true),
+                                 Values(ProgressMode::ThreadPolling,
+                                        ProgressMode::ThreadBlocking,
+                                        ProgressMode::ThreadAdaptive)));
 
 }  // namespace
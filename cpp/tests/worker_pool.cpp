@@ -0,0 +1,222 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+#include "include/utils.h"
+
+namespace {
+
+struct FanInServer {
+  std::shared_ptr<ucxx::WorkerPool> workerPool{nullptr};
+  std::mutex mutex{};
+  std::vector<std::shared_ptr<ucxx::Endpoint>> endpoints{};
+};
+
+static void fanInListenerCallback(ucp_conn_request_h connRequest, void* arg)
+{
+  auto server   = reinterpret_cast<FanInServer*>(arg);
+  auto endpoint = server->workerPool->createEndpointFromConnRequest(connRequest);
+
+  std::lock_guard<std::mutex> lock(server->mutex);
+  server->endpoints.push_back(endpoint);
+}
+
+class WorkerPoolTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  const size_t _numWorkers{4};
+};
+
+TEST_F(WorkerPoolTest, Size)
+{
+  auto workerPool = _context->createWorkerPool(_numWorkers);
+
+  ASSERT_EQ(workerPool->size(), _numWorkers);
+  for (size_t i = 0; i < _numWorkers; ++i)
+    ASSERT_TRUE(workerPool->getWorker(i)->getHandle() != nullptr);
+  ASSERT_THROW(workerPool->getWorker(_numWorkers), std::out_of_range);
+}
+
+TEST_F(WorkerPoolTest, NoWorkers)
+{
+  ASSERT_THROW(_context->createWorkerPool(0), std::invalid_argument);
+}
+
+TEST_F(WorkerPoolTest, RoundRobin)
+{
+  auto workerPool =
+    _context->createWorkerPool(_numWorkers, false, ucxx::WorkerPoolPlacement::RoundRobin);
+
+  for (size_t i = 0; i < _numWorkers * 2; ++i)
+    ASSERT_EQ(workerPool->selectWorker(), workerPool->getWorker(i % _numWorkers));
+}
+
+TEST_F(WorkerPoolTest, PeerHash)
+{
+  auto workerPool =
+    _context->createWorkerPool(_numWorkers, false, ucxx::WorkerPoolPlacement::PeerHash);
+
+  auto worker = workerPool->selectWorker("10.10.10.10:12345");
+  for (size_t i = 0; i < _numWorkers * 2; ++i)
+    ASSERT_EQ(workerPool->selectWorker("10.10.10.10:12345"), worker);
+}
+
+TEST_F(WorkerPoolTest, LeastLoaded)
+{
+  auto workerPool =
+    _context->createWorkerPool(_numWorkers, false, ucxx::WorkerPoolPlacement::LeastLoaded);
+  auto address = workerPool->getWorker(0)->getAddress();
+
+  std::vector<std::shared_ptr<ucxx::Endpoint>> endpoints;
+  for (size_t i = 0; i < _numWorkers; ++i)
+    endpoints.push_back(workerPool->createEndpointFromWorkerAddress(address));
+
+  // Each worker gets exactly one endpoint
+  for (size_t i = 0; i < _numWorkers; ++i) {
+    ASSERT_EQ(workerPool->getEndpointCount(i), 1);
+    ASSERT_EQ(endpoints[i]->getParent(), workerPool->getWorker(i));
+  }
+
+  // Releasing an endpoint makes its worker the least loaded
+  endpoints[2] = nullptr;
+  ASSERT_EQ(workerPool->getEndpointCount(2), 0);
+  ASSERT_EQ(workerPool->selectWorker(), workerPool->getWorker(2));
+}
+
+TEST_F(WorkerPoolTest, LeastInflight)
+{
+  auto workerPool =
+    _context->createWorkerPool(_numWorkers, false, ucxx::WorkerPoolPlacement::LeastInflight);
+  auto address = workerPool->getWorker(0)->getAddress();
+
+  // Idle workers are selected in round-robin order
+  std::vector<std::shared_ptr<ucxx::Endpoint>> endpoints;
+  for (size_t i = 0; i < _numWorkers; ++i) {
+    endpoints.push_back(workerPool->createEndpointFromWorkerAddress(address));
+    ASSERT_EQ(endpoints[i]->getParent(), workerPool->getWorker(i));
+  }
+
+  // Post receives that never complete on all workers but the third
+  std::vector<int> buffer(1);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (size_t i = 0; i < _numWorkers; ++i)
+    if (i != 2) requests.push_back(endpoints[i]->tagRecv(buffer.data(), sizeof(int), 1234));
+
+  for (size_t i = 0; i < _numWorkers; ++i)
+    ASSERT_EQ(workerPool->getInflightRequestCount(i), i == 2 ? 0 : 1);
+  ASSERT_EQ(workerPool->selectWorker(), workerPool->getWorker(2));
+
+  for (auto& endpoint : endpoints)
+    endpoint->cancelInflightRequests();
+}
+
+TEST_F(WorkerPoolTest, ListenerFanIn)
+{
+  const size_t numClients = _numWorkers * 2;
+
+  FanInServer server;
+  server.workerPool = _context->createWorkerPool(_numWorkers);
+  server.workerPool->startProgressThreads(false);
+  auto listener = server.workerPool->createListener(0, fanInListenerCallback, &server);
+
+  auto clientWorker = _context->createWorker();
+  clientWorker->startProgressThread(false);
+  std::vector<std::shared_ptr<ucxx::Endpoint>> clients;
+  for (size_t i = 0; i < numClients; ++i)
+    clients.push_back(clientWorker->createEndpointFromHostname("127.0.0.1", listener->getPort()));
+
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(server.mutex);
+      if (server.endpoints.size() == numClients) break;
+    }
+    std::this_thread::yield();
+  }
+
+  // Connections accepted by a single listener are spread across all workers
+  for (size_t i = 0; i < _numWorkers; ++i)
+    ASSERT_EQ(server.workerPool->getEndpointCount(i), numClients / _numWorkers);
+
+  std::vector<std::vector<int>> send(numClients), recv(numClients);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (size_t i = 0; i < numClients; ++i) {
+    send[i] = std::vector<int>{static_cast<int>(i)};
+    recv[i] = std::vector<int>{-1};
+    requests.push_back(server.endpoints[i]->tagRecv(recv[i].data(), sizeof(int), 0));
+    requests.push_back(clients[i]->tagSend(send[i].data(), sizeof(int), 0));
+  }
+  waitRequests(nullptr, requests, nullptr);
+
+  // Messages of clients connected to the same worker may match in any order
+  std::vector<int> received;
+  for (auto& r : recv)
+    received.push_back(r[0]);
+  std::sort(received.begin(), received.end());
+  for (size_t i = 0; i < numClients; ++i)
+    ASSERT_EQ(received[i], static_cast<int>(i));
+
+  clientWorker->stopProgressThread();
+  server.workerPool->shutdown();
+}
+
+TEST_F(WorkerPoolTest, TransferProgressThreads)
+{
+  auto workerPool = _context->createWorkerPool(_numWorkers);
+  workerPool->startProgressThreads(false);
+
+  std::vector<std::shared_ptr<ucxx::Endpoint>> endpoints;
+  for (size_t i = 0; i < _numWorkers; ++i)
+    endpoints.push_back(workerPool->getWorker(i)->createEndpointFromWorkerAddress(
+      workerPool->getWorker(i)->getAddress()));
+
+  std::vector<std::vector<int>> send(_numWorkers), recv(_numWorkers);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (size_t i = 0; i < _numWorkers; ++i) {
+    send[i] = std::vector<int>{static_cast<int>(i)};
+    recv[i] = std::vector<int>(1);
+    requests.push_back(endpoints[i]->tagSend(send[i].data(), sizeof(int), 0));
+    requests.push_back(endpoints[i]->tagRecv(recv[i].data(), sizeof(int), 0));
+  }
+  waitRequests(nullptr, requests, nullptr);
+
+  for (size_t i = 0; i < _numWorkers; ++i)
+    ASSERT_EQ(recv[i][0], send[i][0]);
+
+  workerPool->shutdown();
+  for (size_t i = 0; i < _numWorkers; ++i)
+    ASSERT_FALSE(workerPool->getWorker(i)->isProgressThreadRunning());
+}
+
+TEST_F(WorkerPoolTest, ShutdownCancelsInflight)
+{
+  auto workerPool = _context->createWorkerPool(_numWorkers);
+  workerPool->startProgressThreads(false);
+
+  auto endpoint =
+    workerPool->createEndpointFromWorkerAddress(workerPool->getWorker(0)->getAddress());
+
+  // Receives that are never matched, posted on an endpoint and directly on a worker
+  std::vector<int> endpointBuffer(1), workerBuffer(1);
+  auto endpointRequest = endpoint->tagRecv(endpointBuffer.data(), sizeof(int), 1);
+  auto workerRequest   = workerPool->getWorker(1)->tagRecv(workerBuffer.data(), sizeof(int), 1);
+
+  workerPool->shutdown();
+
+  for (auto& request : {endpointRequest, workerRequest}) {
+    ASSERT_TRUE(request->isCompleted());
+    ASSERT_EQ(request->getStatus(), UCS_ERR_CANCELED);
+  }
+}
+
+}  // namespace
@@ -13,13 +13,16 @@ from cpython.buffer cimport PyBUF_FORMAT, PyBUF_ND, PyBUF_WRITABLE
 from cpython.ref cimport PyObject
 from cython.operator cimport dereference as deref
 from libc.stdint cimport uintptr_t
-from libcpp cimport nullptr
+from libc.string cimport memcpy
+from libcpp cimport bool as cpp_bool, nullptr
 from libcpp.functional cimport function
 from libcpp.map cimport map as cpp_map
 from libcpp.memory cimport (
     dynamic_pointer_cast,
+    make_shared,
     make_unique,
     shared_ptr,
+    static_pointer_cast,
     unique_ptr,
 )
 from libcpp.string cimport string
@@ -418,11 +421,42 @@ cdef void _generic_callback(void *args) with gil:
         pass
 
 
+cdef void _am_handler_callback(const AmMessage& message, void* arg) with gil:
+    """Callback function called when UCXWorker receives an Active Message"""
+    cdef object cb_func = (<list> arg)[0]
+    cdef np.ndarray[np.uint8_t, ndim=1, mode="c"] data
+    cdef Buffer* buffer = message.buffer.get()
+
+    if cb_func is None:
+        # The handler was removed while the message data was being fetched
+        return
+
+    if message.status != UCS_OK:
+        logger.error(
+            f"Active Message {message.id} failed with status {message.status}"
+        )
+        return
+
+    try:
+        if buffer == NULL:
+            # Eager data is only valid within this callback and must be copied
+            data = np.empty(message.length, dtype=np.uint8)
+            memcpy(<void*>data.data, message.data, message.length)
+        else:
+            data = ptr_to_ndarray(
+                (<HostBuffer*><void*>buffer).release(), message.length
+            )
+        cb_func(message.id, bytes(message.header), data)
+    except Exception as e:
+        logger.error(f"{type(e)} when calling Active Message handler: {e}")
+
+
 cdef class UCXWorker():
     """Python representation of `ucp_worker_h`"""
     cdef:
         shared_ptr[Worker] _worker
         dict _progress_thread_start_cb_data
+        dict _am_handlers
         bint _enable_python_future
         uint64_t _context_feature_flags
 
@@ -443,6 +477,7 @@ cdef class UCXWorker():
             self._enable_python_future = self._worker.get().isFutureEnabled()
 
         self._context_feature_flags = <uint64_t>(context.feature_flags)
+        self._am_handlers = {}
 
     @property
     def handle(self):
@@ -484,10 +519,30 @@ cdef class UCXWorker():
             self, address, endpoint_error_handling
         )
 
+    def create_endpoint_pool(self, size_t max_size=1024, double idle_timeout=60.0):
+        return UCXEndpointPool.create(self, max_size, idle_timeout)
+
     def init_blocking_progress_mode(self):
         with nogil:
             self._worker.get().initBlockingProgressMode()
 
+    def arm(self):
+        cdef bint armed
+
+        with nogil:
+            armed = self._worker.get().arm()
+
+        return armed
+
+    @property
+    def epoll_file_descriptor(self):
+        cdef int epoll_file_descriptor
+
+        with nogil:
+            epoll_file_descriptor = self._worker.get().getEpollFileDescriptor()
+
+        return epoll_file_descriptor
+
     def progress(self):
         with nogil:
             self._worker.get().progress()
@@ -528,6 +583,43 @@ cdef class UCXWorker():
 
         return tag_matched
 
+    def register_am_handler(self, unsigned id, cb_func):
+        """Register a handler of Active Messages sent with identifier `id`.
+
+        `cb_func(id, header, data)` is called from the thread progressing the worker
+        with each message received, where `header` is `bytes` and `data` a host NumPy
+        array owning the message data. Passing `None` removes the handler.
+        """
+        if not self._context_feature_flags & Feature.AM.value:
+            raise ValueError("UCXContext must be created with `Feature.AM`")
+
+        cdef function[void(const AmMessage&, void*)]* func_am_handler_callback = (
+            new function[void(const AmMessage&, void*)]()
+        )
+        cdef void* cb_arg = NULL
+        cdef list holder
+
+        # Rendezvous data still being fetched may call a handler after it has been
+        # replaced, thus each identifier has a single holder referring to its current
+        # handler, kept alive for the lifetime of the worker.
+        holder = self._am_handlers.setdefault(id, [None])
+        holder[0] = cb_func
+
+        if cb_func is not None:
+            del func_am_handler_callback
+            func_am_handler_callback = new function[void(const AmMessage&, void*)](
+                _am_handler_callback
+            )
+            cb_arg = <void*>holder
+
+        try:
+            with nogil:
+                self._worker.get().registerAmHandler(
+                    id, deref(func_am_handler_callback), cb_arg
+                )
+        finally:
+            del func_am_handler_callback
+
     def set_progress_thread_start_callback(
             self, cb_func, tuple cb_args=None, dict cb_kwargs=None
     ):
@@ -568,6 +660,15 @@ cdef class UCXWorker():
         with nogil:
             self._worker.get().runRequestNotifier()
 
+    @property
+    def request_notifier_file_descriptor(self):
+        cdef int fd
+
+        with nogil:
+            fd = self._worker.get().getRequestNotifierFileDescriptor()
+
+        return fd
+
     def populate_python_futures_pool(self):
         with nogil:
             self._worker.get().populateFuturesPool()
@@ -644,7 +745,15 @@ cdef class UCXRequest():
 
     async def wait(self):
         if self._enable_python_future:
-            await self.get_future()
+            future = self.get_future()
+            if not future.done() and self.is_completed():
+                # Request completed before its future was notified, which happens
+                # when it completes immediately while the worker is progressed by the
+                # event loop thread. Check the status directly and mark a future
+                # exception as retrieved, since the future is not awaited.
+                future.add_done_callback(lambda f: f.cancelled() or f.exception())
+                return self.check_error()
+            await future
         else:
             await self.wait_yield()
 
@@ -781,7 +890,12 @@ cdef class UCXBufferRequests:
 
     async def wait(self):
         if self._enable_python_future:
-            await self.get_future()
+            future = self.get_future()
+            if not future.done() and self.is_completed():
+                # See `UCXRequest.wait()`.
+                future.add_done_callback(lambda f: f.cancelled() or f.exception())
+                return self.check_error()
+            await future
         else:
             await self.wait_yield()
 
@@ -960,6 +1074,26 @@ cdef class UCXEndpoint():
 
         return UCXRequest(<uintptr_t><void*>&req, self._enable_python_future)
 
+    def am_send(self, unsigned id, bytes header, Array arr):
+        cdef void* buf = <void*>arr.ptr
+        cdef size_t nbytes = arr.nbytes
+        cdef string cpp_header = header
+        cdef shared_ptr[Request] req
+
+        if not self._context_feature_flags & Feature.AM.value:
+            raise ValueError("UCXContext must be created with `Feature.AM`")
+
+        with nogil:
+            req = self._endpoint.get().amSend(
+                id,
+                cpp_header,
+                buf,
+                nbytes,
+                self._enable_python_future
+            )
+
+        return UCXRequest(<uintptr_t><void*>&req, self._enable_python_future)
+
     def tag_send(self, Array arr, size_t tag):
         cdef void* buf = <void*>arr.ptr
         cdef size_t nbytes = arr.nbytes
@@ -996,6 +1130,57 @@ cdef class UCXEndpoint():
 
         return UCXRequest(<uintptr_t><void*>&req, self._enable_python_future)
 
+    cdef list _tag_batch(self, bint send, tuple arrays, tuple tags):
+        cdef vector[void*] v_buffer
+        cdef vector[size_t] v_size
+        cdef vector[ucp_tag_t] v_tag
+        cdef vector[shared_ptr[Request]] reqs
+        cdef size_t i
+
+        if not self._context_feature_flags & Feature.TAG.value:
+            raise ValueError("UCXContext must be created with `Feature.TAG`")
+
+        for arr in arrays:
+            if not isinstance(arr, Array):
+                raise ValueError(
+                    "All elements of the `arrays` should be of `Array` type"
+                )
+
+        if len(arrays) != len(tags):
+            raise ValueError("`arrays` and `tags` should be of equal length")
+
+        for arr, tag in zip(arrays, tags):
+            v_buffer.push_back(<void*><uintptr_t>arr.ptr)
+            v_size.push_back(arr.nbytes)
+            v_tag.push_back(tag)
+
+        with nogil:
+            if send:
+                reqs = self._endpoint.get().tagSendBatch(
+                    v_buffer,
+                    v_size,
+                    v_tag,
+                    self._enable_python_future,
+                )
+            else:
+                reqs = self._endpoint.get().tagRecvBatch(
+                    v_buffer,
+                    v_size,
+                    v_tag,
+                    self._enable_python_future,
+                )
+
+        return [
+            UCXRequest(<uintptr_t><void*>&reqs[i], self._enable_python_future)
+            for i in range(reqs.size())
+        ]
+
+    def tag_send_batch(self, tuple arrays, tuple tags):
+        return self._tag_batch(True, arrays, tags)
+
+    def tag_recv_batch(self, tuple arrays, tuple tags):
+        return self._tag_batch(False, arrays, tags)
+
     def tag_send_multi(self, tuple arrays, size_t tag):
         cdef vector[void*] v_buffer
         cdef vector[size_t] v_size
@@ -1072,6 +1257,189 @@ cdef class UCXEndpoint():
         del func_close_callback
 
 
+cdef object _endpoint_pool_user_data(shared_ptr[void] user_data):
+    """Convert data released with a pooled endpoint back to a tuple of integers"""
+    if user_data.get() == NULL:
+        return None
+    return tuple(deref(static_pointer_cast[vector[uint64_t], void](user_data)))
+
+
+cdef class UCXEndpointPool():
+    """Pool of reusable endpoints of a `UCXWorker`"""
+    cdef:
+        shared_ptr[EndpointPool] _endpoint_pool
+        bint _enable_python_future
+        uint64_t _context_feature_flags
+
+    def __init__(
+            self,
+            uintptr_t shared_ptr_endpoint_pool,
+            bint enable_python_future,
+            uint64_t context_feature_flags
+    ):
+        self._endpoint_pool = deref(<shared_ptr[EndpointPool] *> shared_ptr_endpoint_pool)
+        self._enable_python_future = enable_python_future
+        self._context_feature_flags = context_feature_flags
+
+    @classmethod
+    def create(
+            cls,
+            UCXWorker worker,
+            size_t max_size=1024,
+            double idle_timeout=60.0,
+    ):
+        cdef shared_ptr[Context] context
+        cdef shared_ptr[EndpointPool] endpoint_pool
+        cdef int64_t idle_timeout_ms = <int64_t>(idle_timeout * 1000)
+        cdef uint64_t context_feature_flags
+
+        with nogil:
+            endpoint_pool = worker._worker.get().createEndpointPool(
+                max_size, milliseconds(idle_timeout_ms)
+            )
+            context = dynamic_pointer_cast[Context, Component](
+                worker._worker.get().getParent()
+            )
+            context_feature_flags = context.get().getFeatureFlags()
+
+        return cls(
+            <uintptr_t><void*>&endpoint_pool,
+            worker.is_python_future_enabled(),
+            context_feature_flags
+        )
+
+    def get_from_hostname(
+            self,
+            str ip_address,
+            uint16_t port,
+            bint endpoint_error_handling=True
+    ):
+        """Get an endpoint to a listener, reusing an idle one if available
+
+        Returns
+        -------
+        tuple
+            The ``UCXEndpoint``, whether it was reused from the pool and the
+            ``user_data`` it was released with, ``None`` if not reused.
+        """
+        cdef shared_ptr[Endpoint] endpoint
+        cdef string addr = ip_address.encode("utf-8")
+        cdef cpp_bool reused = False
+        cdef shared_ptr[void] user_data
+
+        with nogil:
+            endpoint = self._endpoint_pool.get().getFromHostname(
+                addr, port, endpoint_error_handling, &reused, &user_data
+            )
+
+        return (
+            UCXEndpoint(
+                <uintptr_t><void*>&endpoint,
+                self._enable_python_future,
+                self._context_feature_flags
+            ),
+            reused,
+            _endpoint_pool_user_data(user_data),
+        )
+
+    def get_from_worker_address(
+            self,
+            UCXAddress address,
+            bint endpoint_error_handling=True
+    ):
+        """Get an endpoint to a worker, reusing an idle one if available
+
+        Returns
+        -------
+        tuple
+            The ``UCXEndpoint``, whether it was reused from the pool and the
+            ``user_data`` it was released with, ``None`` if not reused.
+        """
+        cdef shared_ptr[Endpoint] endpoint
+        cdef shared_ptr[Address] ucxx_address = address._address
+        cdef cpp_bool reused = False
+        cdef shared_ptr[void] user_data
+
+        with nogil:
+            endpoint = self._endpoint_pool.get().getFromWorkerAddress(
+                ucxx_address, endpoint_error_handling, &reused, &user_data
+            )
+
+        return (
+            UCXEndpoint(
+                <uintptr_t><void*>&endpoint,
+                self._enable_python_future,
+                self._context_feature_flags
+            ),
+            reused,
+            _endpoint_pool_user_data(user_data),
+        )
+
+    def release(self, UCXEndpoint endpoint, tuple user_data=None):
+        """Return an endpoint to the pool for later reuse
+
+        Endpoints that errored, were closed or still have inflight requests
+        are closed instead, canceling their requests.
+
+        Parameters
+        ----------
+        endpoint: UCXEndpoint
+            The endpoint obtained from the pool.
+        user_data: tuple of int, optional
+            Unsigned 64-bit integers kept with the idle endpoint, returned when
+            it is reused and discarded when it leaves the pool otherwise.
+        """
+        cdef shared_ptr[Endpoint] ucxx_endpoint = endpoint._endpoint
+        cdef shared_ptr[vector[uint64_t]] data
+        cdef shared_ptr[void] ucxx_user_data
+
+        if user_data is not None:
+            data = make_shared[vector[uint64_t]]()
+            for value in user_data:
+                data.get().push_back(value)
+            ucxx_user_data = static_pointer_cast[void, vector[uint64_t]](data)
+
+        with nogil:
+            self._endpoint_pool.get().release(ucxx_endpoint, ucxx_user_data)
+
+    def evict_idle(self):
+        cdef size_t evicted
+
+        with nogil:
+            evicted = self._endpoint_pool.get().evictIdle()
+
+        return evicted
+
+    def clear(self):
+        with nogil:
+            self._endpoint_pool.get().clear()
+
+    @property
+    def hits(self):
+        return self._endpoint_pool.get().getHits()
+
+    @property
+    def misses(self):
+        return self._endpoint_pool.get().getMisses()
+
+    @property
+    def evictions(self):
+        return self._endpoint_pool.get().getEvictions()
+
+    @property
+    def size(self):
+        cdef size_t size
+
+        with nogil:
+            size = self._endpoint_pool.get().getSize()
+
+        return size
+
+    @property
+    def max_size(self):
+        return self._endpoint_pool.get().getMaxSize()
+
+
 cdef void _listener_callback(ucp_conn_request_h conn_request, void *args) with gil:
     """Callback function used by UCXListener"""
     cdef dict cb_data = <dict> args
@@ -0,0 +1,76 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+# SPDX-License-Identifier: BSD-3-Clause
+
+import numpy as np
+import pytest
+
+from ucxx._lib import libucxx as ucx_api
+from ucxx._lib.arr import Array
+from ucxx.testing import wait_requests
+
+
+@pytest.mark.parametrize("msg_size", [10, 2**24])
+def test_am_send_recv(msg_size):
+    ctx = ucx_api.UCXContext(
+        feature_flags=(ucx_api.Feature.AM, ucx_api.Feature.WAKEUP)
+    )
+    worker = ucx_api.UCXWorker(ctx)
+
+    received = []
+
+    def _am_handler(id, header, data):
+        received.append((id, header, data))
+
+    worker.register_am_handler(1, _am_handler)
+
+    address = ucx_api.UCXAddress.create_from_worker(worker)
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker, address, endpoint_error_handling=True
+    )
+
+    send_msg = np.arange(msg_size, dtype=np.uint8)
+    wait_requests(worker, "blocking", ep.am_send(1, b"header", Array(send_msg)))
+
+    while len(received) == 0:
+        worker.progress()
+
+    id, header, data = received[0]
+    assert id == 1
+    assert header == b"header"
+    np.testing.assert_array_equal(data, send_msg)
+
+    worker.register_am_handler(1, None)
+
+
+def test_am_requires_feature():
+    ctx = ucx_api.UCXContext(feature_flags=(ucx_api.Feature.TAG,))
+    worker = ucx_api.UCXWorker(ctx)
+
+    with pytest.raises(ValueError, match="Feature.AM"):
+        worker.register_am_handler(1, lambda *args: None)
+
+
+def test_am_replace_handler():
+    ctx = ucx_api.UCXContext(
+        feature_flags=(ucx_api.Feature.AM, ucx_api.Feature.WAKEUP)
+    )
+    worker = ucx_api.UCXWorker(ctx)
+
+    received = []
+    for i in range(10):
+        worker.register_am_handler(1, lambda id, header, data, i=i: received.append(i))
+
+    address = ucx_api.UCXAddress.create_from_worker(worker)
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker, address, endpoint_error_handling=True
+    )
+
+    wait_requests(worker, "blocking", ep.am_send(1, b"", Array(bytearray(10))))
+
+    while len(received) == 0:
+        worker.progress()
+
+    # Only the latest handler registered for the identifier is called
+    assert received == [9]
+
+    worker.register_am_handler(1, None)
@@ -0,0 +1,54 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+# SPDX-License-Identifier: BSD-3-Clause
+
+import numpy as np
+import pytest
+
+from ucxx._lib import libucxx as ucx_api
+from ucxx._lib.arr import Array
+from ucxx.testing import wait_requests
+
+
+@pytest.mark.parametrize("msg_size", [10, 2**24])
+def test_tag_batch(msg_size):
+    ctx = ucx_api.UCXContext(feature_flags=(ucx_api.Feature.TAG,))
+    worker = ucx_api.UCXWorker(ctx)
+
+    address = ucx_api.UCXAddress.create_from_worker(worker)
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker, address, endpoint_error_handling=True
+    )
+
+    num_messages = 4
+    tags = tuple(range(num_messages))
+    send_msgs = [np.full(msg_size, i, dtype=np.uint8) for i in range(num_messages)]
+    recv_msgs = [np.empty(msg_size, dtype=np.uint8) for _ in range(num_messages)]
+
+    # Receive in reverse order to verify each message matches by its own tag
+    recv_requests = ep.tag_recv_batch(
+        tuple(Array(m) for m in reversed(recv_msgs)), tuple(reversed(tags))
+    )
+    send_requests = ep.tag_send_batch(tuple(Array(m) for m in send_msgs), tags)
+    assert len(send_requests) == num_messages
+    assert len(recv_requests) == num_messages
+
+    wait_requests(worker, "blocking", send_requests + recv_requests)
+
+    for send_msg, recv_msg in zip(send_msgs, recv_msgs):
+        np.testing.assert_array_equal(recv_msg, send_msg)
+
+
+def test_tag_batch_length_mismatch():
+    ctx = ucx_api.UCXContext(feature_flags=(ucx_api.Feature.TAG,))
+    worker = ucx_api.UCXWorker(ctx)
+
+    address = ucx_api.UCXAddress.create_from_worker(worker)
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker, address, endpoint_error_handling=True
+    )
+
+    msg = Array(bytearray(10))
+    with pytest.raises(ValueError, match="equal length"):
+        ep.tag_send_batch((msg, msg), (0,))
+    with pytest.raises(ValueError, match="equal length"):
+        ep.tag_recv_batch((msg,), (0, 1))
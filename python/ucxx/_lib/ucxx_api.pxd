@@ -25,6 +25,11 @@ cdef extern from "Python.h" nogil:
     ctypedef struct PyObject
 
 
+cdef extern from "<chrono>" namespace "std::chrono" nogil:
+    cdef cppclass milliseconds:
+        milliseconds(int64_t)
+
+
 cdef extern from "numpy/arrayobject.h" nogil:
     void PyArray_ENABLEFLAGS(np.ndarray arr, int flags)
 
@@ -214,10 +219,15 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
         shared_ptr[Endpoint] createEndpointFromWorkerAddress(
             shared_ptr[Address] address, bint endpoint_error_handling
         ) except +raise_py_error
+        shared_ptr[EndpointPool] createEndpointPool(
+            size_t max_size, milliseconds idle_timeout
+        ) except +raise_py_error
         shared_ptr[Listener] createListener(
             uint16_t port, ucp_listener_conn_callback_t callback, void *callback_args
         ) except +raise_py_error
         void initBlockingProgressMode() except +raise_py_error
+        bint arm() except +raise_py_error
+        int getEpollFileDescriptor()
         void progress()
         bint progressOnce()
         void progressWorkerEvent()
@@ -225,6 +235,11 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
         void stopProgressThread() except +raise_py_error
         size_t cancelInflightRequests() except +raise_py_error
         bint tagProbe(ucp_tag_t)
+        void registerAmHandler(
+            unsigned id,
+            function[void(const AmMessage&, void*)] handler,
+            void* handlerArg
+        ) except +raise_py_error
         void setProgressThreadStartCallback(
             function[void(void*)] callback, void* callbackArg
         )
@@ -233,6 +248,7 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
             uint64_t periodNs
         ) except +raise_py_error
         void runRequestNotifier() except +raise_py_error
+        int getRequestNotifierFileDescriptor() except +raise_py_error
         void populateFuturesPool() except +raise_py_error
         shared_ptr[Request] tagRecv(
             void* buffer, size_t length, ucp_tag_t tag, bint enable_python_future
@@ -242,6 +258,13 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
     cdef cppclass Endpoint(Component):
         ucp_ep_h getHandle()
         void close()
+        shared_ptr[Request] amSend(
+            unsigned id,
+            const string& header,
+            void* buffer,
+            size_t length,
+            bint enable_python_future
+        ) except +raise_py_error
         shared_ptr[Request] streamSend(
             void* buffer, size_t length, bint enable_python_future
         ) except +raise_py_error
@@ -254,6 +277,18 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
         shared_ptr[Request] tagRecv(
             void* buffer, size_t length, ucp_tag_t tag, bint enable_python_future
         ) except +raise_py_error
+        vector[shared_ptr[Request]] tagSendBatch(
+            const vector[void*]& buffers,
+            const vector[size_t]& lengths,
+            const vector[ucp_tag_t]& tags,
+            bint enable_python_future
+        ) except +raise_py_error
+        vector[shared_ptr[Request]] tagRecvBatch(
+            const vector[void*]& buffers,
+            const vector[size_t]& lengths,
+            const vector[ucp_tag_t]& tags,
+            bint enable_python_future
+        ) except +raise_py_error
         shared_ptr[RequestTagMulti] tagMultiSend(
             const vector[void*]& buffer,
             const vector[size_t]& length,
@@ -270,6 +305,31 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
             function[void(void*)] close_callback, void* close_callback_arg
         )
 
+    cdef cppclass EndpointPool(Component):
+        shared_ptr[Endpoint] getFromHostname(
+            string ip_address,
+            uint16_t port,
+            bint endpoint_error_handling,
+            cpp_bool* reused,
+            shared_ptr[void]* user_data
+        ) except +raise_py_error
+        shared_ptr[Endpoint] getFromWorkerAddress(
+            shared_ptr[Address] address,
+            bint endpoint_error_handling,
+            cpp_bool* reused,
+            shared_ptr[void]* user_data
+        ) except +raise_py_error
+        void release(
+            shared_ptr[Endpoint] endpoint, shared_ptr[void] user_data
+        ) except +raise_py_error
+        size_t evictIdle() except +raise_py_error
+        void clear() except +raise_py_error
+        uint64_t getHits()
+        uint64_t getMisses()
+        uint64_t getEvictions()
+        size_t getSize()
+        size_t getMaxSize()
+
     cdef cppclass Listener(Component):
         shared_ptr[Endpoint] createEndpointFromConnRequest(
             ucp_conn_request_h conn_request, bint endpoint_error_handling
@@ -289,6 +349,17 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
         void* getFuture() except +raise_py_error
 
 
+cdef extern from "<ucxx/request_am.h>" namespace "ucxx" nogil:
+
+    cdef cppclass AmMessage:
+        unsigned id
+        ucs_status_t status
+        string header
+        void* data
+        size_t length
+        shared_ptr[Buffer] buffer
+
+
 cdef extern from "<ucxx/request_tag_multi.h>" namespace "ucxx" nogil:
 
     ctypedef struct BufferRequest:
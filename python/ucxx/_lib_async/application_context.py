@@ -3,18 +3,16 @@
 
 import logging
 import os
-import threading
 import weakref
-from queue import Queue
 
 import ucxx._lib.libucxx as ucx_api
 from ucxx._lib.arr import Array
 
-from .continuous_ucx_progress import PollingMode, ThreadMode
-from .endpoint import Endpoint
+from .continuous_ucx_progress import BlockingMode, PollingMode, ThreadMode
+from .endpoint import _POOLED_TAG_NAMES, Endpoint
 from .exchange_peer_info import exchange_peer_info
 from .listener import ActiveClients, Listener, _listener_handler
-from .notifier_thread import _notifierThread
+from .notifier_thread import _notifier_event_callback
 from .utils import get_event_loop, hash64bits
 
 logger = logging.getLogger("ucx")
@@ -33,10 +31,10 @@ class ApplicationContext:
         enable_python_future=None,
     ):
         self.progress_tasks = []
-        self.notifier_thread_q = None
-        self.notifier_thread = None
+        self.notifier_event_loop = None
         self._listener_active_clients = ActiveClients()
         self._next_listener_id = 0
+        self.endpoint_pool = None
 
         self.progress_mode = ApplicationContext._check_progress_mode(progress_mode)
 
@@ -72,7 +70,7 @@ class ApplicationContext:
             else:
                 progress_mode = "thread"
 
-        valid_progress_modes = ["polling", "thread", "thread-polling"]
+        valid_progress_modes = ["blocking", "polling", "thread", "thread-polling"]
         if not isinstance(progress_mode, str) or not any(
             progress_mode == m for m in valid_progress_modes
         ):
@@ -107,7 +105,11 @@ class ApplicationContext:
         else:
             explicit_enable_python_future = enable_python_future
 
-        if not progress_mode.startswith("thread") and explicit_enable_python_future:
+        if (
+            not progress_mode.startswith("thread")
+            and progress_mode != "blocking"
+            and explicit_enable_python_future
+        ):
             logger.warning(
                 f"Notifier thread requested, but {progress_mode} does not "
                 "support it, using Python wait_yield()."
@@ -116,47 +118,59 @@ class ApplicationContext:
         return explicit_enable_python_future
 
     def start_notifier_thread(self):
-        if self.worker.is_python_future_enabled():
-            logger.debug("UCXX_ENABLE_PYTHON available, enabling notifier thread")
-            loop = get_event_loop()
-            self.notifier_thread_q = Queue()
-            self.notifier_thread = threading.Thread(
-                target=_notifierThread,
-                args=(loop, self.worker, self.notifier_thread_q),
-                name="UCX-Py Async Notifier Thread",
+        if self.progress_mode == "blocking":
+            logger.debug("Python futures are notified by the event loop")
+        elif self.worker.is_python_future_enabled():
+            logger.debug("UCXX_ENABLE_PYTHON available, enabling notifier")
+            # Completed futures are notified directly by the event loop when the
+            # notifier signals its file descriptor, no notifier thread is required.
+            self.notifier_event_loop = get_event_loop()
+            self.worker.populate_python_futures_pool()
+            self.notifier_event_loop.add_reader(
+                self.worker.request_notifier_file_descriptor,
+                _notifier_event_callback,
+                self.worker,
             )
-            self.notifier_thread.start()
         else:
             logger.debug(
                 "UCXX not compiled with UCXX_ENABLE_PYTHON, disabling notifier thread"
             )
 
-    def stop_notifier_thread(self):
-        """
-        Stop Python future notifier thread
+    def populate_python_futures_pool(self):
+        """Refill the Python futures pool before submitting requests.
 
-        Stop the notifier thread if context is running with Python future
-        notification enabled via `UCXPY_ENABLE_PYTHON_FUTURE=1` or
-        `ucxx.init(..., enable_python_future=True)`.
+        The notifier refills the pool only when completions are notified, thus a
+        burst of submissions without completions in between could otherwise drain
+        it, forcing each new request to fill it on the spot. Does nothing if the
+        pool is at least half full or Python futures are disabled.
+        """
+        if self.worker.is_python_future_enabled():
+            self.worker.populate_python_futures_pool()
 
-        .. warning:: When the notifier thread is enabled it may be necessary to
-                     explicitly call this method before shutting down the process or
-                     or application, otherwise it may block indefinitely waiting for
-                     the thread to terminate. Executing `ucxx.reset()` will also run
-                     this method, so it's not necessary to have both.
+    def stop_notifier_thread(self):
         """
-        if self.notifier_thread_q and self.notifier_thread:
-            self.notifier_thread_q.put("shutdown")
-            while True:
-                # Having a timeout is required. During the notifier thread shutdown
-                # it may require the GIL, which will cause a deadlock with the `join()`
-                # call otherwise.
-                self.notifier_thread.join(timeout=0.01)
-                if not self.notifier_thread.is_alive():
-                    break
-            logger.debug("Notifier thread stopped")
+        Stop Python future notifier
+
+        Stop the notifier if context is running with Python future notification
+        enabled via `UCXPY_ENABLE_PYTHON_FUTURE=1` or
+        `ucxx.init(..., enable_python_future=True)`, unregistering the notifier's
+        file descriptor from the event loop.
+
+        .. warning:: When the notifier is enabled it may be necessary to explicitly
+                     call this method before closing the event loop, otherwise the
+                     notifier's file descriptor remains registered with it.
+                     Executing `ucxx.reset()` will also run this method, so it's not
+                     necessary to have both.
+        """
+        if self.notifier_event_loop is not None:
+            if not self.notifier_event_loop.is_closed():
+                self.notifier_event_loop.remove_reader(
+                    self.worker.request_notifier_file_descriptor
+                )
+            self.notifier_event_loop = None
+            logger.debug("Notifier stopped")
         else:
-            logger.debug("Notifier thread not running")
+            logger.debug("Notifier not running")
 
     def create_listener(
         self,
@@ -221,6 +235,39 @@ class ApplicationContext:
         )
         return ret
 
+    def enable_endpoint_pool(self, max_size=1024, idle_timeout=60.0):
+        """Reuse endpoints created with `create_endpoint()`
+
+        Once enabled, closing an endpoint created with `create_endpoint()`
+        returns it to the pool instead of closing it, and subsequent calls to
+        `create_endpoint()` for the same server reuse it if it is still alive,
+        skipping endpoint creation and the exchange of peer information.
+
+        Since a reused connection is not established again, the server's
+        listener callback is not called again for it. The server handler must
+        thus keep serving the endpoint it was given for as long as the client
+        may reuse the connection, rather than returning after serving a single
+        client-side ``Endpoint``.
+
+        Parameters
+        ----------
+        max_size: int, optional
+            Maximum number of idle endpoints kept, the least recently released
+            are closed beyond that.
+        idle_timeout: float, optional
+            Time in seconds after which idle endpoints are closed.
+
+        Returns
+        -------
+        UCXEndpointPool
+            The endpoint pool
+        """
+        if self.endpoint_pool is None:
+            self.endpoint_pool = self.worker.create_endpoint_pool(
+                max_size, idle_timeout
+            )
+        return self.endpoint_pool
+
     async def create_endpoint(self, ip_address, port, endpoint_error_handling=True):
         """Create a new endpoint to a server
 
@@ -240,13 +287,37 @@ class ApplicationContext:
         Returns
         -------
         Endpoint
-            The new endpoint
+            The new endpoint, or an idle endpoint to the same server if
+            `enable_endpoint_pool()` was called
         """
         self.continuous_ucx_progress()
 
-        ucx_ep = ucx_api.UCXEndpoint.create(
-            self.worker, ip_address, port, endpoint_error_handling
-        )
+        if self.endpoint_pool is not None:
+            while True:
+                ucx_ep, reused, pooled_tags = self.endpoint_pool.get_from_hostname(
+                    ip_address, port, endpoint_error_handling
+                )
+                if not reused:
+                    break
+                if pooled_tags is not None:
+                    tags = dict(zip(_POOLED_TAG_NAMES, pooled_tags))
+                    logger.debug("create_endpoint() reused: %s" % hex(ucx_ep.handle))
+                    return Endpoint(
+                        endpoint=ucx_ep, ctx=self, tags=tags, pool=self.endpoint_pool
+                    )
+
+                # The endpoint was released to the pool without its tags, which can't
+                # be exchanged again with a peer that is already connected, discard it
+                # and try the next idle endpoint, or a new one.
+                logger.debug(
+                    "create_endpoint() discarding untagged: %s" % hex(ucx_ep.handle)
+                )
+                ucx_ep.close()
+                self.endpoint_pool.release(ucx_ep)
+        else:
+            ucx_ep = ucx_api.UCXEndpoint.create(
+                self.worker, ip_address, port, endpoint_error_handling
+            )
         self.worker.progress()
 
         # We create the Endpoint in three steps:
@@ -268,7 +339,7 @@ class ApplicationContext:
             "ctrl_send": peer_info["ctrl_tag"],
             "ctrl_recv": ctrl_tag,
         }
-        ep = Endpoint(endpoint=ucx_ep, ctx=self, tags=tags)
+        ep = Endpoint(endpoint=ucx_ep, ctx=self, tags=tags, pool=self.endpoint_pool)
 
         logger.debug(
             "create_endpoint() client: %s, error handling: %s, msg-tag-send: %s, "
@@ -351,6 +422,8 @@ class ApplicationContext:
             task = ThreadMode(self.worker, loop, polling_mode=True)
         elif self.progress_mode == "polling":
             task = PollingMode(self.worker, loop)
+        elif self.progress_mode == "blocking":
+            task = BlockingMode(self.worker, loop)
 
         self.progress_tasks.append(task)
 
@@ -404,5 +477,6 @@ class ApplicationContext:
         )
         logger.debug(log)
 
+        self.populate_python_futures_pool()
         req = self.worker.tag_recv(buffer, tag)
         return await req.wait()
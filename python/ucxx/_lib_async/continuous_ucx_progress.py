@@ -3,6 +3,7 @@
 
 
 import asyncio
+import weakref
 
 
 class ProgressTask(object):
@@ -70,3 +71,62 @@ class PollingMode(ProgressTask):
             worker.progress()
             # Give other co-routines a chance to run.
             await asyncio.sleep(0)
+
+
+def _blocking_mode_reader_callback(weak_task):
+    task = weak_task()
+    if task is not None:
+        task._fd_reader_callback()
+
+
+class BlockingMode(ProgressTask):
+    def __init__(self, worker, event_loop):
+        """Progress the worker from the event loop only when UCX has events
+
+        The worker's epoll file descriptor is registered with the event loop via
+        `add_reader()`, the worker is then progressed only when the file descriptor
+        becomes readable, and armed again once no more progress can be made. This
+        requires no additional threads and does not busy-loop while idle.
+
+        If Python futures are enabled, they are notified directly by the event loop
+        after each progress, thus not requiring a notifier thread either.
+        """
+        super().__init__(worker, event_loop)
+        worker.init_blocking_progress_mode()
+        epoll_fd = worker.epoll_file_descriptor
+
+        # Hold only a weak reference in the event loop, so that the reader is removed
+        # when the progress task is garbage collected.
+        event_loop.add_reader(
+            epoll_fd, _blocking_mode_reader_callback, weakref.ref(self)
+        )
+        weakref.finalize(self, event_loop.remove_reader, epoll_fd)
+
+        # Progress and arm the worker for the first time, only then the epoll file
+        # descriptor is notified of new events.
+        self._fd_reader_callback()
+
+    def _progress(self):
+        self.worker.progress()
+        if self.worker.is_python_future_enabled():
+            self.worker.populate_python_futures_pool()
+            self.worker.run_request_notifier()
+
+    def _fd_reader_callback(self):
+        self._progress()
+
+        # Arming may still be pending from a previous event, in which case it will
+        # progress the worker again before arming.
+        if self.asyncio_task is None or self.asyncio_task.done():
+            self.asyncio_task = self.event_loop.create_task(self._arm_worker())
+
+    async def _arm_worker(self):
+        # The worker can only be armed when no more progress can be made, see
+        # `ucp_worker_arm()`. Other tasks are given a chance to run in between, so
+        # that requests they submit are progressed before the event loop blocks
+        # waiting for events.
+        while True:
+            self._progress()
+            await asyncio.sleep(0)
+            if self.worker.arm():
+                break
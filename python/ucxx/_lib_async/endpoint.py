@@ -14,6 +14,9 @@ from .utils import hash64bits
 
 logger = logging.getLogger("ucx")
 
+# Order in which tags are released to the endpoint pool along with the endpoint
+_POOLED_TAG_NAMES = ("msg_send", "msg_recv", "ctrl_send", "ctrl_recv")
+
 
 class Endpoint:
     """An endpoint represents a connection to a peer
@@ -22,7 +25,7 @@ class Endpoint:
     to create an Endpoint.
     """
 
-    def __init__(self, endpoint, ctx, tags=None):
+    def __init__(self, endpoint, ctx, tags=None, pool=None):
         from .application_context import ApplicationContext
 
         if not isinstance(endpoint, ucx_api.UCXEndpoint):
@@ -38,6 +41,7 @@ class Endpoint:
         self._shutting_down_peer = False  # Told peer to shutdown
         self._close_after_n_recv = None
         self._tags = tags
+        self._pool = pool  # Pool the endpoint is returned to instead of closing
 
     def __del__(self):
         self.abort()
@@ -60,9 +64,17 @@ class Endpoint:
         """
         if self._ep is not None:
             logger.debug("Endpoint.abort(): %s" % hex(self.uid))
-            self._ep.close()
+            if self._pool is not None:
+                # The pool discards and closes endpoints that are not alive or have
+                # inflight requests, the tags are kept with the endpoint for reuse.
+                self._pool.release(
+                    self._ep, tuple(self._tags[name] for name in _POOLED_TAG_NAMES)
+                )
+            else:
+                self._ep.close()
         self._ep = None
         self._ctx = None
+        self._pool = None
 
     async def close(self):
         """Close the endpoint cleanly.
@@ -130,6 +142,7 @@ class Endpoint:
         self._send_count += 1
 
         try:
+            self._ctx.populate_python_futures_pool()
             request = self._ep.tag_send(buffer, tag)
             return await request.wait()
         except UCXCanceled as e:
@@ -182,6 +195,7 @@ class Endpoint:
         self._send_count += 1
 
         try:
+            self._ctx.populate_python_futures_pool()
             buffer_requests = self._ep.tag_send_multi(buffers, tag)
             await buffer_requests.wait()
             buffer_requests.check_error()
@@ -261,6 +275,7 @@ class Endpoint:
 
         self._recv_count += 1
 
+        self._ctx.populate_python_futures_pool()
         req = self._ep.tag_recv(buffer, tag)
         ret = await req.wait()
 
@@ -309,6 +324,7 @@ class Endpoint:
 
         self._recv_count += 1
 
+        self._ctx.populate_python_futures_pool()
         buffer_requests = self._ep.tag_recv_multi(tag)
         await buffer_requests.wait()
         buffer_requests.check_error()
@@ -27,6 +27,17 @@ async def _notifier_coroutine(worker):
     return False
 
 
+def _notifier_event_callback(worker):
+    """Notify all enqueued waiting futures from the event loop
+
+    Called by the event loop when the worker's request notifier file descriptor
+    becomes readable, notifying completed futures directly, without requiring a
+    notifier thread.
+    """
+    worker.run_request_notifier()
+    worker.populate_python_futures_pool()
+
+
 def _notifierThread(event_loop, worker, q):
     logger.debug("Starting Notifier Thread")
     asyncio.set_event_loop(event_loop)
@@ -4,6 +4,7 @@
 import asyncio
 from queue import Empty, Queue
 
+import numpy as np
 import pytest
 
 import ucxx
@@ -91,3 +92,69 @@ async def test_cancel(transfer_api):
     ):
         await client_node(listener.port)
     listener.close()
+
+
+@pytest.mark.asyncio
+async def test_endpoint_pool():
+    ctx = ucxx.core._get_ctx()
+    pool = ctx.enable_endpoint_pool(max_size=4, idle_timeout=60.0)
+
+    done = [False]
+
+    async def server_node(ep):
+        msg = np.empty(10, dtype="u1")
+        for _ in range(2):
+            await ep.recv(msg)
+        done[0] = True
+
+    listener = ucxx.create_listener(server_node)
+
+    ep = await ucxx.create_endpoint(ucxx.get_address(), listener.port)
+    uid = ep.uid
+    await ep.send(np.arange(10, dtype="u1"))
+    await ep.close()
+    assert pool.size == 1
+
+    # The idle endpoint is reused without exchanging peer information again
+    ep = await ucxx.create_endpoint(ucxx.get_address(), listener.port)
+    assert ep.uid == uid
+    assert pool.hits == 1
+    assert pool.misses == 1
+    await ep.send(np.arange(10, dtype="u1"))
+
+    while done[0] is False:
+        await asyncio.sleep(0.01)
+    pool.clear()
+
+
+@pytest.mark.asyncio
+async def test_endpoint_pool_reused_without_tags():
+    ctx = ucxx.core._get_ctx()
+    pool = ctx.enable_endpoint_pool(max_size=4, idle_timeout=60.0)
+
+    received = [0]
+
+    async def server_node(ep):
+        msg = np.empty(10, dtype="u1")
+        await ep.recv(msg)
+        received[0] += 1
+
+    listener = ucxx.create_listener(server_node)
+
+    ep = await ucxx.create_endpoint(ucxx.get_address(), listener.port)
+    await ep.send(np.arange(10, dtype="u1"))
+
+    # Released directly to the pool, the endpoint's tags are not kept with it
+    pool.release(ep._ep)
+    assert pool.size == 1
+
+    # The untagged idle endpoint is discarded and a new one is created instead
+    ep = await asyncio.wait_for(
+        ucxx.create_endpoint(ucxx.get_address(), listener.port), timeout=10.0
+    )
+    assert pool.size == 0
+    await ep.send(np.arange(10, dtype="u1"))
+
+    while received[0] < 2:
+        await asyncio.sleep(0.01)
+    pool.clear()
@@ -173,3 +173,24 @@ async def test_send_recv_obj_numpy():
     got = await client.recv_obj(allocator=allocator)
     assert msg == got
     await wait_listener_client_handlers(listener)
+
+
+@pytest.mark.asyncio
+@pytest.mark.parametrize("size", msg_sizes)
+async def test_send_recv_blocking_progress_mode(size):
+    ucxx.init(progress_mode="blocking")
+
+    msg = np.arange(size, dtype="u1")
+    msg_size = np.array([msg.nbytes], dtype=np.uint64)
+
+    listener = ucxx.create_listener(
+        make_echo_server(lambda n: np.empty(n, dtype="u1"))
+    )
+    client = await ucxx.create_endpoint(ucxx.get_address(), listener.port)
+    await client.send(msg_size)
+    await client.send(msg)
+    resp = np.empty_like(msg)
+    await client.recv(resp)
+    np.testing.assert_array_equal(resp, msg)
+    await client.close()
+    await wait_listener_client_handlers(listener)
@@ -0,0 +1,178 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
+# SPDX-License-Identifier: BSD-3-Clause
+
+import argparse
+import asyncio
+import threading
+from queue import Queue
+from time import monotonic
+
+import numpy as np
+import ucxx._lib.libucxx as ucx_api
+from ucxx._lib.arr import Array
+from ucxx._lib_async.notifier_thread import _notifier_event_callback, _notifierThread
+from ucxx._lib_async.utils import get_event_loop
+from ucxx.utils import print_key_value, print_separator
+
+
+async def _complete_futures(ep, send_bufs, recv_bufs):
+    requests = []
+    for i, (send_buf, recv_buf) in enumerate(zip(send_bufs, recv_bufs)):
+        requests.append(ep.tag_recv(recv_buf, tag=i))
+        requests.append(ep.tag_send(send_buf, tag=i))
+
+    await asyncio.gather(*[r.wait() for r in requests])
+    return len(requests)
+
+
+async def run(args, ep):
+    send_bufs = [
+        Array(np.arange(args.n_bytes, dtype="u1")) for _ in range(args.n_futures)
+    ]
+    recv_bufs = [
+        Array(np.empty(args.n_bytes, dtype="u1")) for _ in range(args.n_futures)
+    ]
+
+    for _ in range(args.n_warmup_iter):
+        await _complete_futures(ep, send_bufs, recv_bufs)
+
+    times = []
+    for _ in range(args.n_iter):
+        start = monotonic()
+        completed = await _complete_futures(ep, send_bufs, recv_bufs)
+        times.append((completed, monotonic() - start))
+
+    return times
+
+
+def main():
+    args = parse_args()
+
+    loop = get_event_loop()
+
+    ctx = ucx_api.UCXContext()
+    worker = ucx_api.UCXWorker(
+        ctx,
+        enable_delayed_submission=args.enable_delayed_submission,
+        enable_python_future=True,
+    )
+    if not worker.is_python_future_enabled():
+        raise RuntimeError("UCXX must be built with UCXX_ENABLE_PYTHON=1")
+
+    worker.start_progress_thread(polling_mode=args.polling_mode)
+
+    if args.notifier_thread:
+        notifier_thread_q = Queue()
+        notifier_thread = threading.Thread(
+            target=_notifierThread,
+            args=(loop, worker, notifier_thread_q),
+            name="UCX-Py Async Notifier Thread",
+        )
+        notifier_thread.start()
+    else:
+        notifier_fd = worker.request_notifier_file_descriptor
+        worker.populate_python_futures_pool()
+        loop.add_reader(notifier_fd, _notifier_event_callback, worker)
+
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker,
+        ucx_api.UCXAddress.create_from_worker(worker),
+        endpoint_error_handling=False,
+    )
+
+    times = loop.run_until_complete(run(args, ep))
+
+    if args.notifier_thread:
+        notifier_thread_q.put("shutdown")
+        worker.stop_request_notifier_thread()
+        while notifier_thread.is_alive():
+            loop.run_until_complete(asyncio.sleep(0.01))
+            notifier_thread.join(timeout=0.01)
+    else:
+        loop.remove_reader(notifier_fd)
+    worker.stop_progress_thread()
+
+    total_completed = sum(c for c, _ in times)
+    total_time = sum(t for _, t in times)
+    rates = [c / t for c, t in times]
+
+    print("Future completion benchmark")
+    print_separator(separator="=")
+    print_key_value(key="Iterations", value=f"{args.n_iter}")
+    print_key_value(key="Futures per iteration", value=f"{2 * args.n_futures}")
+    print_key_value(key="Bytes", value=f"{args.n_bytes}")
+    print_key_value(key="Delayed submission", value=f"{args.enable_delayed_submission}")
+    print_key_value(key="Polling mode", value=f"{args.polling_mode}")
+    print_key_value(key="Notifier thread", value=f"{args.notifier_thread}")
+    print_separator(separator="=")
+    print_key_value("Futures/s (average)", value=f"{int(total_completed / total_time)}")
+    print_key_value("Futures/s (median)", value=f"{int(np.median(rates))}")
+    if not args.no_detailed_report:
+        print_separator(separator="=")
+        print_key_value(key="Iterations", value="Futures/s")
+        print_separator(separator="-")
+        for i, rate in enumerate(rates):
+            print_key_value(key=i, value=f"{int(rate)}")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Future completion benchmark")
+    parser.add_argument(
+        "-f",
+        "--n-futures",
+        default=10000,
+        type=int,
+        help="Number of send/recv pairs in each iteration, each pair completing "
+        "two futures (default 10000).",
+    )
+    parser.add_argument(
+        "-n",
+        "--n-bytes",
+        default=8,
+        type=int,
+        help="Message size in bytes (default 8).",
+    )
+    parser.add_argument(
+        "--n-iter",
+        metavar="N",
+        default=10,
+        type=int,
+        help="Number of iterations (default 10).",
+    )
+    parser.add_argument(
+        "--n-warmup-iter",
+        default=2,
+        type=int,
+        help="Number of warmup iterations (default 2).",
+    )
+    parser.add_argument(
+        "--enable-delayed-submission",
+        default=False,
+        action="store_true",
+        help="Enable delayed submission (default disabled).",
+    )
+    parser.add_argument(
+        "--polling-mode",
+        default=False,
+        action="store_true",
+        help="Run the worker progress thread in polling mode (default disabled).",
+    )
+    parser.add_argument(
+        "--notifier-thread",
+        default=False,
+        action="store_true",
+        help="Notify futures from a notifier thread instead of the event loop "
+        "(default disabled).",
+    )
+    parser.add_argument(
+        "--no-detailed-report",
+        default=False,
+        action="store_true",
+        help="Disable detailed report per iteration.",
+    )
+
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    main()
@@ -46,7 +46,8 @@ def init(options={}, env_takes_precedence=False, progress_mode=None):
     progress_mode: string, optional
         If None, thread UCX progress mode is used unless the environment variable
         `UCXPY_PROGRESS_MODE` is defined. Otherwise the options are 'blocking',
-        'polling', 'thread'.
+        'polling', 'thread', 'thread-polling'. In 'blocking' mode the worker is
+        progressed by the event loop only when UCX signals new events.
     """
     global _ctx
     if _ctx is not None: